@@ -7,98 +7,306 @@
 #ifndef A_STAR_H_
 #define A_STAR_H_
 
+#include <cmath>
 #include <cstddef>
 #include <limits>
+#include <type_traits>
 
 #include "edge.h"
 #include "graph.h"
 #include "graph_utils.h"
 #include "heuristics.h"
+#include "landmarks.h"
+#include "pair.h"
 #include "priority_queue_bheap.h"
 
 namespace graph
 {
-    /**
-     * @brief A* algorithm to find the shortest path between two nodes in a graph
-     * @param graph The graph to search
-     * @param sourceID The ID of the source node
-     * @param targetID The ID of the target node
-     * @param heuristic The heuristic function to estimate the cost to reach the
-     * target node
-     */
-    template<typename typeG,
-             typename typeT,
-             typename typeD,
-             std::size_t nDim,
-             bool        directed>
-    inline void AStar(Graph<typeG, typeT, typeD, nDim, directed>& graph,
-                      std::size_t                                 sourceID,
-                      std::size_t                                 targetID,
-                      heuristics::distance::Heuristic             heuristic =
-                          heuristics::distance::Heuristic::EUCLIDEAN)
+    namespace
     {
-        bheap::PriorityQueue<Vertex<typeG, typeT, typeD, nDim>*,
-                             decltype(compare::Vertex<typeG, typeT, typeD, nDim>)>
-            minPQueue;
+        /**
+         * @brief A* search loop shared by all the heuristic choices
+         * @param graph The graph to search
+         * @param sourceID The ID of the source node
+         * @param targetID The ID of the target node
+         * @param estimate Callable estimate(v, t) returning the estimated cost from
+         * vertex v to the target vertex t
+         * @param stats Optional counters to be filled with the work done by the search
+         */
+        template<typename typeG,
+                 typename typeT,
+                 typename typeD,
+                 std::size_t nDim,
+                 bool        directed,
+                 typename Estimate>
+        inline void AStarSearch(Graph<typeG, typeT, typeD, nDim, directed>& graph,
+                                std::size_t                                 sourceID,
+                                std::size_t                                 targetID,
+                                Estimate                                    estimate,
+                                SearchStatistics*                           stats)
+        {
+            // The queue keeps a copy of the cost of each entry, since the cost stored
+            // in a vertex changes while the vertex is still queued
+            // Pair<first, second> = <cost + heuristic, vertex>
+            using KeyVertex = Pair<typeG, Vertex<typeG, typeT, typeD, nDim>*>;
 
-        // Defines the infinity value for the typeG type
-        typeG INFINITY_VALUE = std::numeric_limits<typeG>::max();
+            bheap::PriorityQueue<
+                KeyVertex,
+                decltype(compare::Key<typeG, Vertex<typeG, typeT, typeD, nDim>*>)>
+                minPQueue;
 
-        // Set all vertices as not visited
-        // Pair<first, second> = <ID, Vertex>
-        for (auto& pair : graph.GetVertices())
-        {
-            pair.GetSecond().SetLabel(VertexLabel::UNVISITED);
-            pair.GetSecond().SetCurrentCost(INFINITY_VALUE);
-            pair.GetSecond().SetHeuristicCost(INFINITY_VALUE);
-        }
+            // Defines the infinity value for the typeG type
+            typeG INFINITY_VALUE = std::numeric_limits<typeG>::max();
 
-        // Auxiliar variables to make code most legible
-        Vertex<typeG, typeT, typeD, nDim>* u = nullptr;
-        Vertex<typeG, typeT, typeD, nDim>* v = nullptr;
-        Vertex<typeG, typeT, typeD, nDim>* t = nullptr;
+            // Set all vertices as not visited
+            // Pair<first, second> = <ID, Vertex>
+            for (auto& pair : graph.GetVertices())
+            {
+                pair.GetSecond().SetLabel(VertexLabel::UNVISITED);
+                pair.GetSecond().SetCurrentCost(INFINITY_VALUE);
+                pair.GetSecond().SetHeuristicCost(INFINITY_VALUE);
+                pair.GetSecond().SetEdge2Predecessor(nullptr);
+            }
 
-        Edge<typeG, typeT, typeD, nDim>* uv;
+            // Auxiliar variables to make code most legible
+            Vertex<typeG, typeT, typeD, nDim>* u = nullptr;
+            Vertex<typeG, typeT, typeD, nDim>* v = nullptr;
+            Vertex<typeG, typeT, typeD, nDim>* t = nullptr;
 
-        u = &graph.GetVertex(sourceID);
-        t = &graph.GetVertex(targetID);
+            Edge<typeG, typeT, typeD, nDim>* uv;
 
-        u->SetCurrentCost(CalculateHeuristic(heuristic, u, t));
-        u->SetHeuristicCost(CalculateHeuristic(heuristic, u, t));
+            // The current cost of a vertex stores cost + heuristic in typeG, so for
+            // integral costs the heuristic is rounded down to keep the sum exact. A
+            // rounded down consistent heuristic is still consistent
+            auto Heuristic = [&estimate, stats](auto* w, auto* target) {
+                if (stats)
+                    stats->m_heuristicEvaluations++;
 
-        minPQueue.Enqueue(u);
+                return std::is_integral<typeG>::value ? std::floor(estimate(w, target))
+                                                      : estimate(w, target);
+            };
 
-        while (not minPQueue.IsEmpty())
-        {
-            u = minPQueue.Dequeue();
+            // Policies with a batch kernel score the neighbors reached for the first
+            // time by an expansion with one call. The buffers are reused across the
+            // expansions
+            constexpr bool batch =
+                heuristics::distance::BatchHeuristicPolicy<Estimate, nDim>;
 
-            u->SetLabel(VertexLabel::VISITED);
+            heuristics::distance::CoordinateBlock<nDim> block;
+            Vector<Vertex<typeG, typeT, typeD, nDim>*>  reached;
+            Vector<double_t>                            distances;
+            double_t                                    targetCoordinates[nDim];
 
-            if (u->GetID() == targetID)
+            u = &graph.GetVertex(sourceID);
+            t = &graph.GetVertex(targetID);
+
+            if constexpr (batch)
             {
-                // PrintPath(graph, u);
-                break;
+                for (std::size_t d = 0; d < nDim; d++)
+                    targetCoordinates[d] =
+                        static_cast<double_t>(t->GetCoordinates().At(d));
             }
 
-            // Pair<first, second> = <ID, Edge>
-            for (auto& pair : u->GetAdjacencyList())
+            u->SetHeuristicCost(Heuristic(u, t));
+            u->SetCurrentCost(u->GetHeuristicCost());
+
+            minPQueue.Enqueue(KeyVertex(u->GetCurrentCost(), u));
+
+            while (not minPQueue.IsEmpty())
             {
-                // Edge uv (or vu, if is non-directed)
-                uv = pair.GetSecond();
+                u = minPQueue.Dequeue().GetSecond();
 
-                v = GetAdjacentVertex(graph, u, uv);
+                // Skip outdated entries of vertices already expanded
+                if (u->GetLabel() == VertexLabel::VISITED)
+                    continue;
 
-                if (v->GetLabel() == VertexLabel::UNVISITED)
+                u->SetLabel(VertexLabel::VISITED);
+
+                if (stats)
+                    stats->m_settledVertices++;
+
+                if (u->GetID() == targetID)
                 {
-                    v->SetHeuristicCost(CalculateHeuristic(heuristic, v, t));
+                    // PrintPath(graph, u);
+                    break;
+                }
 
-                    if (Relax(u, v, uv))
+                if constexpr (batch)
+                {
+                    block.Clear();
+                    reached.Clear();
+
+                    // Pair<first, second> = <ID, Edge>
+                    for (auto& pair : u->GetAdjacencyList())
                     {
-                        minPQueue.Enqueue(v);
+                        v = GetAdjacentVertex(graph, u, pair.GetSecond());
+
+                        // The heuristic of a vertex is the maximum value until it is
+                        // scored. Zero marks the vertices already in the block, so
+                        // parallel edges add them once
+                        if (v->GetLabel() == VertexLabel::UNVISITED and
+                            v->GetHeuristicCost() == INFINITY_VALUE)
+                        {
+                            block.PushBack(v);
+                            reached.PushBack(v);
+                            v->SetHeuristicCost(0);
+                        }
+                    }
+
+                    while (distances.Size() < reached.Size())
+                        distances.PushBack(0);
+
+                    if (reached.Size() > 0)
+                        estimate(block, targetCoordinates, &distances[0]);
+
+                    for (std::size_t i = 0; i < reached.Size(); i++)
+                    {
+                        if (stats)
+                            stats->m_heuristicEvaluations++;
+
+                        reached[i]->SetHeuristicCost(std::is_integral<typeG>::value
+                                                         ? std::floor(distances[i])
+                                                         : distances[i]);
+                    }
+                }
+
+                // Pair<first, second> = <ID, Edge>
+                for (auto& pair : u->GetAdjacencyList())
+                {
+                    // Edge uv (or vu, if is non-directed)
+                    uv = pair.GetSecond();
+
+                    if (stats)
+                        stats->m_relaxedEdges++;
+
+                    v = GetAdjacentVertex(graph, u, uv);
+
+                    if (v->GetLabel() == VertexLabel::UNVISITED)
+                    {
+                        // A vertex with a finite cost was reached before in this
+                        // query, so its heuristic is already stored in it. With a
+                        // batch policy, the block above already stored it
+                        if (v->GetCurrentCost() != INFINITY_VALUE)
+                        {
+                            if (stats)
+                                stats->m_heuristicCacheHits++;
+                        }
+                        else if constexpr (not batch)
+                        {
+                            v->SetHeuristicCost(Heuristic(v, t));
+                        }
+
+                        if (Relax(u, v, uv))
+                        {
+                            minPQueue.Enqueue(KeyVertex(v->GetCurrentCost(), v));
+                        }
                     }
                 }
             }
         }
+    } // namespace
+
+    /**
+     * @brief A* algorithm to find the shortest path between two nodes in a graph,
+     * with a heuristic given as a policy
+     * @param graph The graph to search
+     * @param sourceID The ID of the source node
+     * @param targetID The ID of the target node
+     * @param heuristic Function object heuristic(v, t) that estimates the cost to
+     * reach the target node t from vertex v, e.g., heuristics::distance::
+     * ManhattanPolicy or a lambda. Its call is inlined in the search. Policies
+     * that satisfy BatchHeuristicPolicy score the neighbors of each expanded vertex
+     * in one block
+     * @param stats Optional counters to be filled with the work done by the search
+     */
+    template<typename typeG,
+             typename typeT,
+             typename typeD,
+             std::size_t nDim,
+             bool        directed,
+             typename Policy>
+    requires heuristics::distance::HeuristicPolicy<Policy, typeG, typeT, typeD, nDim>
+    inline void AStar(Graph<typeG, typeT, typeD, nDim, directed>& graph,
+                      std::size_t                                 sourceID,
+                      std::size_t                                 targetID,
+                      Policy                                      heuristic,
+                      SearchStatistics*                           stats = nullptr)
+    {
+        AStarSearch(graph, sourceID, targetID, heuristic, stats);
+    }
+
+    /**
+     * @brief A* algorithm to find the shortest path between two nodes in a graph
+     * @param graph The graph to search
+     * @param sourceID The ID of the source node
+     * @param targetID The ID of the target node
+     * @param heuristic The heuristic function to estimate the cost to reach the
+     * target node. It is dispatched to its policy once, before the search starts
+     * @param stats Optional counters to be filled with the work done by the search
+     */
+    template<typename typeG,
+             typename typeT,
+             typename typeD,
+             std::size_t nDim,
+             bool        directed>
+    inline void AStar(Graph<typeG, typeT, typeD, nDim, directed>& graph,
+                      std::size_t                                 sourceID,
+                      std::size_t                                 targetID,
+                      heuristics::distance::Heuristic             heuristic =
+                          heuristics::distance::Heuristic::EUCLIDEAN,
+                      SearchStatistics*                           stats = nullptr)
+    {
+        heuristics::distance::Dispatch(heuristic, [&](auto policy) {
+            AStarSearch(graph, sourceID, targetID, policy, stats);
+        });
+    }
+
+    /**
+     * @brief A* algorithm guided by the landmark lower bounds (ALT)
+     * @param graph The graph to search
+     * @param sourceID The ID of the source node
+     * @param targetID The ID of the target node
+     * @param landmarks Landmark tables built on a FrozenGraph of this same graph
+     * @param stats Optional counters to be filled with the work done by the search
+     *
+     * Unlike the geometric heuristics, the landmark bounds follow the edge costs, so
+     * they stay useful when the costs are not distances (e.g., travel times). Tables
+     * that do not cover every vertex ID of the graph, such as stale ones, are ignored
+     * and the search runs with a zero heuristic
+     */
+    template<typename typeG,
+             typename typeT,
+             typename typeD,
+             std::size_t nDim,
+             bool        directed>
+    inline void AStar(Graph<typeG, typeT, typeD, nDim, directed>& graph,
+                      std::size_t                                 sourceID,
+                      std::size_t                                 targetID,
+                      const Landmarks<typeG>&                     landmarks,
+                      SearchStatistics*                           stats = nullptr)
+    {
+        if (graph.GetLastVertexID() >= landmarks.GetNumVertices())
+        {
+            AStarSearch(
+                graph,
+                sourceID,
+                targetID,
+                [](Vertex<typeG, typeT, typeD, nDim>*,
+                   Vertex<typeG, typeT, typeD, nDim>*) -> double_t { return 0; },
+                stats);
+
+            return;
+        }
+
+        AStarSearch(
+            graph,
+            sourceID,
+            targetID,
+            [&landmarks](Vertex<typeG, typeT, typeD, nDim>* v,
+                         Vertex<typeG, typeT, typeD, nDim>* t) -> double_t {
+                return landmarks.LowerBound(v->GetID(), t->GetID());
+            },
+            stats);
     }
 } // namespace graph
 
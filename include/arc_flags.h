@@ -0,0 +1,503 @@
+/*
+ * Filename: arc_flags.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef ARC_FLAGS_H_
+#define ARC_FLAGS_H_
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+#include "quick_sort.h"
+#include "vector.h"
+
+#include "dijkstra.h"
+#include "frozen_graph.h"
+#include "graph.h"
+#include "graph_utils.h"
+#include "parallel.h"
+#include "search_workspace.h"
+
+namespace graph
+{
+    namespace
+    {
+        /**
+         * @brief Split a set of vertices into regions along the coordinate with the
+         * largest extent, recursively
+         * @param coordinates nDim coordinates per vertex ID
+         * @param nDim Number of coordinates of each vertex
+         * @param vertices IDs of the vertices to be split. They are sorted by the
+         * function
+         * @param firstRegion, numRegions Range of regions given to the vertices
+         * @param regions Receives the region of each vertex
+         */
+        inline void SplitRegions(const Vector<double_t>& coordinates,
+                                 std::size_t             nDim,
+                                 Vector<std::size_t>&    vertices,
+                                 std::size_t             firstRegion,
+                                 std::size_t             numRegions,
+                                 Vector<uint32_t>&       regions)
+        {
+            if (numRegions == 1 or vertices.Size() <= 1)
+            {
+                for (std::size_t i = 0; i < vertices.Size(); i++)
+                    regions[vertices[i]] = firstRegion;
+
+                return;
+            }
+
+            // Split along the coordinate with the largest extent
+            std::size_t axis   = 0;
+            double_t    extent = -1;
+
+            for (std::size_t d = 0; d < nDim; d++)
+            {
+                double_t low  = coordinates[vertices[0] * nDim + d];
+                double_t high = low;
+
+                for (std::size_t i = 1; i < vertices.Size(); i++)
+                {
+                    double_t x = coordinates[vertices[i] * nDim + d];
+
+                    low  = x < low ? x : low;
+                    high = x > high ? x : high;
+                }
+
+                if (high - low > extent)
+                {
+                    axis   = d;
+                    extent = high - low;
+                }
+            }
+
+            // Ties are broken by ID, so the partition does not depend on the sort
+            sort::Quick(vertices, [&](const std::size_t& a, const std::size_t& b) {
+                double_t xa = coordinates[a * nDim + axis];
+                double_t xb = coordinates[b * nDim + axis];
+
+                return xa < xb or (xa == xb and a < b);
+            });
+
+            std::size_t leftRegions = numRegions / 2;
+            std::size_t middle      = vertices.Size() * leftRegions / numRegions;
+
+            Vector<std::size_t> left;
+            Vector<std::size_t> right;
+
+            for (std::size_t i = 0; i < vertices.Size(); i++)
+                (i < middle ? left : right).PushBack(vertices[i]);
+
+            SplitRegions(coordinates, nDim, left, firstRegion, leftRegions, regions);
+            SplitRegions(coordinates,
+                         nDim,
+                         right,
+                         firstRegion + leftRegions,
+                         numRegions - leftRegions,
+                         regions);
+        }
+    } // namespace
+
+    /**
+     * @brief Arc flags of a frozen graph, used to prune the arcs that cannot lead to
+     * the target of a query
+     *
+     * @tparam typeG The type for the cost of the graph's edges
+     *
+     * The vertices are split into regions and every arc gets one flag per region,
+     * set when the arc lies on some shortest path to a vertex of the region. Arcs
+     * with both ends in the same region are always flagged for it. A search
+     * towards a target in region R then only follows the arcs flagged for R, which
+     * keeps it close to the shortest paths and still finds an optimal one.
+     *
+     * The flags of a region are computed by one backward Dijkstra search from each
+     * boundary vertex of the region, that is, each vertex with an arc coming from
+     * another region. An arc (u, v) lies on a shortest path to the boundary vertex
+     * b if d(u, b) = cost(u, v) + d(v, b). Every region is handled by one task, so
+     * the regions are preprocessed in parallel.
+     *
+     * The flags are stored region by region, one bit per forward arc, so a query only
+     * reads the bits of the region of its target. The flags must be rebuilt whenever
+     * the graph or its costs change.
+     */
+    template<typename typeG>
+    class ArcFlags
+    {
+        private:
+            std::size_t m_numVertices;
+            std::size_t m_numArcs;
+            std::size_t m_numRegions;
+
+            // Region of each vertex
+            Vector<uint32_t> m_regions;
+
+            // Row R holds one bit per arc, set if the arc is flagged for region R
+            Vector<uint64_t> m_flags;
+            std::size_t      m_wordsPerRegion;
+
+        public:
+            ArcFlags();
+
+            /**
+             * @brief Compute the flags of a given partition of the vertices
+             * @param graph The frozen graph to be preprocessed
+             * @param regions Region of each vertex, from 0 to the number of regions
+             * minus one, indexed by vertex ID
+             * @param numThreads Number of threads to be used. Zero means one thread
+             * per hardware thread
+             */
+            void Build(const FrozenGraph<typeG>& graph,
+                       const Vector<uint32_t>&   regions,
+                       std::size_t               numThreads = 0);
+
+            /**
+             * @brief Split the vertices into regions by a kd partition of their
+             * coordinates and compute the flags
+             * @param graph The graph whose vertex coordinates are partitioned
+             * @param frozen A frozen graph of the same graph, to be preprocessed
+             * @param numRegions Number of regions. Each split divides a set of
+             * vertices along its widest coordinate, in proportion to the number of
+             * regions on each side, so the regions have about the same size.
+             * Vertices without nDim coordinates are left out of the split and put in
+             * region 0, which only makes the flags less selective
+             * @param numThreads Number of threads to be used. Zero means one thread
+             * per hardware thread
+             */
+            template<typename typeT, typename typeD, std::size_t nDim, bool directed>
+            void Build(Graph<typeG, typeT, typeD, nDim, directed>& graph,
+                       const FrozenGraph<typeG>&                   frozen,
+                       std::size_t                                 numRegions,
+                       std::size_t                                 numThreads = 0);
+
+            /**
+             * @return The number of regions
+             */
+            std::size_t GetNumRegions() const;
+
+            /**
+             * @return The size of the vertex ID space covered by the flags
+             */
+            std::size_t GetNumVertices() const;
+
+            /**
+             * @param vertexID ID of the vertex
+             * @return The region of the vertex
+             */
+            std::size_t GetRegion(std::size_t vertexID) const;
+
+            /**
+             * @param arc Index of a forward arc of the frozen graph
+             * @param region The region of the target
+             * @return True if the arc may lead to a vertex of the region
+             */
+            bool HasFlag(std::size_t arc, std::size_t region) const;
+
+            /**
+             * @param region The region of the target
+             * @return The number of arcs flagged for the region
+             */
+            std::size_t GetNumFlags(std::size_t region) const;
+    };
+
+    template<typename typeG>
+    ArcFlags<typeG>::ArcFlags()
+    {
+        this->m_numVertices    = 0;
+        this->m_numArcs        = 0;
+        this->m_numRegions     = 0;
+        this->m_wordsPerRegion = 0;
+    }
+
+    template<typename typeG>
+    void ArcFlags<typeG>::Build(const FrozenGraph<typeG>& graph,
+                                const Vector<uint32_t>&   regions,
+                                std::size_t               numThreads)
+    {
+        this->m_numVertices    = graph.GetNumVertices();
+        this->m_numArcs        = graph.GetNumArcs();
+        this->m_regions        = regions;
+        this->m_numRegions     = 0;
+        this->m_wordsPerRegion = (this->m_numArcs + 63) / 64;
+
+        for (std::size_t v = 0; v < this->m_numVertices; v++)
+        {
+            if (this->m_numRegions < std::size_t(regions[v]) + 1)
+                this->m_numRegions = std::size_t(regions[v]) + 1;
+        }
+
+        this->m_flags =
+            Vector<uint64_t>(this->m_numRegions * this->m_wordsPerRegion, 0);
+
+        // Vertices and boundary vertices of each region
+        Vector<Vector<std::size_t>> members;
+        Vector<Vector<std::size_t>> boundary;
+
+        for (std::size_t r = 0; r < this->m_numRegions; r++)
+        {
+            members.PushBack(Vector<std::size_t>());
+            boundary.PushBack(Vector<std::size_t>());
+        }
+
+        for (std::size_t v = 0; v < this->m_numVertices; v++)
+        {
+            members[regions[v]].PushBack(v);
+
+            for (std::size_t arc = graph.GetFirstArc(v, true);
+                 arc < graph.GetLastArc(v, true);
+                 arc++)
+            {
+                if (regions[graph.GetHead(arc, true)] != regions[v])
+                {
+                    boundary[regions[v]].PushBack(v);
+                    break;
+                }
+            }
+        }
+
+        numThreads = parallel::GetNumThreads(numThreads);
+
+        std::unique_ptr<SearchWorkspace<typeG>[]> workspaces(
+            new SearchWorkspace<typeG>[numThreads]);
+
+        // Each region only writes its own row, so the tasks do not share words
+        parallel::For(
+            this->m_numRegions,
+            [&](std::size_t region, std::size_t threadIndex) {
+                SearchWorkspace<typeG>& workspace = workspaces[threadIndex];
+
+                uint64_t* row = &this->m_flags[0] + region * this->m_wordsPerRegion;
+
+                auto Flag = [row](std::size_t arc) {
+                    row[arc / 64] |= uint64_t(1) << (arc % 64);
+                };
+
+                for (std::size_t i = 0; i < members[region].Size(); i++)
+                {
+                    std::size_t v = members[region][i];
+
+                    for (std::size_t arc = graph.GetFirstArc(v);
+                         arc < graph.GetLastArc(v);
+                         arc++)
+                    {
+                        if (regions[graph.GetHead(arc)] == region)
+                            Flag(arc);
+                    }
+                }
+
+                for (std::size_t i = 0; i < boundary[region].Size(); i++)
+                {
+                    // Costs from every vertex to the boundary vertex
+                    Dijkstra(graph, boundary[region][i], workspace, true);
+
+                    const Vector<std::size_t>& settled = workspace.GetSettledOrder();
+
+                    for (std::size_t j = 0; j < settled.Size(); j++)
+                    {
+                        std::size_t u = settled[j];
+
+                        for (std::size_t arc = graph.GetFirstArc(u);
+                             arc < graph.GetLastArc(u);
+                             arc++)
+                        {
+                            std::size_t v = graph.GetHead(arc);
+
+                            if (workspace.IsSettled(v) and
+                                workspace.GetCost(v) + graph.GetCost(arc) <=
+                                    workspace.GetCost(u))
+                                Flag(arc);
+                        }
+                    }
+                }
+            },
+            numThreads);
+    }
+
+    template<typename typeG>
+    template<typename typeT, typename typeD, std::size_t nDim, bool directed>
+    void ArcFlags<typeG>::Build(Graph<typeG, typeT, typeD, nDim, directed>& graph,
+                                const FrozenGraph<typeG>&                   frozen,
+                                std::size_t                                 numRegions,
+                                std::size_t                                 numThreads)
+    {
+        std::size_t n = frozen.GetNumVertices();
+
+        Vector<double_t>    coordinates(n * nDim, 0);
+        Vector<std::size_t> vertices;
+
+        // Pair<first, second> = <ID, Vertex>
+        for (auto& pair : graph.GetVertices())
+        {
+            if (pair.GetSecond().GetCoordinates().Size() != nDim)
+                continue;
+
+            for (std::size_t d = 0; d < nDim; d++)
+                coordinates[pair.GetFirst() * nDim + d] =
+                    static_cast<double_t>(pair.GetSecond().GetCoordinates()[d]);
+
+            vertices.PushBack(pair.GetFirst());
+        }
+
+        // Removed vertices have no arcs, so their region does not matter. Vertices
+        // without coordinates stay in region 0
+        Vector<uint32_t> regions(n, 0);
+
+        SplitRegions(coordinates,
+                     nDim,
+                     vertices,
+                     0,
+                     numRegions < 1 ? 1 : numRegions,
+                     regions);
+
+        this->Build(frozen, regions, numThreads);
+    }
+
+    template<typename typeG>
+    std::size_t ArcFlags<typeG>::GetNumRegions() const
+    {
+        return this->m_numRegions;
+    }
+
+    template<typename typeG>
+    std::size_t ArcFlags<typeG>::GetNumVertices() const
+    {
+        return this->m_numVertices;
+    }
+
+    template<typename typeG>
+    std::size_t ArcFlags<typeG>::GetRegion(std::size_t vertexID) const
+    {
+        return this->m_regions[vertexID];
+    }
+
+    template<typename typeG>
+    bool ArcFlags<typeG>::HasFlag(std::size_t arc, std::size_t region) const
+    {
+        return (this->m_flags[region * this->m_wordsPerRegion + arc / 64] >>
+                (arc % 64)) &
+               1;
+    }
+
+    template<typename typeG>
+    std::size_t ArcFlags<typeG>::GetNumFlags(std::size_t region) const
+    {
+        std::size_t count = 0;
+
+        for (std::size_t i = 0; i < this->m_wordsPerRegion; i++)
+            count += __builtin_popcountll(
+                this->m_flags[region * this->m_wordsPerRegion + i]);
+
+        return count;
+    }
+
+    /**
+     * @brief A* search that only follows the arcs flagged for the region of the
+     * target
+     * @param graph The frozen graph the flags were built on
+     * @param flags The arc flags of the graph
+     * @param sourceID The ID of the source vertex
+     * @param targetID The ID of the target vertex
+     * @param estimate Callable estimate(v) returning a consistent lower bound of
+     * the cost from vertex v to the target, such as a geometric heuristic on the
+     * vertex coordinates or Landmarks::LowerBound(v, targetID)
+     * @param workspace The workspace used by the search. Its costs hold the cost of
+     * each vertex plus its estimate, and its predecessors give the path
+     * @param stats Optional counters to be filled with the work done by the search
+     * @return The cost of the shortest path, or the maximum value of typeG if the
+     * target cannot be reached
+     *
+     * The search stops as soon as the target is settled. For integral costs the
+     * estimates are rounded down, as done by AStar.
+     */
+    template<typename typeG, typename Estimate>
+    inline typeG ArcFlagsAStar(const FrozenGraph<typeG>& graph,
+                               const ArcFlags<typeG>&    flags,
+                               std::size_t               sourceID,
+                               std::size_t               targetID,
+                               Estimate                  estimate,
+                               SearchWorkspace<typeG>&   workspace,
+                               SearchStatistics*         stats = nullptr)
+    {
+        // Each estimate is computed once, then read from the workspace
+        auto Heuristic = [&](std::size_t v) -> typeG {
+            return workspace.GetHeuristic(
+                v,
+                [&estimate](std::size_t w) -> double_t {
+                    return std::is_integral<typeG>::value ? std::floor(estimate(w))
+                                                          : estimate(w);
+                },
+                stats);
+        };
+
+        std::size_t region = flags.GetRegion(targetID);
+
+        workspace.Reset(graph.GetNumVertices());
+        workspace.Update(sourceID, Heuristic(sourceID));
+
+        std::size_t u;
+
+        while (workspace.PopMin(u))
+        {
+            if (stats)
+                stats->m_settledVertices++;
+
+            typeG cost = workspace.GetCost(u) - Heuristic(u);
+
+            if (u == targetID)
+                return cost;
+
+            for (std::size_t arc = graph.GetFirstArc(u); arc < graph.GetLastArc(u);
+                 arc++)
+            {
+                if (not flags.HasFlag(arc, region))
+                    continue;
+
+                if (stats)
+                    stats->m_relaxedEdges++;
+
+                std::size_t v = graph.GetHead(arc);
+
+                workspace.Update(v, cost + graph.GetCost(arc) + Heuristic(v), u, arc);
+            }
+        }
+
+        return std::numeric_limits<typeG>::max();
+    }
+
+    /**
+     * @brief Dijkstra search that only follows the arcs flagged for the region of
+     * the target
+     * @param graph The frozen graph the flags were built on
+     * @param flags The arc flags of the graph
+     * @param sourceID The ID of the source vertex
+     * @param targetID The ID of the target vertex
+     * @param workspace The workspace that receives the costs and predecessors
+     * @param stats Optional counters to be filled with the work done by the search
+     * @return The cost of the shortest path, or the maximum value of typeG if the
+     * target cannot be reached
+     */
+    template<typename typeG>
+    inline typeG ArcFlagsDijkstra(const FrozenGraph<typeG>& graph,
+                                  const ArcFlags<typeG>&    flags,
+                                  std::size_t               sourceID,
+                                  std::size_t               targetID,
+                                  SearchWorkspace<typeG>&   workspace,
+                                  SearchStatistics*         stats = nullptr)
+    {
+        return ArcFlagsAStar(
+            graph,
+            flags,
+            sourceID,
+            targetID,
+            [](std::size_t) -> double_t { return 0; },
+            workspace,
+            stats);
+    }
+} // namespace graph
+
+#endif // ARC_FLAGS_H_
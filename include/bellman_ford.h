@@ -0,0 +1,258 @@
+/*
+ * Filename: bellman_ford.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef BELLMAN_FORD_H_
+#define BELLMAN_FORD_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "pair.h"
+#include "vector.h"
+
+#include "frozen_graph.h"
+#include "parallel.h"
+#include "search_workspace.h"
+
+namespace graph
+{
+    namespace
+    {
+        // Number of vertices handed to a thread at once by a Bellman-Ford round
+        constexpr std::size_t BELLMAN_FORD_BLOCK_SIZE = 1024;
+    } // namespace
+
+    /**
+     * @brief Run the Bellman-Ford algorithm, which accepts negative edge costs, to
+     * find the shortest paths from the nearest of several source vertices
+     * @param graph The frozen graph on which to calculate the shortest paths
+     * @param sources IDs of the source vertices, which start with cost zero
+     * @param costs Receives the cost of each vertex, or the maximum value of typeG
+     *        for the vertices not reached
+     * @param predecessors Receives the ID of the predecessor of each vertex, or
+     *        SearchWorkspace::NO_VERTEX for the sources and the vertices not reached
+     * @param numThreads Number of threads to be used. Zero means one thread per
+     *        hardware thread
+     * @param backward True to follow the arcs in the opposite direction, which
+     *        calculates the shortest paths from all vertices to the sources
+     * @return False if a negative cycle is reachable from the sources, in which case
+     *         the costs are not the shortest ones, True otherwise
+     *
+     * The rounds are synchronous and keep the vertices whose cost changed in the
+     * previous round as a frontier, as in SPFA. A round first collects the heads of
+     * the arcs leaving the frontier, claiming each one with an atomic
+     * compare-and-swap on its round stamp so it is collected once. Then every
+     * collected vertex pulls the smallest cost among its incoming arcs whose tail
+     * is in the frontier, without writing the costs, and the improvements are
+     * applied once all threads are done. So a round costs O(F + A), where F is the
+     * number of arcs leaving the frontier and A the number of arcs entering the
+     * collected vertices, instead of O(V + E). Rounds with a frontier smaller than
+     * BELLMAN_FORD_BLOCK_SIZE run on the calling thread, so the threads are only
+     * started for the rounds with enough work to split. After round r every cost
+     * is at most the cost of the shortest path with r edges, so a change in round
+     * GetNumVertices() + 1 can only come from a negative cycle. An undirected edge
+     * with negative cost is such a cycle.
+     *
+     * Taking every vertex as a source gives the same costs as a virtual vertex with
+     * zero cost arcs to all of them, as used by the reweighting of Johnson's
+     * algorithm.
+     *
+     * Complexity: O(V * E) in the worst case, when V is the number of vertices and E
+     * is the number of edges in the graph
+     */
+    template<typename typeG>
+    inline bool MultiSourceBellmanFord(const FrozenGraph<typeG>&  graph,
+                                       const Vector<std::size_t>& sources,
+                                       Vector<typeG>&             costs,
+                                       Vector<std::size_t>&       predecessors,
+                                       std::size_t                numThreads = 0,
+                                       bool                       backward   = false)
+    {
+        // Defines the infinity value for the typeG type
+        typeG INFINITY_VALUE = std::numeric_limits<typeG>::max();
+
+        std::size_t n = graph.GetNumVertices();
+
+        costs        = Vector<typeG>(n, INFINITY_VALUE);
+        predecessors = Vector<std::size_t>(n, SearchWorkspace<typeG>::NO_VERTEX);
+
+        // Last round in which the cost of each vertex changed, and last round in
+        // which each vertex was collected. Zero means never, and the sources changed
+        // in round 1
+        Vector<std::size_t> changedRound(n, 0);
+        Vector<std::size_t> collectedRound(n, 0);
+
+        // Vertices whose cost changed in the previous round
+        Vector<std::size_t> frontier;
+
+        for (std::size_t i = 0; i < sources.Size(); i++)
+        {
+            if (sources[i] < n and changedRound[sources[i]] == 0)
+            {
+                costs[sources[i]]        = 0;
+                changedRound[sources[i]] = 1;
+                frontier.PushBack(sources[i]);
+            }
+        }
+
+        numThreads = parallel::GetNumThreads(numThreads);
+
+        Vector<Vector<std::size_t>> found(numThreads);
+        Vector<std::size_t>         collected;
+
+        // Pair<first, second> = <best cost, predecessor> of each collected vertex
+        Vector<Pair<typeG, std::size_t>> pulled;
+
+        auto NumBlocks = [](std::size_t count) {
+            return (count + BELLMAN_FORD_BLOCK_SIZE - 1) / BELLMAN_FORD_BLOCK_SIZE;
+        };
+
+        for (std::size_t round = 2; round <= n + 1 and frontier.Size() > 0; round++)
+        {
+            parallel::For(
+                NumBlocks(frontier.Size()),
+                [&](std::size_t block, std::size_t threadIndex) {
+                    std::size_t first = block * BELLMAN_FORD_BLOCK_SIZE;
+                    std::size_t last  = first + BELLMAN_FORD_BLOCK_SIZE;
+
+                    last = last < frontier.Size() ? last : frontier.Size();
+
+                    for (std::size_t i = first; i < last; i++)
+                    {
+                        std::size_t u = frontier[i];
+
+                        for (std::size_t arc = graph.GetFirstArc(u, backward);
+                             arc < graph.GetLastArc(u, backward);
+                             arc++)
+                        {
+                            std::size_t v = graph.GetHead(arc, backward);
+
+                            std::atomic_ref<std::size_t> stamp(collectedRound[v]);
+
+                            std::size_t seen = stamp.load(std::memory_order_relaxed);
+
+                            if (seen == round or
+                                not stamp.compare_exchange_strong(
+                                    seen, round, std::memory_order_relaxed))
+                                continue;
+
+                            found[threadIndex].PushBack(v);
+                        }
+                    }
+                },
+                numThreads);
+
+            collected.Clear();
+
+            for (std::size_t t = 0; t < numThreads; t++)
+            {
+                for (std::size_t i = 0; i < found[t].Size(); i++)
+                    collected.PushBack(found[t][i]);
+
+                found[t].Clear();
+            }
+
+            pulled = Vector<Pair<typeG, std::size_t>>(
+                collected.Size(),
+                Pair<typeG, std::size_t>(INFINITY_VALUE,
+                                         SearchWorkspace<typeG>::NO_VERTEX));
+
+            parallel::For(
+                NumBlocks(collected.Size()),
+                [&](std::size_t block, std::size_t) {
+                    std::size_t first = block * BELLMAN_FORD_BLOCK_SIZE;
+                    std::size_t last  = first + BELLMAN_FORD_BLOCK_SIZE;
+
+                    last = last < collected.Size() ? last : collected.Size();
+
+                    for (std::size_t i = first; i < last; i++)
+                    {
+                        std::size_t v    = collected[i];
+                        typeG       best = costs[v];
+                        std::size_t from = SearchWorkspace<typeG>::NO_VERTEX;
+
+                        // Incoming arcs of v are the arcs of the opposite direction
+                        for (std::size_t arc = graph.GetFirstArc(v, not backward);
+                             arc < graph.GetLastArc(v, not backward);
+                             arc++)
+                        {
+                            std::size_t u = graph.GetHead(arc, not backward);
+
+                            // Arcs from vertices out of the frontier were relaxed
+                            // before
+                            if (changedRound[u] != round - 1)
+                                continue;
+
+                            typeG cost = costs[u] + graph.GetCost(arc, not backward);
+
+                            if (cost < best)
+                            {
+                                best = cost;
+                                from = u;
+                            }
+                        }
+
+                        pulled[i] = Pair<typeG, std::size_t>(best, from);
+                    }
+                },
+                numThreads);
+
+            frontier.Clear();
+
+            for (std::size_t i = 0; i < collected.Size(); i++)
+            {
+                std::size_t v = collected[i];
+
+                if (pulled[i].GetSecond() == SearchWorkspace<typeG>::NO_VERTEX)
+                    continue;
+
+                costs[v]        = pulled[i].GetFirst();
+                predecessors[v] = pulled[i].GetSecond();
+                changedRound[v] = round;
+                frontier.PushBack(v);
+            }
+        }
+
+        // A change in round n + 1 means a path with n edges, so a cycle
+        return frontier.Size() == 0;
+    }
+
+    /**
+     * @brief Run the Bellman-Ford algorithm, which accepts negative edge costs, to
+     * find the shortest paths from a given source vertex
+     * @param graph The frozen graph on which to calculate the shortest paths
+     * @param sourceID The source vertex id from which to calculate the shortest
+     *        paths
+     * @param costs Receives the cost of each vertex, or the maximum value of typeG
+     *        for the vertices not reached
+     * @param predecessors Receives the ID of the predecessor of each vertex, or
+     *        SearchWorkspace::NO_VERTEX for the source and the vertices not reached
+     * @param numThreads Number of threads to be used. Zero means one thread per
+     *        hardware thread
+     * @param backward True to follow the arcs in the opposite direction, which
+     *        calculates the shortest paths from all vertices to sourceID
+     * @return False if a negative cycle is reachable from the source, in which case
+     *         the costs are not the shortest ones, True otherwise
+     */
+    template<typename typeG>
+    inline bool BellmanFord(const FrozenGraph<typeG>& graph,
+                            std::size_t               sourceID,
+                            Vector<typeG>&            costs,
+                            Vector<std::size_t>&      predecessors,
+                            std::size_t               numThreads = 0,
+                            bool                      backward   = false)
+    {
+        Vector<std::size_t> sources;
+        sources.PushBack(sourceID);
+
+        return MultiSourceBellmanFord(
+            graph, sources, costs, predecessors, numThreads, backward);
+    }
+} // namespace graph
+
+#endif // BELLMAN_FORD_H_
@@ -7,13 +7,19 @@
 #ifndef BFS_H_
 #define BFS_H_
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <limits>
 
+#include "queue_slkd.h"
+#include "vector.h"
+
 #include "edge.h"
+#include "frozen_graph.h"
 #include "graph.h"
 #include "graph_utils.h"
-#include "queue_slkd.h"
+#include "parallel.h"
 #include "vertex.h"
 
 namespace graph
@@ -78,6 +84,7 @@ namespace graph
                 {
                     v->SetLabel(VertexLabel::PROCESSING);
                     v->SetCurrentCost(u->GetCurrentCost() + 1);
+                    v->SetEdge2Predecessor(uv);
                     queue.Enqueue(v);
                 }
             }
@@ -85,6 +92,273 @@ namespace graph
             u->SetLabel(VertexLabel::VISITED);
         }
     }
+
+    namespace
+    {
+        // Beamer's thresholds: switch to bottom-up steps when the arcs of the
+        // frontier exceed 1/ALPHA of the arcs not yet explored, and back to top-down
+        // steps when the frontier has less than 1/BETA of the vertices
+        constexpr std::size_t BFS_ALPHA = 14;
+        constexpr std::size_t BFS_BETA  = 24;
+
+        // Number of frontier vertices, or of 64-vertex words of the bitmaps, handed
+        // to a thread at once
+        constexpr std::size_t BFS_CHUNK_SIZE = 256;
+
+        /**
+         * @brief Work done by a thread in a step of DirectionOptimizingBFS
+         */
+        struct BFSStepCounters
+        {
+                // Vertices added to the next frontier, and the sum of their degrees
+                std::size_t m_found;
+                std::size_t m_arcs;
+
+                // Arcs scanned
+                std::size_t m_scanned;
+        };
+    } // namespace
+
+    /**
+     * @brief Level-synchronous parallel Breadth-First Search on a frozen graph that
+     * switches between top-down and bottom-up steps
+     * @param graph The frozen graph to be traversed
+     * @param sourceID The ID of the source vertex
+     * @param hops Receives the number of edges from the source to each vertex, or
+     * the maximum value of uint32_t for the vertices not reached. It is reused if it
+     * has the size of the graph
+     * @param numThreads Number of threads to be used. Zero means one thread per
+     * hardware thread
+     * @param stats Optional counters to be filled with the work done by the search
+     *
+     * A top-down step scans the arcs of the frontier, held as an array of vertices,
+     * and claims the unvisited heads with an atomic compare-and-swap on their hop
+     * count. A bottom-up step scans the vertices not yet visited, each looking for a
+     * parent among its incoming arcs in the frontier, held as a bitmap, and stops at
+     * the first one found. Bottom-up steps pay off when the frontier is large, since
+     * most of the arcs of a top-down step would hit visited vertices. The switch
+     * follows Beamer et al., "Direction-Optimizing Breadth-First Search" (2012). Each
+     * thread of a bottom-up step owns whole 64-vertex words of the bitmaps, so it
+     * writes them without atomics.
+     *
+     * The hop counts are the same as the ones of BFS, whatever the number of threads
+     * and the steps taken.
+     *
+     * Complexity: O(V + E), when V is the number of vertices and E is the number of
+     * edges in the graph
+     */
+    template<typename typeG>
+    inline void DirectionOptimizingBFS(const FrozenGraph<typeG>& graph,
+                                       std::size_t               sourceID,
+                                       Vector<uint32_t>&         hops,
+                                       std::size_t               numThreads = 0,
+                                       SearchStatistics*         stats      = nullptr)
+    {
+        constexpr uint32_t NO_HOP = std::numeric_limits<uint32_t>::max();
+
+        std::size_t n = graph.GetNumVertices();
+
+        if (hops.Size() != n)
+            hops = Vector<uint32_t>(n, NO_HOP);
+        else
+            for (std::size_t v = 0; v < n; v++)
+                hops[v] = NO_HOP;
+
+        if (sourceID >= n)
+            return;
+
+        numThreads = parallel::GetNumThreads(numThreads);
+
+        auto Degree = [&](std::size_t v) {
+            return graph.GetLastArc(v) - graph.GetFirstArc(v);
+        };
+
+        std::size_t numWords = (n + 63) / 64;
+
+        Vector<std::size_t> frontier;
+        // Frontier bitmaps of the bottom-up steps. Each step reads bitmaps[current]
+        // and writes the other one, and then they trade roles
+        Vector<uint64_t> bitmaps[2];
+        std::size_t      current = 0;
+
+        Vector<Vector<std::size_t>> found(numThreads);
+        Vector<BFSStepCounters>     counters(numThreads);
+
+        hops[sourceID] = 0;
+        frontier.PushBack(sourceID);
+
+        std::size_t frontierSize   = 1;
+        std::size_t frontierArcs   = Degree(sourceID);
+        std::size_t unexploredArcs = graph.GetNumArcs() - frontierArcs;
+
+        bool bottomUp = false;
+
+        for (uint32_t level = 0; frontierSize > 0; level++)
+        {
+            if (stats)
+                stats->m_settledVertices += frontierSize;
+
+            if (not bottomUp and frontierArcs > unexploredArcs / BFS_ALPHA)
+            {
+                bottomUp = true;
+
+                if (bitmaps[0].Size() != numWords)
+                {
+                    bitmaps[0] = Vector<uint64_t>(numWords, 0);
+                    bitmaps[1] = Vector<uint64_t>(numWords, 0);
+                }
+
+                Vector<uint64_t>& frontierBits = bitmaps[current];
+
+                for (std::size_t w = 0; w < numWords; w++)
+                    frontierBits[w] = 0;
+
+                for (std::size_t i = 0; i < frontier.Size(); i++)
+                    frontierBits[frontier[i] >> 6] |= uint64_t(1) << (frontier[i] & 63);
+            }
+            else if (bottomUp and frontierSize < n / BFS_BETA)
+            {
+                bottomUp = false;
+
+                frontier.Clear();
+
+                for (std::size_t v = 0; v < n; v++)
+                    if ((bitmaps[current][v >> 6] >> (v & 63)) & 1)
+                        frontier.PushBack(v);
+            }
+
+            for (std::size_t t = 0; t < numThreads; t++)
+                counters[t] = BFSStepCounters{ 0, 0, 0 };
+
+            if (not bottomUp)
+            {
+                std::size_t numChunks =
+                    (frontier.Size() + BFS_CHUNK_SIZE - 1) / BFS_CHUNK_SIZE;
+
+                parallel::For(
+                    numChunks,
+                    [&](std::size_t chunk, std::size_t threadIndex) {
+                        BFSStepCounters& counter = counters[threadIndex];
+
+                        std::size_t first = chunk * BFS_CHUNK_SIZE;
+                        std::size_t last  = first + BFS_CHUNK_SIZE;
+
+                        last = last < frontier.Size() ? last : frontier.Size();
+
+                        for (std::size_t i = first; i < last; i++)
+                        {
+                            std::size_t u = frontier[i];
+
+                            for (std::size_t arc = graph.GetFirstArc(u);
+                                 arc < graph.GetLastArc(u);
+                                 arc++)
+                            {
+                                std::size_t v = graph.GetHead(arc);
+
+                                std::atomic_ref<uint32_t> hop(hops[v]);
+
+                                uint32_t unvisited = NO_HOP;
+                                uint32_t next      = level + 1;
+
+                                counter.m_scanned++;
+
+                                if (hop.load(std::memory_order_relaxed) != NO_HOP or
+                                    not hop.compare_exchange_strong(
+                                        unvisited, next, std::memory_order_relaxed))
+                                    continue;
+
+                                found[threadIndex].PushBack(v);
+                                counter.m_arcs += Degree(v);
+                            }
+                        }
+                    },
+                    numThreads);
+
+                frontier.Clear();
+
+                for (std::size_t t = 0; t < numThreads; t++)
+                {
+                    for (std::size_t i = 0; i < found[t].Size(); i++)
+                        frontier.PushBack(found[t][i]);
+
+                    counters[t].m_found = found[t].Size();
+                    found[t].Clear();
+                }
+            }
+            else
+            {
+                std::size_t numChunks =
+                    (numWords + BFS_CHUNK_SIZE - 1) / BFS_CHUNK_SIZE;
+
+                const Vector<uint64_t>& frontierBits = bitmaps[current];
+                Vector<uint64_t>&       nextBits     = bitmaps[current ^ 1];
+
+                parallel::For(
+                    numChunks,
+                    [&](std::size_t chunk, std::size_t threadIndex) {
+                        BFSStepCounters& counter = counters[threadIndex];
+
+                        std::size_t firstWord = chunk * BFS_CHUNK_SIZE;
+                        std::size_t lastWord  = firstWord + BFS_CHUNK_SIZE;
+
+                        lastWord = lastWord < numWords ? lastWord : numWords;
+
+                        for (std::size_t w = firstWord; w < lastWord; w++)
+                        {
+                            uint64_t    word = 0;
+                            std::size_t last = 64 * w + 64 < n ? 64 * w + 64 : n;
+
+                            for (std::size_t v = 64 * w; v < last; v++)
+                            {
+                                if (hops[v] != NO_HOP)
+                                    continue;
+
+                                // Incoming arcs, which are the arcs themselves in
+                                // undirected graphs
+                                for (std::size_t arc = graph.GetFirstArc(v, true);
+                                     arc < graph.GetLastArc(v, true);
+                                     arc++)
+                                {
+                                    std::size_t u = graph.GetHead(arc, true);
+
+                                    counter.m_scanned++;
+
+                                    if ((frontierBits[u >> 6] >> (u & 63)) & 1)
+                                    {
+                                        hops[v] = level + 1;
+                                        word |= uint64_t(1) << (v & 63);
+
+                                        counter.m_found++;
+                                        counter.m_arcs += Degree(v);
+                                        break;
+                                    }
+                                }
+                            }
+
+                            nextBits[w] = word;
+                        }
+                    },
+                    numThreads);
+
+                current ^= 1;
+            }
+
+            frontierSize = 0;
+            frontierArcs = 0;
+
+            for (std::size_t t = 0; t < numThreads; t++)
+            {
+                frontierSize += counters[t].m_found;
+                frontierArcs += counters[t].m_arcs;
+
+                if (stats)
+                    stats->m_relaxedEdges += counters[t].m_scanned;
+            }
+
+            unexploredArcs -=
+                frontierArcs < unexploredArcs ? frontierArcs : unexploredArcs;
+        }
+    }
 } // namespace graph
 
 #endif // BFS_H_
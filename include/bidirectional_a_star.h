@@ -0,0 +1,303 @@
+/*
+ * Filename: bidirectional_a_star.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef BIDIRECTIONAL_A_STAR_H_
+#define BIDIRECTIONAL_A_STAR_H_
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+#include "pair.h"
+#include "priority_queue_bheap.h"
+#include "vector.h"
+
+#include "edge.h"
+#include "graph.h"
+#include "graph_utils.h"
+#include "heuristics.h"
+
+namespace graph
+{
+    /**
+     * @brief Bidirectional A* algorithm to find the shortest path between two
+     * vertices in a graph
+     * @param graph The graph to search
+     * @param sourceID The ID of the source vertex
+     * @param targetID The ID of the target vertex
+     * @param heuristic Function object heuristic(v, t) that estimates the cost
+     * between two vertices, used to build the potentials of both searches. Its call
+     * is inlined in the search
+     * @param stats Optional counters to be filled with the work done by the search
+     * @return The cost of the shortest path, or the maximum value of typeG if the
+     * target cannot be reached
+     *
+     * A forward search from the source and a backward search from the target run
+     * alternately. Both use the average potential
+     *
+     *      pf(v) = (h(v, target) - h(source, v)) / 2,   pr(v) = -pf(v)
+     *
+     * so the reduced cost of an edge is the same in both directions and stays
+     * non-negative whenever the heuristic is consistent. The searches stop as soon as
+     * the sum of the smallest keys of both queues reaches the best path found so far.
+     *
+     * After the search, the vertices on the shortest path store their cost and the
+     * edge to their predecessor, as done by AStar, so PrintPath(graph, target) works
+     * as usual. For directed graphs, the incoming edges of every vertex are
+     * collected once per query to run the backward search.
+     */
+    template<typename typeG,
+             typename typeT,
+             typename typeD,
+             std::size_t nDim,
+             bool        directed,
+             typename Policy>
+    requires heuristics::distance::HeuristicPolicy<Policy, typeG, typeT, typeD, nDim>
+    inline typeG
+    BidirectionalAStar(Graph<typeG, typeT, typeD, nDim, directed>& graph,
+                       std::size_t                                 sourceID,
+                       std::size_t                                 targetID,
+                       Policy                                      heuristic,
+                       SearchStatistics*                           stats = nullptr)
+    {
+        // Defines the infinity value for the typeG type
+        typeG INFINITY_VALUE = std::numeric_limits<typeG>::max();
+
+        if (not(graph.ContainsVertex(sourceID) and graph.ContainsVertex(targetID)))
+            return INFINITY_VALUE;
+
+        // Vertex IDs are never reused, so they index the auxiliary vectors directly
+        std::size_t numIDs = graph.GetLastVertexID() + 1;
+
+        // Tentative costs, settled flags and tree edges of the forward (index 0) and
+        // backward (index 1) searches
+        Vector<typeG>                            cost[2];
+        Vector<bool>                             settled[2];
+        Vector<Edge<typeG, typeT, typeD, nDim>*> tree[2];
+
+        for (std::size_t d = 0; d < 2; d++)
+        {
+            cost[d]    = Vector<typeG>(numIDs, INFINITY_VALUE);
+            settled[d] = Vector<bool>(numIDs, false);
+            tree[d]    = Vector<Edge<typeG, typeT, typeD, nDim>*>(numIDs, nullptr);
+        }
+
+        // Forward potentials are computed on demand, since most vertices are never
+        // reached by any of the searches
+        Vector<double_t> potential(numIDs, 0);
+        Vector<bool>     hasPotential(numIDs, false);
+
+        // Incoming edges, only needed by the backward search on directed graphs
+        Vector<Vector<Edge<typeG, typeT, typeD, nDim>*>> incoming;
+
+        // Auxiliar variables to make code most legible
+        Vertex<typeG, typeT, typeD, nDim>* u = nullptr;
+        Vertex<typeG, typeT, typeD, nDim>* v = nullptr;
+        Vertex<typeG, typeT, typeD, nDim>* s = &graph.GetVertex(sourceID);
+        Vertex<typeG, typeT, typeD, nDim>* t = &graph.GetVertex(targetID);
+
+        Edge<typeG, typeT, typeD, nDim>* uv = nullptr;
+
+        auto ForwardPotential = [&](Vertex<typeG, typeT, typeD, nDim>* w) -> double_t {
+            if (not hasPotential[w->GetID()])
+            {
+                potential[w->GetID()] = (heuristic(w, t) - heuristic(s, w)) / 2;
+                hasPotential[w->GetID()] = true;
+            }
+
+            return potential[w->GetID()];
+        };
+
+        if (directed)
+        {
+            for (std::size_t i = 0; i < numIDs; i++)
+                incoming.PushBack(Vector<Edge<typeG, typeT, typeD, nDim>*>());
+
+            // Pair<first, second> = <ID, Edge>
+            for (auto& pair : graph.GetEdges())
+            {
+                uv = pair.GetSecond();
+                incoming[uv->GetVertices().GetSecond()->GetID()].PushBack(uv);
+            }
+        }
+
+        // Pair<first, second> = <key, vertex>, where key = cost + potential
+        using KeyVertex = Pair<double_t, Vertex<typeG, typeT, typeD, nDim>*>;
+
+        bheap::PriorityQueue<KeyVertex,
+                             decltype(compare::Key<double_t,
+                                                   Vertex<typeG, typeT, typeD, nDim>*>)>
+            minPQueue[2];
+
+        // Since the queues are consumed lazily, the smallest valid entry of each
+        // queue is kept aside until it is expanded
+        KeyVertex front[2];
+        bool      hasFront[2] = { false, false };
+
+        cost[0][sourceID] = 0;
+        cost[1][targetID] = 0;
+
+        minPQueue[0].Enqueue(KeyVertex(ForwardPotential(s), s));
+        minPQueue[1].Enqueue(KeyVertex(-ForwardPotential(t), t));
+
+        typeG       bestCost = INFINITY_VALUE;
+        std::size_t meetID   = sourceID;
+
+        if (sourceID == targetID)
+            bestCost = 0;
+
+        while (true)
+        {
+            // Skip entries of vertices that were already settled
+            for (std::size_t d = 0; d < 2; d++)
+            {
+                while (not hasFront[d] and not minPQueue[d].IsEmpty())
+                {
+                    front[d] = minPQueue[d].Dequeue();
+
+                    if (not settled[d][front[d].GetSecond()->GetID()])
+                        hasFront[d] = true;
+                }
+            }
+
+            // Once a search runs out of vertices, no other path can be found
+            if (not(hasFront[0] and hasFront[1]))
+                break;
+
+            // The keys of both directions sum up to the real cost of a path, since
+            // pf(v) + pr(v) = 0
+            if (bestCost != INFINITY_VALUE and
+                front[0].GetFirst() + front[1].GetFirst() >=
+                    static_cast<double_t>(bestCost))
+                break;
+
+            // Expand the direction with the smallest key
+            std::size_t d = front[0].GetFirst() <= front[1].GetFirst() ? 0 : 1;
+
+            u           = front[d].GetSecond();
+            hasFront[d] = false;
+
+            settled[d][u->GetID()] = true;
+
+            if (stats)
+                stats->m_settledVertices++;
+
+            auto RelaxEdge = [&](Edge<typeG, typeT, typeD, nDim>* edge) {
+                if (stats)
+                    stats->m_relaxedEdges++;
+
+                v = GetAdjacentVertex(graph, u, edge);
+
+                if (settled[d][v->GetID()])
+                    return;
+
+                typeG newCost = cost[d][u->GetID()] + edge->GetCost();
+
+                if (newCost < cost[d][v->GetID()])
+                {
+                    cost[d][v->GetID()] = newCost;
+                    tree[d][v->GetID()] = edge;
+
+                    double_t key = d == 0 ? newCost + ForwardPotential(v)
+                                          : newCost - ForwardPotential(v);
+
+                    minPQueue[d].Enqueue(KeyVertex(key, v));
+
+                    // Check whether the other search has already reached v, which
+                    // closes a path from the source to the target
+                    if (cost[1 - d][v->GetID()] != INFINITY_VALUE and
+                        newCost + cost[1 - d][v->GetID()] < bestCost)
+                    {
+                        bestCost = newCost + cost[1 - d][v->GetID()];
+                        meetID   = v->GetID();
+                    }
+                }
+            };
+
+            if (d == 1 and directed)
+            {
+                for (std::size_t i = 0; i < incoming[u->GetID()].Size(); i++)
+                    RelaxEdge(incoming[u->GetID()][i]);
+            }
+            else
+            {
+                // Pair<first, second> = <ID, Edge>
+                for (auto& pair : u->GetAdjacencyList())
+                    RelaxEdge(pair.GetSecond());
+            }
+        }
+
+        // Write the path back into the vertices, so it can be read as in AStar
+        // Pair<first, second> = <ID, Vertex>
+        for (auto& pair : graph.GetVertices())
+        {
+            pair.GetSecond().SetCurrentCost(INFINITY_VALUE);
+            pair.GetSecond().SetEdge2Predecessor(nullptr);
+        }
+
+        if (bestCost == INFINITY_VALUE)
+            return bestCost;
+
+        // From the meeting vertex back to the source
+        u = &graph.GetVertex(meetID);
+        while (true)
+        {
+            u->SetCurrentCost(cost[0][u->GetID()]);
+            u->SetEdge2Predecessor(tree[0][u->GetID()]);
+
+            if (not tree[0][u->GetID()])
+                break;
+
+            u = GetAdjacentVertex(graph, u, tree[0][u->GetID()]);
+        }
+
+        // From the meeting vertex forward to the target
+        u = &graph.GetVertex(meetID);
+        while ((uv = tree[1][u->GetID()]))
+        {
+            v = GetAdjacentVertex(graph, u, uv);
+
+            v->SetCurrentCost(u->GetCurrentCost() + uv->GetCost());
+            v->SetEdge2Predecessor(uv);
+
+            u = v;
+        }
+
+        return bestCost;
+    }
+
+    /**
+     * @brief Bidirectional A* algorithm to find the shortest path between two
+     * vertices in a graph
+     * @param graph The graph to search
+     * @param sourceID The ID of the source vertex
+     * @param targetID The ID of the target vertex
+     * @param heuristic The heuristic function used to build the potentials of both
+     * searches. It is dispatched to its policy once, before the search starts
+     * @param stats Optional counters to be filled with the work done by the search
+     * @return The cost of the shortest path, or the maximum value of typeG if the
+     * target cannot be reached
+     */
+    template<typename typeG,
+             typename typeT,
+             typename typeD,
+             std::size_t nDim,
+             bool        directed>
+    inline typeG
+    BidirectionalAStar(Graph<typeG, typeT, typeD, nDim, directed>& graph,
+                       std::size_t                                 sourceID,
+                       std::size_t                                 targetID,
+                       heuristics::distance::Heuristic             heuristic =
+                           heuristics::distance::Heuristic::EUCLIDEAN,
+                       SearchStatistics*                           stats = nullptr)
+    {
+        return heuristics::distance::Dispatch(heuristic, [&](auto policy) {
+            return BidirectionalAStar(graph, sourceID, targetID, policy, stats);
+        });
+    }
+} // namespace graph
+
+#endif // BIDIRECTIONAL_A_STAR_H_
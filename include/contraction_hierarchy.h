@@ -0,0 +1,817 @@
+/*
+ * Filename: contraction_hierarchy.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef CONTRACTION_HIERARCHY_H_
+#define CONTRACTION_HIERARCHY_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+
+#include "vector.h"
+
+#include "frozen_graph.h"
+#include "parallel.h"
+#include "search_workspace.h"
+
+namespace graph
+{
+    namespace
+    {
+        // Maximum number of vertices settled by a witness search. When a search
+        // stops early the shortcut is added anyway, which is always correct
+        constexpr std::size_t CH_WITNESS_SETTLE_LIMIT = 1000;
+    } // namespace
+
+    /**
+     * @brief Contraction Hierarchies (Geisberger et al.) to answer point-to-point
+     * shortest path queries
+     *
+     * @tparam typeG The type for the cost of the graph's edges
+     *
+     * The preprocessing contracts the vertices one by one, from the least to the
+     * most important. Contracting v removes it from the graph and, for every pair of
+     * neighbors (u, w) whose shortest path is u -> v -> w, adds the shortcut (u, w)
+     * with the cost of that path. A local Dijkstra search (the witness search) that
+     * avoids v checks whether another path is as short, in which case no shortcut is
+     * needed. The importance of a vertex is its edge difference (shortcuts added
+     * minus arcs removed) plus the number of its neighbors already contracted.
+     *
+     * Vertices are contracted in rounds. Each round takes the vertices whose
+     * priority is smaller than the priority of all their remaining neighbors, which
+     * form an independent set, so their witness searches run in parallel. The
+     * searches ignore every vertex of the round and the shortcuts are inserted in
+     * vertex order afterwards, so the result does not depend on the number of
+     * threads.
+     *
+     * A query runs a Dijkstra search from the source over the arcs that go up in
+     * the hierarchy and another one from the target over the reversed arcs that go
+     * up. The shortcuts of the shortest path are unpacked recursively into the IDs
+     * of the edges of the original graph.
+     */
+    template<typename typeG>
+    class ContractionHierarchy
+    {
+        public:
+            // Edge ID of the arcs that are shortcuts
+            static constexpr std::size_t NO_EDGE =
+                std::numeric_limits<std::size_t>::max();
+
+        private:
+            // Shortcut (tail, head) that replaces the arcs (tail, v) and (v, head)
+            struct Shortcut
+            {
+                    std::size_t m_tail;
+                    std::size_t m_head;
+                    typeG       m_cost;
+                    std::size_t m_first;
+                    std::size_t m_second;
+            };
+
+            std::size_t m_numVertices;
+
+            // Position of each vertex in the contraction order
+            Vector<std::size_t> m_ranks;
+
+            // Arcs of the hierarchy, the arcs of the graph followed by the shortcuts.
+            // Shortcuts have no edge ID and store the two arcs they replace
+            Vector<std::size_t> m_arcTails;
+            Vector<std::size_t> m_arcHeads;
+            Vector<typeG>       m_arcCosts;
+            Vector<std::size_t> m_arcEdgeIDs;
+            Vector<std::size_t> m_arcChildren[2];
+
+            // Upward graphs of the forward (index 0) and backward (index 1) searches,
+            // stored as compressed adjacency arrays of arcs of the hierarchy
+            Vector<std::size_t> m_offsets[2];
+            Vector<std::size_t> m_heads[2];
+            Vector<typeG>       m_costs[2];
+            Vector<std::size_t> m_arcs[2];
+
+            // State of the contraction, released at the end of Build
+            Vector<Vector<std::size_t>> m_outArcs;
+            Vector<Vector<std::size_t>> m_inArcs;
+            Vector<uint8_t>             m_contracted;
+
+            // Workspaces of the queries that do not provide their own
+            SearchWorkspace<typeG> m_workspaces[2];
+
+            /**
+             * @brief Add an arc to the hierarchy and to the contraction state
+             * @return Index of the new arc
+             */
+            std::size_t AddArc(std::size_t tail,
+                               std::size_t head,
+                               typeG       cost,
+                               std::size_t edgeID,
+                               std::size_t first,
+                               std::size_t second);
+
+            /**
+             * @brief Find the shortcuts needed to contract a vertex, without changing
+             * the contraction state
+             * @param vertexID ID of the vertex to be contracted
+             * @param workspace Workspace of the witness searches
+             * @param shortcuts Receives the shortcuts
+             * @return The number of arcs between the vertex and its remaining
+             * neighbors, counting each neighbor once per direction
+             */
+            std::size_t FindShortcuts(std::size_t             vertexID,
+                                      SearchWorkspace<typeG>& workspace,
+                                      Vector<Shortcut>&       shortcuts) const;
+
+            /**
+             * @brief Build the upward graphs from the arcs of the hierarchy
+             */
+            void BuildUpwardGraphs();
+
+        public:
+            ContractionHierarchy();
+
+            /**
+             * @brief Contract all the vertices of a graph
+             * @param graph The frozen graph to be preprocessed
+             * @param numThreads Number of threads used by the witness searches. Zero
+             * means one thread per hardware thread
+             */
+            void Build(const FrozenGraph<typeG>& graph, std::size_t numThreads = 0);
+
+            /**
+             * @brief Find the shortest path between two vertices
+             * @param sourceID The ID of the source vertex
+             * @param targetID The ID of the target vertex
+             * @param forward, backward Workspaces of the two searches, so queries
+             * can run in parallel with one pair of workspaces per thread
+             * @param edgeIDs If not null, receives the IDs of the edges of the
+             * original graph along the path, from the source to the target
+             * @return The cost of the shortest path, or the maximum value of typeG if
+             * the target cannot be reached
+             */
+            typeG Query(std::size_t             sourceID,
+                        std::size_t             targetID,
+                        SearchWorkspace<typeG>& forward,
+                        SearchWorkspace<typeG>& backward,
+                        Vector<std::size_t>*    edgeIDs = nullptr) const;
+
+            /**
+             * @brief Query overload that uses the workspaces of the hierarchy, so it
+             * must not be called by several threads at once
+             */
+            typeG Query(std::size_t          sourceID,
+                        std::size_t          targetID,
+                        Vector<std::size_t>* edgeIDs = nullptr);
+
+            /**
+             * @brief Append the IDs of the original edges replaced by an arc of the
+             * hierarchy
+             * @param arc Index of the arc
+             * @param edgeIDs Receives the edge IDs, in path order
+             */
+            void Unpack(std::size_t arc, Vector<std::size_t>& edgeIDs) const;
+
+            /**
+             * @return The size of the vertex ID space of the hierarchy
+             */
+            std::size_t GetNumVertices() const;
+
+            /**
+             * @return The number of shortcuts added by the contraction
+             */
+            std::size_t GetNumShortcuts() const;
+
+            /**
+             * @return The position of the vertex in the contraction order, where
+             * higher ranks are more important
+             */
+            std::size_t GetRank(std::size_t vertexID) const;
+
+            /**
+             * @param vertexID ID of the vertex
+             * @param backward True to get the upward arcs of the backward search
+             * @return The index of the first upward arc of the vertex
+             */
+            std::size_t GetFirstArc(std::size_t vertexID, bool backward = false) const;
+
+            /**
+             * @param vertexID ID of the vertex
+             * @param backward True to get the upward arcs of the backward search
+             * @return The index after the last upward arc of the vertex
+             */
+            std::size_t GetLastArc(std::size_t vertexID, bool backward = false) const;
+
+            /**
+             * @param arc Index of the upward arc
+             * @param backward True if the index refers to the backward upward arcs
+             * @return ID of the higher ranked vertex at the other end of the arc
+             */
+            std::size_t GetHead(std::size_t arc, bool backward = false) const;
+
+            /**
+             * @param arc Index of the upward arc
+             * @param backward True if the index refers to the backward upward arcs
+             * @return Cost of the arc
+             */
+            typeG GetCost(std::size_t arc, bool backward = false) const;
+
+            /**
+             * @param arc Index of the upward arc
+             * @param backward True if the index refers to the backward upward arcs
+             * @return Index of the arc of the hierarchy, as expected by Unpack
+             */
+            std::size_t GetHierarchyArc(std::size_t arc, bool backward = false) const;
+    };
+
+    template<typename typeG>
+    ContractionHierarchy<typeG>::ContractionHierarchy()
+    {
+        this->m_numVertices = 0;
+
+        for (std::size_t side = 0; side < 2; side++)
+            this->m_offsets[side].PushBack(0);
+    }
+
+    template<typename typeG>
+    std::size_t ContractionHierarchy<typeG>::AddArc(std::size_t tail,
+                                                    std::size_t head,
+                                                    typeG       cost,
+                                                    std::size_t edgeID,
+                                                    std::size_t first,
+                                                    std::size_t second)
+    {
+        std::size_t arc = this->m_arcTails.Size();
+
+        this->m_arcTails.PushBack(tail);
+        this->m_arcHeads.PushBack(head);
+        this->m_arcCosts.PushBack(cost);
+        this->m_arcEdgeIDs.PushBack(edgeID);
+        this->m_arcChildren[0].PushBack(first);
+        this->m_arcChildren[1].PushBack(second);
+
+        this->m_outArcs[tail].PushBack(arc);
+        this->m_inArcs[head].PushBack(arc);
+
+        return arc;
+    }
+
+    template<typename typeG>
+    std::size_t
+    ContractionHierarchy<typeG>::FindShortcuts(std::size_t             vertexID,
+                                               SearchWorkspace<typeG>& workspace,
+                                               Vector<Shortcut>&       shortcuts) const
+    {
+        shortcuts.Clear();
+
+        // Cheapest arc to each remaining in-neighbor (side 0) and out-neighbor
+        // (side 1), since parallel arcs only need to be handled once
+        Vector<std::size_t> neighbors[2];
+        Vector<std::size_t> arcs[2];
+
+        const Vector<std::size_t>* lists[2] = { &this->m_inArcs[vertexID],
+                                                &this->m_outArcs[vertexID] };
+
+        for (std::size_t side = 0; side < 2; side++)
+        {
+            for (std::size_t i = 0; i < lists[side]->Size(); i++)
+            {
+                std::size_t arc = (*lists[side])[i];
+                std::size_t w =
+                    side == 0 ? this->m_arcTails[arc] : this->m_arcHeads[arc];
+
+                if (w == vertexID or this->m_contracted[w])
+                    continue;
+
+                std::size_t j = 0;
+
+                while (j < neighbors[side].Size() and neighbors[side][j] != w)
+                    j++;
+
+                if (j == neighbors[side].Size())
+                {
+                    neighbors[side].PushBack(w);
+                    arcs[side].PushBack(arc);
+                }
+                else if (this->m_arcCosts[arc] < this->m_arcCosts[arcs[side][j]])
+                {
+                    arcs[side][j] = arc;
+                }
+            }
+        }
+
+        for (std::size_t i = 0; i < neighbors[0].Size(); i++)
+        {
+            std::size_t u        = neighbors[0][i];
+            typeG       costToV  = this->m_arcCosts[arcs[0][i]];
+            typeG       maxCost  = 0;
+            bool        hasPaths = false;
+
+            for (std::size_t j = 0; j < neighbors[1].Size(); j++)
+            {
+                if (neighbors[1][j] == u)
+                    continue;
+
+                typeG viaV = costToV + this->m_arcCosts[arcs[1][j]];
+
+                if (not hasPaths or maxCost < viaV)
+                    maxCost = viaV;
+
+                hasPaths = true;
+            }
+
+            if (not hasPaths)
+                continue;
+
+            // Witness search from u that avoids the vertex being contracted
+            workspace.Reset(this->m_numVertices);
+            workspace.Update(u, 0);
+
+            std::size_t x;
+            std::size_t settled = 0;
+
+            while (workspace.PopMin(x))
+            {
+                if (maxCost < workspace.GetCost(x) or
+                    ++settled > CH_WITNESS_SETTLE_LIMIT)
+                    break;
+
+                for (std::size_t k = 0; k < this->m_outArcs[x].Size(); k++)
+                {
+                    std::size_t arc = this->m_outArcs[x][k];
+                    std::size_t y   = this->m_arcHeads[arc];
+
+                    if (y == vertexID or this->m_contracted[y])
+                        continue;
+
+                    workspace.Update(y,
+                                     workspace.GetCost(x) + this->m_arcCosts[arc],
+                                     x,
+                                     arc);
+                }
+            }
+
+            for (std::size_t j = 0; j < neighbors[1].Size(); j++)
+            {
+                std::size_t w = neighbors[1][j];
+
+                if (w == u)
+                    continue;
+
+                typeG viaV = costToV + this->m_arcCosts[arcs[1][j]];
+
+                if (workspace.IsReached(w) and workspace.GetCost(w) <= viaV)
+                    continue;
+
+                shortcuts.PushBack(Shortcut { u, w, viaV, arcs[0][i], arcs[1][j] });
+            }
+        }
+
+        return neighbors[0].Size() + neighbors[1].Size();
+    }
+
+    template<typename typeG>
+    void ContractionHierarchy<typeG>::Build(const FrozenGraph<typeG>& graph,
+                                            std::size_t               numThreads)
+    {
+        std::size_t n = graph.GetNumVertices();
+
+        this->m_numVertices = n;
+        this->m_ranks       = Vector<std::size_t>(n, 0);
+        this->m_contracted  = Vector<uint8_t>(n, 0);
+
+        this->m_arcTails.Clear();
+        this->m_arcHeads.Clear();
+        this->m_arcCosts.Clear();
+        this->m_arcEdgeIDs.Clear();
+        this->m_arcChildren[0].Clear();
+        this->m_arcChildren[1].Clear();
+        this->m_outArcs.Clear();
+        this->m_inArcs.Clear();
+
+        for (std::size_t v = 0; v < n; v++)
+        {
+            this->m_outArcs.PushBack(Vector<std::size_t>());
+            this->m_inArcs.PushBack(Vector<std::size_t>());
+        }
+
+        // Self-loops never belong to a shortest path, so they are dropped
+        for (std::size_t u = 0; u < n; u++)
+        {
+            for (std::size_t arc = graph.GetFirstArc(u); arc < graph.GetLastArc(u);
+                 arc++)
+            {
+                if (graph.GetHead(arc) != u)
+                    this->AddArc(u,
+                                 graph.GetHead(arc),
+                                 graph.GetCost(arc),
+                                 graph.GetEdgeID(arc),
+                                 NO_EDGE,
+                                 NO_EDGE);
+            }
+        }
+
+        numThreads = parallel::GetNumThreads(numThreads);
+
+        std::unique_ptr<SearchWorkspace<typeG>[]> workspaces(
+            new SearchWorkspace<typeG>[numThreads]);
+        std::unique_ptr<Vector<Shortcut>[]> buffers(new Vector<Shortcut>[numThreads]);
+
+        Vector<int64_t>     priority(n, 0);
+        Vector<std::size_t> contractedNeighbors(n, 0);
+
+        auto UpdatePriority = [&](std::size_t v, std::size_t threadIndex) {
+            std::size_t removed =
+                this->FindShortcuts(v, workspaces[threadIndex], buffers[threadIndex]);
+
+            priority[v] = static_cast<int64_t>(buffers[threadIndex].Size()) -
+                          static_cast<int64_t>(removed) +
+                          static_cast<int64_t>(contractedNeighbors[v]);
+        };
+
+        // Whether v goes before its remaining neighbors, ties broken by ID
+        auto IsLocalMinimum = [&](std::size_t v) {
+            for (std::size_t side = 0; side < 2; side++)
+            {
+                const Vector<std::size_t>& list =
+                    side == 0 ? this->m_inArcs[v] : this->m_outArcs[v];
+
+                for (std::size_t i = 0; i < list.Size(); i++)
+                {
+                    std::size_t w = side == 0 ? this->m_arcTails[list[i]]
+                                              : this->m_arcHeads[list[i]];
+
+                    if (this->m_contracted[w])
+                        continue;
+
+                    if (priority[w] < priority[v] or
+                        (priority[w] == priority[v] and w < v))
+                        return false;
+                }
+            }
+
+            return true;
+        };
+
+        Vector<std::size_t> remaining;
+        for (std::size_t v = 0; v < n; v++)
+            remaining.PushBack(v);
+
+        parallel::For(n, UpdatePriority, numThreads);
+
+        Vector<uint8_t> selected(n, 0);
+        Vector<uint8_t> outdated(n, 0);
+        std::size_t     rank = 0;
+
+        while (remaining.Size() > 0)
+        {
+            parallel::For(
+                remaining.Size(),
+                [&](std::size_t i, std::size_t) {
+                    selected[remaining[i]] = IsLocalMinimum(remaining[i]);
+                },
+                numThreads);
+
+            Vector<std::size_t> round;
+
+            for (std::size_t i = 0; i < remaining.Size(); i++)
+            {
+                if (selected[remaining[i]])
+                    round.PushBack(remaining[i]);
+            }
+
+            for (std::size_t i = 0; i < round.Size(); i++)
+            {
+                this->m_contracted[round[i]] = 1;
+                this->m_ranks[round[i]]      = rank++;
+            }
+
+            Vector<Vector<Shortcut>> found;
+            for (std::size_t i = 0; i < round.Size(); i++)
+                found.PushBack(Vector<Shortcut>());
+
+            parallel::For(
+                round.Size(),
+                [&](std::size_t i, std::size_t threadIndex) {
+                    this->FindShortcuts(round[i], workspaces[threadIndex], found[i]);
+                },
+                numThreads);
+
+            // The neighbors of the contracted vertices must update their priority
+            Vector<std::size_t> neighbors;
+
+            for (std::size_t i = 0; i < round.Size(); i++)
+            {
+                std::size_t v = round[i];
+
+                for (std::size_t side = 0; side < 2; side++)
+                {
+                    const Vector<std::size_t>& list =
+                        side == 0 ? this->m_inArcs[v] : this->m_outArcs[v];
+
+                    for (std::size_t j = 0; j < list.Size(); j++)
+                    {
+                        std::size_t w = side == 0 ? this->m_arcTails[list[j]]
+                                                  : this->m_arcHeads[list[j]];
+
+                        if (this->m_contracted[w])
+                            continue;
+
+                        contractedNeighbors[w]++;
+
+                        if (not outdated[w])
+                        {
+                            outdated[w] = 1;
+                            neighbors.PushBack(w);
+                        }
+                    }
+                }
+
+                for (std::size_t j = 0; j < found[i].Size(); j++)
+                {
+                    Shortcut& shortcut = found[i][j];
+
+                    this->AddArc(shortcut.m_tail,
+                                 shortcut.m_head,
+                                 shortcut.m_cost,
+                                 NO_EDGE,
+                                 shortcut.m_first,
+                                 shortcut.m_second);
+                }
+            }
+
+            parallel::For(
+                neighbors.Size(),
+                [&](std::size_t i, std::size_t threadIndex) {
+                    outdated[neighbors[i]] = 0;
+                    UpdatePriority(neighbors[i], threadIndex);
+                },
+                numThreads);
+
+            Vector<std::size_t> next;
+
+            for (std::size_t i = 0; i < remaining.Size(); i++)
+            {
+                if (not this->m_contracted[remaining[i]])
+                    next.PushBack(remaining[i]);
+            }
+
+            remaining = next;
+        }
+
+        this->BuildUpwardGraphs();
+
+        this->m_outArcs    = Vector<Vector<std::size_t>>();
+        this->m_inArcs     = Vector<Vector<std::size_t>>();
+        this->m_contracted = Vector<uint8_t>();
+    }
+
+    template<typename typeG>
+    void ContractionHierarchy<typeG>::BuildUpwardGraphs()
+    {
+        std::size_t n = this->m_numVertices;
+
+        // An arc (x, y) goes up in the forward search when x is contracted before
+        // y, otherwise its reverse goes up in the backward search from y
+        auto Side = [&](std::size_t arc) -> std::size_t {
+            return this->m_ranks[this->m_arcTails[arc]] <
+                           this->m_ranks[this->m_arcHeads[arc]]
+                       ? 0
+                       : 1;
+        };
+
+        auto Lower = [&](std::size_t arc, std::size_t side) {
+            return side == 0 ? this->m_arcTails[arc] : this->m_arcHeads[arc];
+        };
+
+        Vector<std::size_t> position[2];
+
+        for (std::size_t side = 0; side < 2; side++)
+            this->m_offsets[side] = Vector<std::size_t>(n + 1, 0);
+
+        for (std::size_t arc = 0; arc < this->m_arcTails.Size(); arc++)
+            this->m_offsets[Side(arc)][Lower(arc, Side(arc)) + 1]++;
+
+        for (std::size_t side = 0; side < 2; side++)
+        {
+            position[side] = Vector<std::size_t>(n, 0);
+
+            for (std::size_t v = 0; v < n; v++)
+            {
+                this->m_offsets[side][v + 1] += this->m_offsets[side][v];
+                position[side][v] = this->m_offsets[side][v];
+            }
+
+            this->m_heads[side] = Vector<std::size_t>(this->m_offsets[side][n], 0);
+            this->m_costs[side] = Vector<typeG>(this->m_offsets[side][n], typeG());
+            this->m_arcs[side]  = Vector<std::size_t>(this->m_offsets[side][n], 0);
+        }
+
+        for (std::size_t arc = 0; arc < this->m_arcTails.Size(); arc++)
+        {
+            std::size_t side = Side(arc);
+            std::size_t i    = position[side][Lower(arc, side)]++;
+
+            this->m_heads[side][i] = side == 0 ? this->m_arcHeads[arc]
+                                               : this->m_arcTails[arc];
+            this->m_costs[side][i] = this->m_arcCosts[arc];
+            this->m_arcs[side][i]  = arc;
+        }
+    }
+
+    template<typename typeG>
+    typeG ContractionHierarchy<typeG>::Query(std::size_t             sourceID,
+                                             std::size_t             targetID,
+                                             SearchWorkspace<typeG>& forward,
+                                             SearchWorkspace<typeG>& backward,
+                                             Vector<std::size_t>*    edgeIDs) const
+    {
+        // Defines the infinity value for the typeG type
+        typeG INFINITY_VALUE = std::numeric_limits<typeG>::max();
+
+        std::size_t NO_VERTEX = SearchWorkspace<typeG>::NO_VERTEX;
+
+        if (edgeIDs)
+            edgeIDs->Clear();
+
+        if (sourceID >= this->m_numVertices or targetID >= this->m_numVertices)
+            return INFINITY_VALUE;
+
+        SearchWorkspace<typeG>* workspace[2] = { &forward, &backward };
+
+        workspace[0]->Reset(this->m_numVertices);
+        workspace[1]->Reset(this->m_numVertices);
+        workspace[0]->Update(sourceID, 0);
+        workspace[1]->Update(targetID, 0);
+
+        typeG       bestCost  = INFINITY_VALUE;
+        std::size_t meetID    = NO_VERTEX;
+        bool        active[2] = { true, true };
+
+        std::size_t u;
+
+        // Both searches alternate until their next vertex costs at least as much as
+        // the best path found so far
+        while (active[0] or active[1])
+        {
+            for (std::size_t d = 0; d < 2; d++)
+            {
+                if (not active[d])
+                    continue;
+
+                if (not workspace[d]->PopMin(u) or
+                    not(workspace[d]->GetCost(u) < bestCost))
+                {
+                    active[d] = false;
+                    continue;
+                }
+
+                if (workspace[1 - d]->IsReached(u) and
+                    workspace[d]->GetCost(u) + workspace[1 - d]->GetCost(u) < bestCost)
+                {
+                    bestCost = workspace[d]->GetCost(u) + workspace[1 - d]->GetCost(u);
+                    meetID   = u;
+                }
+
+                for (std::size_t arc = this->m_offsets[d][u];
+                     arc < this->m_offsets[d][u + 1];
+                     arc++)
+                {
+                    workspace[d]->Update(this->m_heads[d][arc],
+                                         workspace[d]->GetCost(u) +
+                                             this->m_costs[d][arc],
+                                         u,
+                                         arc);
+                }
+            }
+        }
+
+        if (not edgeIDs or meetID == NO_VERTEX)
+            return bestCost;
+
+        // Arcs of the hierarchy from the source to the meeting vertex, collected
+        // backwards, followed by the arcs from the meeting vertex to the target
+        Vector<std::size_t> path;
+
+        for (std::size_t v = meetID; workspace[0]->GetPredecessor(v) != NO_VERTEX;
+             v             = workspace[0]->GetPredecessor(v))
+            path.PushBack(this->m_arcs[0][workspace[0]->GetArc(v)]);
+
+        for (std::size_t i = 0, j = path.Size(); i + 1 < j; i++, j--)
+        {
+            std::size_t swap = path[i];
+            path[i]          = path[j - 1];
+            path[j - 1]      = swap;
+        }
+
+        for (std::size_t v = meetID; workspace[1]->GetPredecessor(v) != NO_VERTEX;
+             v             = workspace[1]->GetPredecessor(v))
+            path.PushBack(this->m_arcs[1][workspace[1]->GetArc(v)]);
+
+        for (std::size_t i = 0; i < path.Size(); i++)
+            this->Unpack(path[i], *edgeIDs);
+
+        return bestCost;
+    }
+
+    template<typename typeG>
+    typeG ContractionHierarchy<typeG>::Query(std::size_t          sourceID,
+                                             std::size_t          targetID,
+                                             Vector<std::size_t>* edgeIDs)
+    {
+        return this->Query(sourceID,
+                           targetID,
+                           this->m_workspaces[0],
+                           this->m_workspaces[1],
+                           edgeIDs);
+    }
+
+    template<typename typeG>
+    void ContractionHierarchy<typeG>::Unpack(std::size_t          arc,
+                                             Vector<std::size_t>& edgeIDs) const
+    {
+        // Shortcuts may be nested deeply, so an explicit stack is used instead of
+        // recursion. The second half is pushed first to come out last
+        Vector<std::size_t> stack;
+        stack.PushBack(arc);
+
+        while (stack.Size() > 0)
+        {
+            arc = stack[stack.Size() - 1];
+            stack.PopBack();
+
+            if (this->m_arcEdgeIDs[arc] != NO_EDGE)
+            {
+                edgeIDs.PushBack(this->m_arcEdgeIDs[arc]);
+            }
+            else
+            {
+                stack.PushBack(this->m_arcChildren[1][arc]);
+                stack.PushBack(this->m_arcChildren[0][arc]);
+            }
+        }
+    }
+
+    template<typename typeG>
+    std::size_t ContractionHierarchy<typeG>::GetNumVertices() const
+    {
+        return this->m_numVertices;
+    }
+
+    template<typename typeG>
+    std::size_t ContractionHierarchy<typeG>::GetNumShortcuts() const
+    {
+        std::size_t count = 0;
+
+        for (std::size_t arc = 0; arc < this->m_arcEdgeIDs.Size(); arc++)
+        {
+            if (this->m_arcEdgeIDs[arc] == NO_EDGE)
+                count++;
+        }
+
+        return count;
+    }
+
+    template<typename typeG>
+    std::size_t ContractionHierarchy<typeG>::GetRank(std::size_t vertexID) const
+    {
+        return this->m_ranks[vertexID];
+    }
+
+    template<typename typeG>
+    std::size_t ContractionHierarchy<typeG>::GetFirstArc(std::size_t vertexID,
+                                                         bool        backward) const
+    {
+        return this->m_offsets[backward ? 1 : 0][vertexID];
+    }
+
+    template<typename typeG>
+    std::size_t ContractionHierarchy<typeG>::GetLastArc(std::size_t vertexID,
+                                                        bool        backward) const
+    {
+        return this->m_offsets[backward ? 1 : 0][vertexID + 1];
+    }
+
+    template<typename typeG>
+    std::size_t ContractionHierarchy<typeG>::GetHead(std::size_t arc,
+                                                     bool        backward) const
+    {
+        return this->m_heads[backward ? 1 : 0][arc];
+    }
+
+    template<typename typeG>
+    typeG ContractionHierarchy<typeG>::GetCost(std::size_t arc, bool backward) const
+    {
+        return this->m_costs[backward ? 1 : 0][arc];
+    }
+
+    template<typename typeG>
+    std::size_t ContractionHierarchy<typeG>::GetHierarchyArc(std::size_t arc,
+                                                             bool backward) const
+    {
+        return this->m_arcs[backward ? 1 : 0][arc];
+    }
+} // namespace graph
+
+#endif // CONTRACTION_HIERARCHY_H_
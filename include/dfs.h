@@ -9,65 +9,225 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 
+#include "vector.h"
+
+#include "frozen_graph.h"
 #include "graph.h"
 #include "graph_utils.h"
+#include "vertex.h"
 
 namespace graph
 {
+    /**
+     * @brief Result of a Depth-First Search on a frozen graph, as dense arrays
+     * indexed by vertex ID, plus the stack reused by the traversals
+     *
+     * The discovery and finish times share a single counter that starts at 0 and
+     * is advanced by every event, so the intervals [discovery, finish] of two
+     * vertices are either disjoint or nested (parenthesis theorem). A forest can be
+     * reused across traversals: the arrays are only reallocated when the size of
+     * the graph changes.
+     */
+    struct DFSForest
+    {
+            // Marks a vertex that was not visited
+            static constexpr uint32_t NO_TIME = std::numeric_limits<uint32_t>::max();
+
+            // Marks a missing parent vertex or arc, for the roots of the trees
+            static constexpr std::size_t NO_VERTEX =
+                std::numeric_limits<std::size_t>::max();
+            static constexpr std::size_t NO_ARC =
+                std::numeric_limits<std::size_t>::max();
+
+            struct Frame
+            {
+                    std::size_t m_vertexID;
+
+                    // Next arc of the vertex to be followed
+                    std::size_t m_arc;
+            };
+
+            // Time at which each vertex was discovered and finished, or NO_TIME
+            Vector<uint32_t> m_discovery;
+            Vector<uint32_t> m_finish;
+
+            // Vertex and arc from which each vertex was discovered
+            Vector<std::size_t> m_parents;
+            Vector<std::size_t> m_parentArcs;
+
+            // Root of each tree, in the order the trees were grown
+            Vector<std::size_t> m_roots;
+
+            // Vertices in the order they were finished. Reversed, it is a
+            // topological order of a directed acyclic graph
+            Vector<std::size_t> m_finishOrder;
+
+            // Stack of adjacency cursors, one per vertex of the current path
+            Vector<Frame> m_stack;
+
+            /**
+             * @brief Mark all vertices as not visited
+             * @param numVertices Size of the vertex ID space of the graph
+             */
+            void Reset(std::size_t numVertices)
+            {
+                if (this->m_discovery.Size() != numVertices)
+                {
+                    this->m_discovery  = Vector<uint32_t>(numVertices, NO_TIME);
+                    this->m_finish     = Vector<uint32_t>(numVertices, NO_TIME);
+                    this->m_parents    = Vector<std::size_t>(numVertices, NO_VERTEX);
+                    this->m_parentArcs = Vector<std::size_t>(numVertices, NO_ARC);
+                }
+                else
+                {
+                    for (std::size_t v = 0; v < numVertices; v++)
+                    {
+                        this->m_discovery[v]  = NO_TIME;
+                        this->m_finish[v]     = NO_TIME;
+                        this->m_parents[v]    = NO_VERTEX;
+                        this->m_parentArcs[v] = NO_ARC;
+                    }
+                }
+
+                this->m_roots.Clear();
+                this->m_finishOrder.Clear();
+                this->m_stack.Clear();
+            }
+
+            /**
+             * @return True if the vertex was visited by the last traversal
+             */
+            bool IsVisited(std::size_t vertexID) const
+            {
+                return this->m_discovery[vertexID] != NO_TIME;
+            }
+    };
+
     namespace
     {
         /**
-         * @brief Recursive function that performs the Depth-First Search (DFS)
-         * traversal
-         * @param graph The graph to be traversed
-         * @param sourceID The ID of the source node
-         * @param timestamp The time of entering sourceID vertex
+         * @brief Grow a depth-first tree from a root that was not visited
+         * @param graph The frozen graph to be traversed
+         * @param rootID The ID of the root of the tree
+         * @param forest Receives the times and parents of the tree
+         * @param timestamp The next time, advanced by the traversal
+         * @param backward True to follow the reversed arcs of a directed graph
+         *
+         * Each frame of the stack holds a vertex and its next arc, so a vertex
+         * resumes the scan of its arcs where it stopped when its child finishes,
+         * as the recursive version does, without using the call stack.
          */
-        template<typename typeG,
-                 typename typeT,
-                 typename typeD,
-                 std::size_t nDim,
-                 bool        directed>
-        inline void DFS(Graph<typeG, typeT, typeD, nDim, directed>& graph,
-                        std::size_t                                 currentVertexID,
-                        uint32_t&                                   timestamp)
+        template<typename typeG>
+        inline void DFSVisit(const FrozenGraph<typeG>& graph,
+                             std::size_t               rootID,
+                             DFSForest&                forest,
+                             uint32_t&                 timestamp,
+                             bool                      backward)
         {
-            // Auxiliar variables to make code most legible
-            Vertex<typeG, typeT, typeD, nDim>* u = nullptr;
-            Vertex<typeG, typeT, typeD, nDim>* v = nullptr;
-
-            Edge<typeG, typeT, typeD, nDim>* uv;
+            Vector<DFSForest::Frame>& stack = forest.m_stack;
 
-            u = &graph.GetVertex(currentVertexID);
+            forest.m_roots.PushBack(rootID);
+            forest.m_discovery[rootID] = timestamp++;
 
-            u->SetArrivalTime(++timestamp);
-            u->SetLabel(VertexLabel::VISITED);
+            stack.PushBack(
+                DFSForest::Frame{ rootID, graph.GetFirstArc(rootID, backward) });
 
-
-            for (auto& pair : u->GetAdjacencyList())
+            while (stack.Size() > 0)
             {
-                // Edge uv (or vu, if is non-directed)
-                uv = pair.GetSecond();
+                DFSForest::Frame& top = stack[stack.Size() - 1];
 
-                v = GetAdjacentVertex(graph, u, uv);
+                std::size_t u = top.m_vertexID;
 
-                if (v->GetLabel() == VertexLabel::UNVISITED)
+                if (top.m_arc == graph.GetLastArc(u, backward))
                 {
-                    DFS(graph, v->GetID(), timestamp);
+                    forest.m_finish[u] = timestamp++;
+                    forest.m_finishOrder.PushBack(u);
+                    stack.PopBack();
+                    continue;
                 }
-            }
 
-            u->SetDepartureTime(++timestamp);
+                std::size_t arc = top.m_arc++;
+                std::size_t v   = graph.GetHead(arc, backward);
+
+                if (forest.m_discovery[v] != DFSForest::NO_TIME)
+                    continue;
+
+                forest.m_discovery[v]  = timestamp++;
+                forest.m_parents[v]    = u;
+                forest.m_parentArcs[v] = arc;
+
+                // top is not used after this point, since it may be moved
+                stack.PushBack(DFSForest::Frame{ v, graph.GetFirstArc(v, backward) });
+            }
         }
     } // namespace
 
+    /**
+     * @brief Perform a Depth-First Search (DFS) traversal on a frozen graph starting
+     * from a given source vertex
+     * @param graph The frozen graph to be traversed
+     * @param sourceID The ID of the source vertex
+     * @param forest Receives a single tree with the vertices reached from the source
+     * @param backward True to follow the reversed arcs of a directed graph
+     *
+     * Complexity: O(V + E), when V is the number of vertices and E is the number of
+     * edges in the graph
+     */
+    template<typename typeG>
+    inline void DFS(const FrozenGraph<typeG>& graph,
+                    std::size_t               sourceID,
+                    DFSForest&                forest,
+                    bool                      backward = false)
+    {
+        forest.Reset(graph.GetNumVertices());
+
+        if (sourceID >= graph.GetNumVertices())
+            return;
+
+        uint32_t timestamp = 0;
+
+        DFSVisit(graph, sourceID, forest, timestamp, backward);
+    }
+
+    /**
+     * @brief Perform a Depth-First Search (DFS) traversal of a whole frozen graph,
+     * growing a tree from each vertex not yet visited, in ID order
+     * @param graph The frozen graph to be traversed
+     * @param forest Receives the trees, whose times continue from one tree to the
+     * next
+     * @param backward True to follow the reversed arcs of a directed graph
+     *
+     * Complexity: O(V + E), when V is the number of vertices and E is the number of
+     * edges in the graph
+     */
+    template<typename typeG>
+    inline void DFS(const FrozenGraph<typeG>& graph,
+                    DFSForest&                forest,
+                    bool                      backward = false)
+    {
+        forest.Reset(graph.GetNumVertices());
+
+        uint32_t timestamp = 0;
+
+        for (std::size_t v = 0; v < graph.GetNumVertices(); v++)
+            if (forest.m_discovery[v] == DFSForest::NO_TIME)
+                DFSVisit(graph, v, forest, timestamp, backward);
+    }
+
     /**
      * @brief Perform a Depth-First Search (DFS) traversal on a graph starting from
      * a given source node
      * @param graph The graph to be traversed
      * @param sourceID The ID of the source node
      *
+     * The graph is frozen and traversed by the FrozenGraph overload, which follows
+     * the adjacency lists in the same order. The vertices reached store their
+     * arrival and departure times and are labeled VISITED. They also store the edge
+     * to their parent and the cost of their path in the depth-first tree, so GetPath
+     * works as usual.
+     *
      * Complexity: O(V + E), when V is the number of vertices and E is the number of
      * edges in the graph
      */
@@ -79,39 +239,50 @@ namespace graph
     inline void DFS(Graph<typeG, typeT, typeD, nDim, directed>& graph,
                     std::size_t                                 sourceID)
     {
-        for (auto& pair : graph.GetVertices())
-        {
-            pair.GetSecond().SetLabel(VertexLabel::UNVISITED);
-        }
-
-        // Auxiliar variables to make code most legible
-        Vertex<typeG, typeT, typeD, nDim>* u = nullptr;
-        Vertex<typeG, typeT, typeD, nDim>* v = nullptr;
+        FrozenGraph<typeG> frozen(graph);
+        DFSForest          forest;
 
-        Edge<typeG, typeT, typeD, nDim>* uv = nullptr;
+        DFS(frozen, sourceID, forest);
 
-        uint32_t timestamp = 0;
+        // Pair<first, second> = <ID, Vertex>
+        for (auto& pair : graph.GetVertices())
+        {
+            pair.GetSecond().SetCurrentCost(std::numeric_limits<typeG>::max());
+            pair.GetSecond().SetEdge2Predecessor(nullptr);
 
-        u = &graph.GetVertex(sourceID);
+            if (not forest.IsVisited(pair.GetFirst()))
+            {
+                pair.GetSecond().SetLabel(VertexLabel::UNVISITED);
+                continue;
+            }
 
-        u->SetArrivalTime(timestamp);
-        u->SetLabel(VertexLabel::VISITED);
+            pair.GetSecond().SetLabel(VertexLabel::VISITED);
+            pair.GetSecond().SetArrivalTime(forest.m_discovery[pair.GetFirst()]);
+            pair.GetSecond().SetDepartureTime(forest.m_finish[pair.GetFirst()]);
+        }
 
-        for (auto& pair : u->GetAdjacencyList())
+        // A vertex finishes after all its descendants, so the reversed finish order
+        // reaches each parent before its children
+        for (std::size_t i = forest.m_finishOrder.Size(); i-- > 0;)
         {
-            // Edge uv (or vu, if is non-directed)
-            uv = pair.GetSecond();
+            std::size_t v      = forest.m_finishOrder[i];
+            std::size_t parent = forest.m_parents[v];
 
-            v = GetAdjacentVertex(graph, u, uv);
+            Vertex<typeG, typeT, typeD, nDim>& vertex = graph.GetVertex(v);
 
-            if (v->GetLabel() == VertexLabel::UNVISITED)
+            if (parent == DFSForest::NO_VERTEX)
             {
-                DFS(graph, v->GetID(), timestamp);
+                vertex.SetCurrentCost(0);
+                continue;
             }
-        }
 
-        u->SetDepartureTime(++timestamp);
-    }
+            std::size_t arc = forest.m_parentArcs[v];
 
+            vertex.SetCurrentCost(graph.GetVertex(parent).GetCurrentCost() +
+                                  frozen.GetCost(arc));
+            vertex.SetEdge2Predecessor(graph.GetEdges().Get(frozen.GetEdgeID(arc)));
+        }
+    }
 } // namespace graph
+
 #endif // DFS_H_
@@ -10,9 +10,12 @@
 #include <limits>
 
 #include "edge.h"
+#include "frozen_graph.h"
 #include "graph.h"
 #include "graph_utils.h"
 #include "priority_queue_bheap.h"
+#include "search_workspace.h"
+#include "vector.h"
 #include "vertex.h"
 
 namespace graph
@@ -81,6 +84,201 @@ namespace graph
         }
     }
 
+    /**
+     * @brief Run Dijkstra's algorithm on a frozen graph, keeping the shortest path
+     *        tree in a workspace instead of in the vertices
+     * @param graph The frozen graph on which to calculate the shortest paths
+     * @param sourceID The source vertex id from which to calculate the shortest
+     *        paths
+     * @param workspace The workspace that receives the costs and predecessors
+     * @param backward True to follow the arcs in the opposite direction, which
+     *        calculates the shortest paths from all vertices to sourceID
+     **/
+    template<typename typeG>
+    inline void Dijkstra(const FrozenGraph<typeG>& graph,
+                         std::size_t               sourceID,
+                         SearchWorkspace<typeG>&   workspace,
+                         bool                      backward = false)
+    {
+        workspace.Reset(graph.GetNumVertices());
+        workspace.Update(sourceID, 0);
+
+        std::size_t u;
+
+        while (workspace.PopMin(u))
+        {
+            for (std::size_t arc = graph.GetFirstArc(u, backward);
+                 arc < graph.GetLastArc(u, backward);
+                 arc++)
+            {
+                workspace.Update(graph.GetHead(arc, backward),
+                                 workspace.GetCost(u) + graph.GetCost(arc, backward),
+                                 u,
+                                 arc);
+            }
+        }
+    }
+
+    /**
+     * @brief Run Dijkstra's algorithm only up to a given cost
+     * @param graph The frozen graph on which to calculate the shortest paths
+     * @param sourceID The source vertex id from which to calculate the shortest
+     *        paths
+     * @param radius Largest cost to be settled
+     * @param workspace The workspace that receives the costs and predecessors
+     * @param backward True to follow the arcs in the opposite direction
+     *
+     * The search stops as soon as the smallest cost in the queue exceeds the radius,
+     * so its work depends on the size of the answer and not on the size of the
+     * graph. The vertices within the radius are workspace.GetSettledOrder(), sorted
+     * by cost.
+     **/
+    template<typename typeG>
+    inline void DijkstraWithinRadius(const FrozenGraph<typeG>& graph,
+                                     std::size_t               sourceID,
+                                     typeG                     radius,
+                                     SearchWorkspace<typeG>&   workspace,
+                                     bool                      backward = false)
+    {
+        workspace.Reset(graph.GetNumVertices());
+        workspace.Update(sourceID, 0);
+
+        std::size_t u;
+
+        while (workspace.PopMin(u, radius))
+        {
+            for (std::size_t arc = graph.GetFirstArc(u, backward);
+                 arc < graph.GetLastArc(u, backward);
+                 arc++)
+            {
+                workspace.Update(graph.GetHead(arc, backward),
+                                 workspace.GetCost(u) + graph.GetCost(arc, backward),
+                                 u,
+                                 arc);
+            }
+        }
+    }
+
+    /**
+     * @brief Run Dijkstra's algorithm until a given number of target vertices is
+     *        settled
+     * @param graph The frozen graph on which to calculate the shortest paths
+     * @param sourceID The source vertex id from which to calculate the shortest
+     *        paths
+     * @param isTarget Flags, indexed by vertex ID, of the vertices that count as
+     *        targets (e.g., points of interest)
+     * @param numTargets Number of targets to be found
+     * @param targets Receives the IDs of the nearest targets, sorted by cost. It
+     *        has fewer than numTargets entries if fewer targets are reachable
+     * @param workspace The workspace that receives the costs and predecessors
+     * @param backward True to follow the arcs in the opposite direction
+     *
+     * The search stops when the last target is settled, so only the vertices
+     * closer than it are visited. Their costs and paths are kept in the workspace.
+     **/
+    template<typename typeG>
+    inline void DijkstraNearestTargets(const FrozenGraph<typeG>& graph,
+                                       std::size_t               sourceID,
+                                       const Vector<bool>&       isTarget,
+                                       std::size_t               numTargets,
+                                       Vector<std::size_t>&      targets,
+                                       SearchWorkspace<typeG>&   workspace,
+                                       bool                      backward = false)
+    {
+        targets.Clear();
+
+        workspace.Reset(graph.GetNumVertices());
+        workspace.Update(sourceID, 0);
+
+        std::size_t u;
+
+        while (targets.Size() < numTargets and workspace.PopMin(u))
+        {
+            if (isTarget[u])
+            {
+                targets.PushBack(u);
+
+                if (targets.Size() == numTargets)
+                    break;
+            }
+
+            for (std::size_t arc = graph.GetFirstArc(u, backward);
+                 arc < graph.GetLastArc(u, backward);
+                 arc++)
+            {
+                workspace.Update(graph.GetHead(arc, backward),
+                                 workspace.GetCost(u) + graph.GetCost(arc, backward),
+                                 u,
+                                 arc);
+            }
+        }
+    }
+
+    /**
+     * @brief Run Dijkstra's algorithm from several sources at once, which splits the
+     *        graph into the regions closest to each source (graph Voronoi diagram)
+     * @param graph The frozen graph on which to calculate the shortest paths
+     * @param sources IDs of the source vertices (e.g., facilities)
+     * @param nearestSource Receives, for each vertex ID, the index in sources of
+     *        the nearest source, or NO_VERTEX if no source reaches the vertex
+     * @param costs Receives, for each vertex ID, the cost from the nearest source,
+     *        or the maximum value of typeG if no source reaches the vertex
+     * @param workspace The workspace used by the search
+     * @param backward True to follow the arcs in the opposite direction, which
+     *        calculates the cost from each vertex to its nearest source
+     *
+     * All sources start with cost zero in the same queue, so the whole partition is
+     * built by a single search. Each vertex inherits the source of its predecessor
+     * when it is settled. Ties between sources are broken by the queue order.
+     **/
+    template<typename typeG>
+    inline void MultiSourceDijkstra(const FrozenGraph<typeG>&  graph,
+                                    const Vector<std::size_t>& sources,
+                                    Vector<std::size_t>&       nearestSource,
+                                    Vector<typeG>&             costs,
+                                    SearchWorkspace<typeG>&    workspace,
+                                    bool                       backward = false)
+    {
+        std::size_t NO_VERTEX = SearchWorkspace<typeG>::NO_VERTEX;
+
+        nearestSource = Vector<std::size_t>(graph.GetNumVertices(), NO_VERTEX);
+        costs         = Vector<typeG>(graph.GetNumVertices(),
+                              std::numeric_limits<typeG>::max());
+
+        workspace.Reset(graph.GetNumVertices());
+
+        // A vertex listed twice keeps its first index
+        for (std::size_t i = 0; i < sources.Size(); i++)
+        {
+            if (sources[i] < graph.GetNumVertices() and
+                nearestSource[sources[i]] == NO_VERTEX)
+            {
+                nearestSource[sources[i]] = i;
+                workspace.Update(sources[i], 0);
+            }
+        }
+
+        std::size_t u;
+
+        while (workspace.PopMin(u))
+        {
+            if (workspace.GetPredecessor(u) != NO_VERTEX)
+                nearestSource[u] = nearestSource[workspace.GetPredecessor(u)];
+
+            costs[u] = workspace.GetCost(u);
+
+            for (std::size_t arc = graph.GetFirstArc(u, backward);
+                 arc < graph.GetLastArc(u, backward);
+                 arc++)
+            {
+                workspace.Update(graph.GetHead(arc, backward),
+                                 workspace.GetCost(u) + graph.GetCost(arc, backward),
+                                 u,
+                                 arc);
+            }
+        }
+    }
+
 } // namespace graph
 
 #endif // DIJKSTRA_H_
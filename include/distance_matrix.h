@@ -0,0 +1,265 @@
+/*
+ * Filename: distance_matrix.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef DISTANCE_MATRIX_H_
+#define DISTANCE_MATRIX_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+
+#include "vector.h"
+
+#include "contraction_hierarchy.h"
+#include "frozen_graph.h"
+#include "parallel.h"
+#include "search_workspace.h"
+
+namespace graph
+{
+    /**
+     * @brief Compute the costs of the shortest paths from a set of sources to a set
+     * of targets
+     * @param graph The frozen graph to search
+     * @param sources IDs of the source vertices
+     * @param targets IDs of the target vertices
+     * @param matrix Receives the costs in row-major order, so the cost from
+     * sources[i] to targets[j] is matrix[i * targets.Size() + j]. Unreachable
+     * targets have the maximum value of typeG
+     * @param numThreads Number of threads to be used. Zero means one thread per
+     * hardware thread
+     *
+     * One Dijkstra search runs per source, spread among the threads, each thread with
+     * its own workspace so no search resets the whole graph. A search stops as soon
+     * as all the targets are settled.
+     */
+    template<typename typeG>
+    inline void DistanceMatrix(const FrozenGraph<typeG>&  graph,
+                               const Vector<std::size_t>& sources,
+                               const Vector<std::size_t>& targets,
+                               Vector<typeG>&             matrix,
+                               std::size_t                numThreads = 0)
+    {
+        std::size_t numTargets = targets.Size();
+
+        matrix = Vector<typeG>(sources.Size() * numTargets,
+                               std::numeric_limits<typeG>::max());
+
+        // Targets may repeat, so the searches count the distinct ones
+        Vector<uint8_t> isTarget(graph.GetNumVertices(), 0);
+        std::size_t     numDistinct = 0;
+
+        for (std::size_t j = 0; j < numTargets; j++)
+        {
+            if (targets[j] < graph.GetNumVertices() and not isTarget[targets[j]])
+            {
+                isTarget[targets[j]] = 1;
+                numDistinct++;
+            }
+        }
+
+        numThreads = parallel::GetNumThreads(numThreads);
+
+        std::unique_ptr<SearchWorkspace<typeG>[]> workspaces(
+            new SearchWorkspace<typeG>[numThreads]);
+
+        parallel::For(
+            sources.Size(),
+            [&](std::size_t i, std::size_t threadIndex) {
+                SearchWorkspace<typeG>& workspace = workspaces[threadIndex];
+
+                if (sources[i] >= graph.GetNumVertices())
+                    return;
+
+                workspace.Reset(graph.GetNumVertices());
+                workspace.Update(sources[i], 0);
+
+                std::size_t u;
+                std::size_t settledTargets = 0;
+
+                while (settledTargets < numDistinct and workspace.PopMin(u))
+                {
+                    if (isTarget[u])
+                        settledTargets++;
+
+                    for (std::size_t arc = graph.GetFirstArc(u);
+                         arc < graph.GetLastArc(u);
+                         arc++)
+                    {
+                        workspace.Update(graph.GetHead(arc),
+                                         workspace.GetCost(u) + graph.GetCost(arc),
+                                         u,
+                                         arc);
+                    }
+                }
+
+                for (std::size_t j = 0; j < numTargets; j++)
+                {
+                    if (targets[j] < graph.GetNumVertices() and
+                        workspace.IsSettled(targets[j]))
+                        matrix[i * numTargets + j] = workspace.GetCost(targets[j]);
+                }
+            },
+            numThreads);
+    }
+
+    /**
+     * @brief DistanceMatrix overload that uses the buckets of a contraction
+     * hierarchy
+     * @param hierarchy The contraction hierarchy of the graph
+     * @param sources IDs of the source vertices
+     * @param targets IDs of the target vertices
+     * @param matrix Receives the costs in row-major order, so the cost from
+     * sources[i] to targets[j] is matrix[i * targets.Size() + j]. Unreachable
+     * targets have the maximum value of typeG
+     * @param numThreads Number of threads to be used. Zero means one thread per
+     * hardware thread
+     *
+     * A backward upward search runs from every target and leaves an entry
+     * (target, cost) in the bucket of each vertex it reaches. Then a forward upward
+     * search runs from every source and, for each vertex it reaches, combines its
+     * cost with the entries of the bucket of the vertex. Since every shortest path
+     * goes up and then down in the hierarchy, the smallest combination is the cost
+     * of the shortest path. Both phases run one search per thread at a time, and
+     * each forward search only writes its own row of the matrix.
+     */
+    template<typename typeG>
+    inline void DistanceMatrix(const ContractionHierarchy<typeG>& hierarchy,
+                               const Vector<std::size_t>&         sources,
+                               const Vector<std::size_t>&         targets,
+                               Vector<typeG>&                     matrix,
+                               std::size_t                        numThreads = 0)
+    {
+        std::size_t n          = hierarchy.GetNumVertices();
+        std::size_t numTargets = targets.Size();
+
+        matrix = Vector<typeG>(sources.Size() * numTargets,
+                               std::numeric_limits<typeG>::max());
+
+        if (numTargets == 0)
+            return;
+
+        numThreads = parallel::GetNumThreads(numThreads);
+
+        std::unique_ptr<SearchWorkspace<typeG>[]> workspaces(
+            new SearchWorkspace<typeG>[numThreads]);
+
+        // Exhaustive upward search, returns the reached vertices in the workspace
+        auto UpwardSearch = [&](std::size_t             sourceID,
+                                bool                    backward,
+                                SearchWorkspace<typeG>& workspace) {
+            workspace.Reset(n);
+            workspace.Update(sourceID, 0);
+
+            std::size_t u;
+
+            while (workspace.PopMin(u))
+            {
+                for (std::size_t arc = hierarchy.GetFirstArc(u, backward);
+                     arc < hierarchy.GetLastArc(u, backward);
+                     arc++)
+                {
+                    workspace.Update(hierarchy.GetHead(arc, backward),
+                                     workspace.GetCost(u) +
+                                         hierarchy.GetCost(arc, backward),
+                                     u,
+                                     arc);
+                }
+            }
+        };
+
+        // Backward search spaces of the targets
+        Vector<Vector<std::size_t>> reached;
+        Vector<Vector<typeG>>       reachedCosts;
+
+        for (std::size_t j = 0; j < numTargets; j++)
+        {
+            reached.PushBack(Vector<std::size_t>());
+            reachedCosts.PushBack(Vector<typeG>());
+        }
+
+        parallel::For(
+            numTargets,
+            [&](std::size_t j, std::size_t threadIndex) {
+                SearchWorkspace<typeG>& workspace = workspaces[threadIndex];
+
+                if (targets[j] >= n)
+                    return;
+
+                UpwardSearch(targets[j], true, workspace);
+
+                const Vector<std::size_t>& settled = workspace.GetSettledOrder();
+
+                for (std::size_t k = 0; k < settled.Size(); k++)
+                {
+                    reached[j].PushBack(settled[k]);
+                    reachedCosts[j].PushBack(workspace.GetCost(settled[k]));
+                }
+            },
+            numThreads);
+
+        // Buckets stored as compressed arrays indexed by vertex, each bucket sorted
+        // by target index
+        Vector<std::size_t> offsets(n + 1, 0);
+
+        for (std::size_t j = 0; j < numTargets; j++)
+            for (std::size_t k = 0; k < reached[j].Size(); k++)
+                offsets[reached[j][k] + 1]++;
+
+        for (std::size_t v = 0; v < n; v++)
+            offsets[v + 1] += offsets[v];
+
+        Vector<std::size_t> position(n, 0);
+        for (std::size_t v = 0; v < n; v++)
+            position[v] = offsets[v];
+
+        Vector<std::size_t> bucketTargets(offsets[n], 0);
+        Vector<typeG>       bucketCosts(offsets[n], typeG());
+
+        for (std::size_t j = 0; j < numTargets; j++)
+        {
+            for (std::size_t k = 0; k < reached[j].Size(); k++)
+            {
+                std::size_t entry = position[reached[j][k]]++;
+
+                bucketTargets[entry] = j;
+                bucketCosts[entry]   = reachedCosts[j][k];
+            }
+        }
+
+        parallel::For(
+            sources.Size(),
+            [&](std::size_t i, std::size_t threadIndex) {
+                SearchWorkspace<typeG>& workspace = workspaces[threadIndex];
+
+                if (sources[i] >= n)
+                    return;
+
+                UpwardSearch(sources[i], false, workspace);
+
+                typeG* row = &matrix[i * numTargets];
+
+                const Vector<std::size_t>& settled = workspace.GetSettledOrder();
+
+                for (std::size_t k = 0; k < settled.Size(); k++)
+                {
+                    std::size_t v    = settled[k];
+                    typeG       cost = workspace.GetCost(v);
+
+                    for (std::size_t entry = offsets[v]; entry < offsets[v + 1];
+                         entry++)
+                    {
+                        if (cost + bucketCosts[entry] < row[bucketTargets[entry]])
+                            row[bucketTargets[entry]] = cost + bucketCosts[entry];
+                    }
+                }
+            },
+            numThreads);
+    }
+} // namespace graph
+
+#endif // DISTANCE_MATRIX_H_
@@ -0,0 +1,337 @@
+/*
+ * Filename: distance_table.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef DISTANCE_TABLE_H_
+#define DISTANCE_TABLE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "vector.h"
+
+namespace graph
+{
+    namespace
+    {
+        // Identifies the files written by DistanceTable::Create
+        constexpr uint64_t DISTANCE_TABLE_FILE_MAGIC = 0x31425444; // "DTB1"
+
+        // Header: magic, size of the cost type and number of vertices
+        constexpr std::size_t DISTANCE_TABLE_HEADER_SIZE = 3 * sizeof(uint64_t);
+
+        /**
+         * @brief Check that a file with the header and numVertices x numVertices
+         * costs has a size that std::size_t can hold
+         * @param numVertices Size of the vertex ID space
+         *
+         * The bound is checked by division, so a corrupt header cannot overflow it
+         */
+        template<typename typeG>
+        inline bool TableFits(uint64_t numVertices)
+        {
+            return numVertices == 0 or
+                   numVertices <= (std::numeric_limits<std::size_t>::max() -
+                                   DISTANCE_TABLE_HEADER_SIZE) /
+                                      sizeof(typeG) / numVertices;
+        }
+    } // namespace
+
+    /**
+     * @brief Dense table with the cost of the shortest path between every pair of
+     * vertices, as filled by the all-pairs algorithms
+     *
+     * @tparam typeG The type for the cost of the graph's edges
+     *
+     * The costs are stored in row-major order, one row per source vertex, either in
+     * memory or in a file mapped into memory. A table backed by a file can be larger
+     * than the RAM, since the operating system writes the rows back to the file as
+     * they are filled. Unreachable pairs hold the maximum value of typeG.
+     */
+    template<typename typeG>
+    class DistanceTable
+    {
+        private:
+            std::size_t m_numVertices;
+
+            // Owned costs, used when the table is not backed by a file
+            Vector<typeG> m_owned;
+
+            // Costs read and written by the methods, owned or mapped
+            typeG* m_costs;
+
+            // Mapped file, if any
+            void*       m_mapping;
+            std::size_t m_mappingSize;
+            bool        m_writable;
+
+            /**
+             * @brief Release the mapped file, if any
+             */
+            void Unmap();
+
+            /**
+             * @brief Map a table file
+             * @param file Descriptor of the open file
+             * @param size Size of the file in bytes
+             * @param writable True to map the file for reading and writing
+             * @return True if the file was mapped
+             */
+            bool MapFile(int file, std::size_t size, bool writable);
+
+        public:
+            DistanceTable();
+            ~DistanceTable();
+
+            DistanceTable(const DistanceTable&)            = delete;
+            DistanceTable& operator=(const DistanceTable&) = delete;
+
+            /**
+             * @brief Size the table in memory, with all the pairs unreachable
+             * @param numVertices Size of the vertex ID space
+             */
+            void Allocate(std::size_t numVertices);
+
+            /**
+             * @brief Size the table in a file, which is created or truncated, and map
+             * it for reading and writing. All the pairs are unreachable
+             * @param path Path of the file
+             * @param numVertices Size of the vertex ID space
+             * @return True if the file was created and mapped, false otherwise, also
+             * when the size of the table does not fit in std::size_t
+             */
+            bool Create(const std::string& path, std::size_t numVertices);
+
+            /**
+             * @brief Map a file written through Create for reading only
+             * @param path Path of the file
+             * @return True if the file was mapped, false if it could not be opened,
+             * was created for another cost type or does not have the size given by
+             * its header
+             */
+            bool Map(const std::string& path);
+
+            /**
+             * @return The size of the vertex ID space covered by the table
+             */
+            std::size_t GetNumVertices() const;
+
+            /**
+             * @return True if the rows can be written, false for tables mapped by Map
+             */
+            bool IsWritable() const;
+
+            /**
+             * @return True if the table is backed by a file, through Create or Map
+             */
+            bool IsMapped() const;
+
+            /**
+             * @param sourceID ID of the source vertex
+             * @param targetID ID of the target vertex
+             * @return The cost of the shortest path from source to target
+             */
+            typeG Get(std::size_t sourceID, std::size_t targetID) const;
+
+            /**
+             * @param sourceID ID of the source vertex
+             * @return Pointer to the costs from the source to every vertex
+             */
+            const typeG* GetRow(std::size_t sourceID) const;
+
+            /**
+             * @param sourceID ID of the source vertex
+             * @return Pointer to the costs from the source to every vertex, to be
+             * written. Only valid if the table is writable
+             */
+            typeG* GetRow(std::size_t sourceID);
+    };
+
+    template<typename typeG>
+    DistanceTable<typeG>::DistanceTable()
+    {
+        this->m_numVertices = 0;
+        this->m_costs       = nullptr;
+        this->m_mapping     = nullptr;
+        this->m_mappingSize = 0;
+        this->m_writable    = true;
+    }
+
+    template<typename typeG>
+    DistanceTable<typeG>::~DistanceTable()
+    {
+        this->Unmap();
+    }
+
+    template<typename typeG>
+    void DistanceTable<typeG>::Unmap()
+    {
+        if (this->m_mapping)
+            munmap(this->m_mapping, this->m_mappingSize);
+
+        this->m_mapping     = nullptr;
+        this->m_mappingSize = 0;
+        this->m_writable    = true;
+    }
+
+    template<typename typeG>
+    bool DistanceTable<typeG>::MapFile(int file, std::size_t size, bool writable)
+    {
+        void* mapping = mmap(nullptr,
+                             size,
+                             writable ? PROT_READ | PROT_WRITE : PROT_READ,
+                             MAP_SHARED,
+                             file,
+                             0);
+
+        if (mapping == MAP_FAILED)
+            return false;
+
+        this->Unmap();
+
+        // The table built in memory is no longer needed
+        this->m_owned = Vector<typeG>();
+
+        this->m_mapping     = mapping;
+        this->m_mappingSize = size;
+        this->m_writable    = writable;
+        this->m_costs       = reinterpret_cast<typeG*>(static_cast<char*>(mapping) +
+                                                 DISTANCE_TABLE_HEADER_SIZE);
+
+        return true;
+    }
+
+    template<typename typeG>
+    void DistanceTable<typeG>::Allocate(std::size_t numVertices)
+    {
+        this->Unmap();
+
+        this->m_numVertices = numVertices;
+        this->m_owned       = Vector<typeG>(numVertices * numVertices,
+                                      std::numeric_limits<typeG>::max());
+        this->m_costs       = numVertices > 0 ? &this->m_owned[0] : nullptr;
+    }
+
+    template<typename typeG>
+    bool DistanceTable<typeG>::Create(const std::string& path, std::size_t numVertices)
+    {
+        if (not TableFits<typeG>(numVertices))
+            return false;
+
+        int file = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+        if (file < 0)
+            return false;
+
+        std::size_t size =
+            DISTANCE_TABLE_HEADER_SIZE + numVertices * numVertices * sizeof(typeG);
+
+        // The mapping stays valid after the file is closed
+        bool mapped = ftruncate(file, size) == 0 and this->MapFile(file, size, true);
+        close(file);
+
+        if (not mapped)
+            return false;
+
+        uint64_t* header = static_cast<uint64_t*>(this->m_mapping);
+
+        header[0] = DISTANCE_TABLE_FILE_MAGIC;
+        header[1] = sizeof(typeG);
+        header[2] = numVertices;
+
+        this->m_numVertices = numVertices;
+
+        for (std::size_t i = 0; i < numVertices * numVertices; i++)
+            this->m_costs[i] = std::numeric_limits<typeG>::max();
+
+        return true;
+    }
+
+    template<typename typeG>
+    bool DistanceTable<typeG>::Map(const std::string& path)
+    {
+        int file = open(path.c_str(), O_RDONLY);
+
+        if (file < 0)
+            return false;
+
+        struct stat info;
+
+        if (fstat(file, &info) != 0 or
+            static_cast<std::size_t>(info.st_size) < DISTANCE_TABLE_HEADER_SIZE)
+        {
+            close(file);
+            return false;
+        }
+
+        std::size_t size = info.st_size;
+
+        // Check the header before dropping the current table
+        uint64_t header[3];
+
+        if (pread(file, header, sizeof(header), 0) !=
+                static_cast<ssize_t>(sizeof(header)) or
+            header[0] != DISTANCE_TABLE_FILE_MAGIC or header[1] != sizeof(typeG) or
+            not TableFits<typeG>(header[2]) or
+            size != DISTANCE_TABLE_HEADER_SIZE + header[2] * header[2] * sizeof(typeG))
+        {
+            close(file);
+            return false;
+        }
+
+        bool mapped = this->MapFile(file, size, false);
+        close(file);
+
+        if (mapped)
+            this->m_numVertices = header[2];
+
+        return mapped;
+    }
+
+    template<typename typeG>
+    std::size_t DistanceTable<typeG>::GetNumVertices() const
+    {
+        return this->m_numVertices;
+    }
+
+    template<typename typeG>
+    bool DistanceTable<typeG>::IsWritable() const
+    {
+        return this->m_writable;
+    }
+
+    template<typename typeG>
+    bool DistanceTable<typeG>::IsMapped() const
+    {
+        return this->m_mapping != nullptr;
+    }
+
+    template<typename typeG>
+    typeG DistanceTable<typeG>::Get(std::size_t sourceID, std::size_t targetID) const
+    {
+        return this->m_costs[sourceID * this->m_numVertices + targetID];
+    }
+
+    template<typename typeG>
+    const typeG* DistanceTable<typeG>::GetRow(std::size_t sourceID) const
+    {
+        return this->m_costs + sourceID * this->m_numVertices;
+    }
+
+    template<typename typeG>
+    typeG* DistanceTable<typeG>::GetRow(std::size_t sourceID)
+    {
+        return this->m_costs + sourceID * this->m_numVertices;
+    }
+} // namespace graph
+
+#endif // DISTANCE_TABLE_H_
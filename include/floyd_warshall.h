@@ -0,0 +1,430 @@
+/*
+ * Filename: floyd_warshall.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef FLOYD_WARSHALL_H_
+#define FLOYD_WARSHALL_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#if defined(__AVX2__) or defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+#include "distance_table.h"
+#include "frozen_graph.h"
+#include "graph.h"
+#include "parallel.h"
+
+namespace graph
+{
+    namespace
+    {
+        // Side of the square tiles of the blocked Floyd-Warshall. Three tiles of
+        // 32-bit costs take 48 KiB, so the tiles being combined stay in cache
+        constexpr std::size_t FLOYD_WARSHALL_BLOCK_SIZE = 64;
+
+        /**
+         * @brief Vectorized part of MinPlusRow, for the cost types with an
+         * instruction set kernel
+         * @return The number of leading entries processed, the rest is left to the
+         * scalar loop
+         */
+        template<typename typeG>
+        inline std::size_t MinPlusRowSimd(typeG*, const typeG*, typeG, std::size_t)
+        {
+            return 0;
+        }
+
+#if defined(__AVX512F__)
+        inline std::size_t MinPlusRowSimd(int32_t*       row,
+                                          const int32_t* kRow,
+                                          int32_t        ik,
+                                          std::size_t    count)
+        {
+            const __m512i infinity = _mm512_set1_epi32(INT32_MAX);
+            const __m512i vik      = _mm512_set1_epi32(ik);
+
+            std::size_t j = 0;
+
+            for (; j + 16 <= count; j += 16)
+            {
+                __m512i kj = _mm512_loadu_si512(kRow + j);
+                __m512i ij = _mm512_loadu_si512(row + j);
+
+                __mmask16 finite = _mm512_cmpneq_epi32_mask(kj, infinity);
+
+                ij = _mm512_mask_min_epi32(ij, finite, ij, _mm512_add_epi32(vik, kj));
+                _mm512_storeu_si512(row + j, ij);
+            }
+
+            return j;
+        }
+
+        inline std::size_t MinPlusRowSimd(uint32_t*       row,
+                                          const uint32_t* kRow,
+                                          uint32_t        ik,
+                                          std::size_t     count)
+        {
+            const __m512i infinity = _mm512_set1_epi32(-1);
+            const __m512i vik      = _mm512_set1_epi32(ik);
+
+            std::size_t j = 0;
+
+            for (; j + 16 <= count; j += 16)
+            {
+                __m512i kj = _mm512_loadu_si512(kRow + j);
+                __m512i ij = _mm512_loadu_si512(row + j);
+
+                __mmask16 finite = _mm512_cmpneq_epu32_mask(kj, infinity);
+
+                ij = _mm512_mask_min_epu32(ij, finite, ij, _mm512_add_epi32(vik, kj));
+                _mm512_storeu_si512(row + j, ij);
+            }
+
+            return j;
+        }
+
+        inline std::size_t
+        MinPlusRowSimd(float* row, const float* kRow, float ik, std::size_t count)
+        {
+            const __m512 infinity = _mm512_set1_ps(std::numeric_limits<float>::max());
+            const __m512 vik      = _mm512_set1_ps(ik);
+
+            std::size_t j = 0;
+
+            for (; j + 16 <= count; j += 16)
+            {
+                __m512 kj = _mm512_loadu_ps(kRow + j);
+                __m512 ij = _mm512_loadu_ps(row + j);
+
+                __mmask16 finite = _mm512_cmp_ps_mask(kj, infinity, _CMP_NEQ_OQ);
+
+                ij = _mm512_mask_min_ps(ij, finite, ij, _mm512_add_ps(vik, kj));
+                _mm512_storeu_ps(row + j, ij);
+            }
+
+            return j;
+        }
+
+        inline std::size_t
+        MinPlusRowSimd(double* row, const double* kRow, double ik, std::size_t count)
+        {
+            const __m512d infinity = _mm512_set1_pd(std::numeric_limits<double>::max());
+            const __m512d vik      = _mm512_set1_pd(ik);
+
+            std::size_t j = 0;
+
+            for (; j + 8 <= count; j += 8)
+            {
+                __m512d kj = _mm512_loadu_pd(kRow + j);
+                __m512d ij = _mm512_loadu_pd(row + j);
+
+                __mmask8 finite = _mm512_cmp_pd_mask(kj, infinity, _CMP_NEQ_OQ);
+
+                ij = _mm512_mask_min_pd(ij, finite, ij, _mm512_add_pd(vik, kj));
+                _mm512_storeu_pd(row + j, ij);
+            }
+
+            return j;
+        }
+#elif defined(__AVX2__)
+        inline std::size_t MinPlusRowSimd(int32_t*       row,
+                                          const int32_t* kRow,
+                                          int32_t        ik,
+                                          std::size_t    count)
+        {
+            const __m256i infinity = _mm256_set1_epi32(INT32_MAX);
+            const __m256i vik      = _mm256_set1_epi32(ik);
+
+            std::size_t j = 0;
+
+            for (; j + 8 <= count; j += 8)
+            {
+                __m256i kj =
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(kRow + j));
+                __m256i ij = _mm256_loadu_si256(reinterpret_cast<__m256i*>(row + j));
+
+                // Unreachable entries of row k offer infinity instead of a sum
+                __m256i sum = _mm256_blendv_epi8(_mm256_add_epi32(vik, kj),
+                                                 infinity,
+                                                 _mm256_cmpeq_epi32(kj, infinity));
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(row + j),
+                                    _mm256_min_epi32(ij, sum));
+            }
+
+            return j;
+        }
+
+        inline std::size_t MinPlusRowSimd(uint32_t*       row,
+                                          const uint32_t* kRow,
+                                          uint32_t        ik,
+                                          std::size_t     count)
+        {
+            const __m256i infinity = _mm256_set1_epi32(-1);
+            const __m256i vik      = _mm256_set1_epi32(ik);
+
+            std::size_t j = 0;
+
+            for (; j + 8 <= count; j += 8)
+            {
+                __m256i kj =
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(kRow + j));
+                __m256i ij = _mm256_loadu_si256(reinterpret_cast<__m256i*>(row + j));
+
+                // Unreachable entries of row k offer infinity instead of a sum
+                __m256i sum = _mm256_blendv_epi8(_mm256_add_epi32(vik, kj),
+                                                 infinity,
+                                                 _mm256_cmpeq_epi32(kj, infinity));
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(row + j),
+                                    _mm256_min_epu32(ij, sum));
+            }
+
+            return j;
+        }
+
+        inline std::size_t
+        MinPlusRowSimd(float* row, const float* kRow, float ik, std::size_t count)
+        {
+            const __m256 infinity = _mm256_set1_ps(std::numeric_limits<float>::max());
+            const __m256 vik      = _mm256_set1_ps(ik);
+
+            std::size_t j = 0;
+
+            for (; j + 8 <= count; j += 8)
+            {
+                __m256 kj = _mm256_loadu_ps(kRow + j);
+                __m256 ij = _mm256_loadu_ps(row + j);
+
+                __m256 sum = _mm256_blendv_ps(_mm256_add_ps(vik, kj),
+                                              infinity,
+                                              _mm256_cmp_ps(kj, infinity, _CMP_EQ_OQ));
+
+                _mm256_storeu_ps(row + j, _mm256_min_ps(ij, sum));
+            }
+
+            return j;
+        }
+
+        inline std::size_t
+        MinPlusRowSimd(double* row, const double* kRow, double ik, std::size_t count)
+        {
+            const __m256d infinity = _mm256_set1_pd(std::numeric_limits<double>::max());
+            const __m256d vik      = _mm256_set1_pd(ik);
+
+            std::size_t j = 0;
+
+            for (; j + 4 <= count; j += 4)
+            {
+                __m256d kj = _mm256_loadu_pd(kRow + j);
+                __m256d ij = _mm256_loadu_pd(row + j);
+
+                __m256d sum = _mm256_blendv_pd(_mm256_add_pd(vik, kj),
+                                               infinity,
+                                               _mm256_cmp_pd(kj, infinity, _CMP_EQ_OQ));
+
+                _mm256_storeu_pd(row + j, _mm256_min_pd(ij, sum));
+            }
+
+            return j;
+        }
+#endif
+
+        /**
+         * @brief Min-plus update of a row segment: row[j] = min(row[j], ik + kRow[j])
+         * @param row Segment of row i of the cost matrix
+         * @param kRow Same segment of row k
+         * @param ik Cost from i to k, which must not be infinity
+         * @param count Number of entries of the segment
+         *
+         * The entries of row k that are infinity are skipped, so no sum overflows.
+         * With AVX-512 or AVX2 the int32_t, uint32_t, float and double costs are
+         * updated 16 or 8 at a time (8 or 4 for double), the rest one by one.
+         */
+        template<typename typeG>
+        inline void
+        MinPlusRow(typeG* row, const typeG* kRow, typeG ik, std::size_t count)
+        {
+            const typeG INFINITY_VALUE = std::numeric_limits<typeG>::max();
+
+            for (std::size_t j = MinPlusRowSimd(row, kRow, ik, count); j < count; j++)
+            {
+                if (kRow[j] != INFINITY_VALUE and ik + kRow[j] < row[j])
+                    row[j] = ik + kRow[j];
+            }
+        }
+
+        /**
+         * @brief Relax the tile (I, J) of the cost matrix through the vertices of
+         * block K, with k in the outer loop as in the unblocked algorithm
+         */
+        template<typename typeG>
+        inline void UpdateTile(DistanceTable<typeG>& table,
+                               std::size_t           blockI,
+                               std::size_t           blockJ,
+                               std::size_t           blockK)
+        {
+            const typeG INFINITY_VALUE = std::numeric_limits<typeG>::max();
+
+            std::size_t n = table.GetNumVertices();
+
+            auto First = [](std::size_t block) {
+                return block * FLOYD_WARSHALL_BLOCK_SIZE;
+            };
+
+            auto Last = [n](std::size_t block) {
+                std::size_t last = (block + 1) * FLOYD_WARSHALL_BLOCK_SIZE;
+                return last < n ? last : n;
+            };
+
+            std::size_t firstJ = First(blockJ);
+            std::size_t count  = Last(blockJ) - firstJ;
+
+            for (std::size_t k = First(blockK); k < Last(blockK); k++)
+            {
+                const typeG* kRow = table.GetRow(k) + firstJ;
+
+                for (std::size_t i = First(blockI); i < Last(blockI); i++)
+                {
+                    typeG* row = table.GetRow(i);
+
+                    if (row[k] != INFINITY_VALUE)
+                        MinPlusRow(row + firstJ, kRow, row[k], count);
+                }
+            }
+        }
+    } // namespace
+
+    /**
+     * @brief Run the Floyd-Warshall algorithm to find the shortest paths between all
+     * pairs of vertices of a graph that may have negative edge costs
+     * @param graph The frozen graph on which to calculate the shortest paths
+     * @param table Receives the costs. A table in memory is sized by Allocate. A
+     *        table backed by a file, such as one made by Create, is filled in place
+     *        and must be writable and of the size of the graph
+     * @param numThreads Number of threads to be used. Zero means one thread per
+     *        hardware thread
+     * @return False if the table is backed by a file that cannot receive the costs,
+     *         in which case it is not changed, or if the graph has a negative cycle,
+     *         in which case the costs are not the shortest ones. True otherwise
+     *
+     * The cost matrix is split in square tiles. For each block K of intermediate
+     * vertices, the diagonal tile (K, K) is relaxed first, then the tiles of row K
+     * and column K, which only read the diagonal tile, and last all the other tiles,
+     * which only read the tiles of row K and column K. The tiles of each of the last
+     * two steps are independent and are spread among the threads. The inner loop is
+     * a min-plus update of a row of a tile, vectorized when the code is built for
+     * AVX2 or AVX-512 (see the ENABLE_NATIVE_ARCH option).
+     *
+     * Complexity: O(V^3), when V is the number of vertices in the graph
+     */
+    template<typename typeG>
+    inline bool FloydWarshall(const FrozenGraph<typeG>& graph,
+                              DistanceTable<typeG>&     table,
+                              std::size_t               numThreads = 0)
+    {
+        // Defines the infinity value for the typeG type
+        typeG INFINITY_VALUE = std::numeric_limits<typeG>::max();
+
+        std::size_t n = graph.GetNumVertices();
+
+        // A file-backed table is never replaced by one in memory, since it may not
+        // fit in the RAM
+        if (table.IsMapped() and
+            (not table.IsWritable() or table.GetNumVertices() != n))
+            return false;
+
+        if (not table.IsMapped() and table.GetNumVertices() != n)
+            table.Allocate(n);
+
+        // Adjacency matrix, keeping the cheapest of parallel edges
+        for (std::size_t u = 0; u < n; u++)
+        {
+            typeG* row = table.GetRow(u);
+
+            for (std::size_t v = 0; v < n; v++)
+                row[v] = INFINITY_VALUE;
+
+            row[u] = 0;
+
+            for (std::size_t arc = graph.GetFirstArc(u); arc < graph.GetLastArc(u);
+                 arc++)
+            {
+                if (graph.GetCost(arc) < row[graph.GetHead(arc)])
+                    row[graph.GetHead(arc)] = graph.GetCost(arc);
+            }
+        }
+
+        std::size_t numBlocks =
+            (n + FLOYD_WARSHALL_BLOCK_SIZE - 1) / FLOYD_WARSHALL_BLOCK_SIZE;
+
+        for (std::size_t k = 0; k < numBlocks; k++)
+        {
+            UpdateTile(table, k, k, k);
+
+            // Tiles of row k, then tiles of column k, skipping the diagonal
+            parallel::For(
+                2 * (numBlocks - 1),
+                [&](std::size_t index, std::size_t) {
+                    std::size_t other = index % (numBlocks - 1);
+                    other             = other < k ? other : other + 1;
+
+                    if (index < numBlocks - 1)
+                        UpdateTile(table, k, other, k);
+                    else
+                        UpdateTile(table, other, k, k);
+                },
+                numThreads);
+
+            parallel::For(
+                (numBlocks - 1) * (numBlocks - 1),
+                [&](std::size_t index, std::size_t) {
+                    std::size_t i = index / (numBlocks - 1);
+                    std::size_t j = index % (numBlocks - 1);
+
+                    UpdateTile(table, i < k ? i : i + 1, j < k ? j : j + 1, k);
+                },
+                numThreads);
+        }
+
+        // A vertex on a negative cycle reaches itself with a negative cost
+        if constexpr (std::numeric_limits<typeG>::is_signed)
+        {
+            for (std::size_t v = 0; v < n; v++)
+                if (table.Get(v, v) < 0)
+                    return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief FloydWarshall overload that builds the cost matrix from a graph
+     * @param graph The graph on which to calculate the shortest paths
+     * @param table Receives the costs, indexed by vertex ID
+     * @param numThreads Number of threads to be used. Zero means one thread per
+     *        hardware thread
+     * @return False if the graph has a negative cycle, True otherwise
+     */
+    template<typename typeG,
+             typename typeT,
+             typename typeD,
+             std::size_t nDim,
+             bool        directed>
+    inline bool FloydWarshall(Graph<typeG, typeT, typeD, nDim, directed>& graph,
+                              DistanceTable<typeG>&                       table,
+                              std::size_t numThreads = 0)
+    {
+        FrozenGraph<typeG> frozen(graph);
+
+        return FloydWarshall(frozen, table, numThreads);
+    }
+} // namespace graph
+
+#endif // FLOYD_WARSHALL_H_
@@ -0,0 +1,317 @@
+/*
+ * Filename: frozen_graph.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef FROZEN_GRAPH_H_
+#define FROZEN_GRAPH_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "vector.h"
+
+#include "edge.h"
+#include "graph.h"
+
+namespace graph
+{
+    /**
+     * @brief A read-only snapshot of a Graph stored as compressed adjacency arrays
+     *
+     * @tparam typeG The type for the cost of the graph's edges
+     *
+     * The arcs leaving vertex u are stored contiguously in the range
+     * [GetFirstArc(u), GetLastArc(u)), so a search only walks plain arrays instead of
+     * the maps and edge pointers of the Graph. Vertex IDs of the original graph are
+     * used as indices, so any per-vertex vector of size GetNumVertices() can be
+     * indexed directly by the IDs. Removed vertices simply have no arcs.
+     *
+     * Directed graphs also store the reversed arcs, which are used by backward
+     * searches (backward = true). In undirected graphs both directions share the
+     * same arrays.
+     *
+     * Since the searches never change the snapshot, the same FrozenGraph can be read
+     * by several threads at the same time.
+     */
+    template<typename typeG>
+    class FrozenGraph
+    {
+        private:
+            // Index of the first arc of each vertex, followed by the number of arcs
+            Vector<std::size_t> m_offsets[2];
+
+            // Head vertex, cost and ID of the original edge of each arc
+            Vector<std::size_t> m_heads[2];
+            Vector<typeG>       m_costs[2];
+            Vector<std::size_t> m_edgeIDs[2];
+
+            std::size_t m_numVertices;
+            bool        m_directed;
+
+            // Identifies the state of the graph the snapshot was taken from
+            uint64_t m_version;
+
+            /**
+             * @brief Get a version number never returned before, shared by all the
+             * frozen graphs so that two snapshots never have the same version
+             */
+            static uint64_t NextVersion();
+
+            /**
+             * @brief Get the index of the arrays used by a direction
+             */
+            std::size_t Side(bool backward) const;
+
+        public:
+            FrozenGraph();
+
+            /**
+             * @brief Constructor overload that freezes a graph
+             * @param graph The graph to be frozen
+             */
+            template<typename typeT, typename typeD, std::size_t nDim, bool directed>
+            FrozenGraph(Graph<typeG, typeT, typeD, nDim, directed>& graph);
+
+            /**
+             * @brief Rebuild the snapshot from the current state of a graph
+             * @param graph The graph to be frozen
+             */
+            template<typename typeT, typename typeD, std::size_t nDim, bool directed>
+            void Freeze(Graph<typeG, typeT, typeD, nDim, directed>& graph);
+
+            /**
+             * @return The size of the vertex ID space, that is, the last vertex ID
+             * plus one
+             */
+            std::size_t GetNumVertices() const;
+
+            /**
+             * @return The number of arcs in the forward direction
+             */
+            std::size_t GetNumArcs() const;
+
+            /**
+             * @return True if the frozen graph is directed, false otherwise
+             */
+            bool IsDirected() const;
+
+            /**
+             * @return A number that changes every time the snapshot is rebuilt, e.g.
+             * after edge costs were changed in the graph, so the results of previous
+             * searches can be recognized as stale
+             */
+            uint64_t GetVersion() const;
+
+            /**
+             * @param vertexID ID of the vertex
+             * @param backward True to get the arcs entering the vertex
+             * @return The index of the first arc of the vertex
+             */
+            std::size_t GetFirstArc(std::size_t vertexID, bool backward = false) const;
+
+            /**
+             * @param vertexID ID of the vertex
+             * @param backward True to get the arcs entering the vertex
+             * @return The index after the last arc of the vertex
+             */
+            std::size_t GetLastArc(std::size_t vertexID, bool backward = false) const;
+
+            /**
+             * @param arc Index of the arc
+             * @param backward True if the arc index refers to the reversed arcs
+             * @return ID of the vertex at the other end of the arc
+             */
+            std::size_t GetHead(std::size_t arc, bool backward = false) const;
+
+            /**
+             * @param arc Index of the arc
+             * @param backward True if the arc index refers to the reversed arcs
+             * @return Cost of the arc
+             */
+            typeG GetCost(std::size_t arc, bool backward = false) const;
+
+            /**
+             * @param arc Index of the arc
+             * @param backward True if the arc index refers to the reversed arcs
+             * @return ID of the edge of the original graph that created the arc
+             */
+            std::size_t GetEdgeID(std::size_t arc, bool backward = false) const;
+    };
+
+    template<typename typeG>
+    FrozenGraph<typeG>::FrozenGraph()
+    {
+        this->m_numVertices = 0;
+        this->m_directed    = false;
+        this->m_version     = NextVersion();
+
+        for (std::size_t side = 0; side < 2; side++)
+            this->m_offsets[side].PushBack(0);
+    }
+
+    template<typename typeG>
+    uint64_t FrozenGraph<typeG>::NextVersion()
+    {
+        static std::atomic<uint64_t> counter(0);
+
+        return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    template<typename typeG>
+    template<typename typeT, typename typeD, std::size_t nDim, bool directed>
+    FrozenGraph<typeG>::FrozenGraph(Graph<typeG, typeT, typeD, nDim, directed>& graph)
+    {
+        this->Freeze(graph);
+    }
+
+    template<typename typeG>
+    template<typename typeT, typename typeD, std::size_t nDim, bool directed>
+    void FrozenGraph<typeG>::Freeze(Graph<typeG, typeT, typeD, nDim, directed>& graph)
+    {
+        this->m_directed = directed;
+        this->m_version  = NextVersion();
+
+        // Vertex IDs are never reused, so the last ID bounds the ID space
+        this->m_numVertices =
+            graph.GetNumVertices() == 0 ? 0 : graph.GetLastVertexID() + 1;
+
+        for (std::size_t side = 0; side < 2; side++)
+        {
+            this->m_offsets[side] = Vector<std::size_t>(this->m_numVertices + 1, 0);
+            this->m_heads[side].Clear();
+            this->m_costs[side].Clear();
+            this->m_edgeIDs[side].Clear();
+        }
+
+        Edge<typeG, typeT, typeD, nDim>* uv = nullptr;
+
+        std::size_t tail;
+        std::size_t head;
+
+        // Forward arcs follow the adjacency lists, which already hold both ends of
+        // the edges in undirected graphs
+        // Pair<first, second> = <ID, Vertex>
+        for (auto& pair : graph.GetVertices())
+        {
+            tail = pair.GetFirst();
+
+            // Pair<first, second> = <ID, Edge>
+            for (auto& adj : pair.GetSecond().GetAdjacencyList())
+            {
+                uv = adj.GetSecond();
+
+                head = uv->GetVertices().GetFirst()->GetID() == tail
+                           ? uv->GetVertices().GetSecond()->GetID()
+                           : uv->GetVertices().GetFirst()->GetID();
+
+                this->m_heads[0].PushBack(head);
+                this->m_costs[0].PushBack(uv->GetCost());
+                this->m_edgeIDs[0].PushBack(uv->GetID());
+                this->m_offsets[0][tail + 1]++;
+            }
+        }
+
+        for (std::size_t i = 0; i < this->m_numVertices; i++)
+            this->m_offsets[0][i + 1] += this->m_offsets[0][i];
+
+        if (not directed)
+            return;
+
+        // Reversed arcs are placed with a counting sort on the head of each edge
+        Vector<std::size_t> position(this->m_numVertices, 0);
+
+        for (std::size_t arc = 0; arc < this->m_heads[0].Size(); arc++)
+            this->m_offsets[1][this->m_heads[0][arc] + 1]++;
+
+        for (std::size_t i = 0; i < this->m_numVertices; i++)
+        {
+            this->m_offsets[1][i + 1] += this->m_offsets[1][i];
+            position[i] = this->m_offsets[1][i];
+        }
+
+        this->m_heads[1]   = Vector<std::size_t>(this->m_heads[0].Size(), 0);
+        this->m_costs[1]   = Vector<typeG>(this->m_heads[0].Size(), typeG());
+        this->m_edgeIDs[1] = Vector<std::size_t>(this->m_heads[0].Size(), 0);
+
+        for (std::size_t u = 0; u < this->m_numVertices; u++)
+        {
+            for (std::size_t arc = this->m_offsets[0][u];
+                 arc < this->m_offsets[0][u + 1];
+                 arc++)
+            {
+                std::size_t reversed = position[this->m_heads[0][arc]]++;
+
+                this->m_heads[1][reversed]   = u;
+                this->m_costs[1][reversed]   = this->m_costs[0][arc];
+                this->m_edgeIDs[1][reversed] = this->m_edgeIDs[0][arc];
+            }
+        }
+    }
+
+    template<typename typeG>
+    std::size_t FrozenGraph<typeG>::Side(bool backward) const
+    {
+        return backward and this->m_directed ? 1 : 0;
+    }
+
+    template<typename typeG>
+    std::size_t FrozenGraph<typeG>::GetNumVertices() const
+    {
+        return this->m_numVertices;
+    }
+
+    template<typename typeG>
+    std::size_t FrozenGraph<typeG>::GetNumArcs() const
+    {
+        return this->m_heads[0].Size();
+    }
+
+    template<typename typeG>
+    bool FrozenGraph<typeG>::IsDirected() const
+    {
+        return this->m_directed;
+    }
+
+    template<typename typeG>
+    uint64_t FrozenGraph<typeG>::GetVersion() const
+    {
+        return this->m_version;
+    }
+
+    template<typename typeG>
+    std::size_t FrozenGraph<typeG>::GetFirstArc(std::size_t vertexID,
+                                                bool        backward) const
+    {
+        return this->m_offsets[this->Side(backward)][vertexID];
+    }
+
+    template<typename typeG>
+    std::size_t FrozenGraph<typeG>::GetLastArc(std::size_t vertexID,
+                                               bool        backward) const
+    {
+        return this->m_offsets[this->Side(backward)][vertexID + 1];
+    }
+
+    template<typename typeG>
+    std::size_t FrozenGraph<typeG>::GetHead(std::size_t arc, bool backward) const
+    {
+        return this->m_heads[this->Side(backward)][arc];
+    }
+
+    template<typename typeG>
+    typeG FrozenGraph<typeG>::GetCost(std::size_t arc, bool backward) const
+    {
+        return this->m_costs[this->Side(backward)][arc];
+    }
+
+    template<typename typeG>
+    std::size_t FrozenGraph<typeG>::GetEdgeID(std::size_t arc, bool backward) const
+    {
+        return this->m_edgeIDs[this->Side(backward)][arc];
+    }
+} // namespace graph
+
+#endif // FROZEN_GRAPH_H_
@@ -9,10 +9,13 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <iostream>
+#include <limits>
 
 #include "edge.h"
 #include "graph.h"
 #include "heuristics.h"
+#include "pair.h"
 #include "vector.h"
 
 /**
@@ -67,8 +70,86 @@ namespace graph
                        const graph::Edge<typeG, typeT, typeD, nDim>* e2) -> bool {
             return e1->GetCost() <= e2->GetCost();
         };
+
+        /**
+         * @brief A function object to compare two pairs <key, value> based on only
+         * their keys
+         */
+        template<typename typeK, typename typeV>
+        auto Key = [](Pair<typeK, typeV> p1, Pair<typeK, typeV> p2) -> bool {
+            return p1.GetFirst() <= p2.GetFirst();
+        };
     } // namespace compare
 
+    /**
+     * @brief Counters filled by the search algorithms that accept them, so the
+     * amount of work done by different algorithms can be compared on the same query
+     */
+    struct SearchStatistics
+    {
+            // Number of vertices removed from a queue and expanded
+            std::size_t m_settledVertices = 0;
+
+            // Number of edges scanned while expanding the settled vertices
+            std::size_t m_relaxedEdges = 0;
+
+            // Number of times an informed search computed the heuristic of a vertex
+            std::size_t m_heuristicEvaluations = 0;
+
+            // Number of heuristic computations avoided by reusing the value already
+            // computed for the vertex in the same query
+            std::size_t m_heuristicCacheHits = 0;
+    };
+
+    /**
+     * @brief A path as plain data. The buffers are cleared, not released, before a
+     * path is written, so a result reused across queries stops allocating once it
+     * has grown to the longest path seen
+     */
+    template<typename typeG>
+    struct PathResult
+    {
+            // IDs of the vertices, from the first vertex of the path to the last
+            Vector<std::size_t> m_vertexIDs;
+
+            // IDs of the edges, m_edgeIDs[i] joins m_vertexIDs[i] and m_vertexIDs[i+1]
+            Vector<std::size_t> m_edgeIDs;
+
+            // Cost from the first vertex of the path up to each vertex
+            Vector<typeG> m_costs;
+
+            /**
+             * @brief Remove the path, keeping the memory of the buffers
+             */
+            void Clear()
+            {
+                this->m_vertexIDs.Clear();
+                this->m_edgeIDs.Clear();
+                this->m_costs.Clear();
+            }
+
+            /**
+             * @brief Reverse the vertices and edges in place, used by the extraction
+             * functions that collect a path from its last vertex
+             */
+            void Reverse()
+            {
+                for (std::size_t i = 0, j = this->m_vertexIDs.Size(); i + 1 < j;)
+                {
+                    std::size_t id         = this->m_vertexIDs[i];
+                    this->m_vertexIDs[i++] = this->m_vertexIDs[--j];
+                    this->m_vertexIDs[j]   = id;
+                }
+
+                for (std::size_t i = 0, j = this->m_edgeIDs.Size(); i + 1 < j;)
+                {
+                    std::size_t id       = this->m_edgeIDs[i];
+                    this->m_edgeIDs[i++] = this->m_edgeIDs[--j];
+                    this->m_edgeIDs[j]   = id;
+                }
+            }
+    };
+
     /**
      * @brief Relax the edge (u, v)
      * @param u, v Pointers to vertices of this edge
@@ -80,8 +161,9 @@ namespace graph
                       Vertex<typeG, typeT, typeD, nDim>* v,
                       Edge<typeG, typeT, typeD, nDim>*   uv)
     {
-        // Heuristic by default is 0
-        if (v->GetCurrentCost() >
+        // Heuristic by default is 0. The current cost of a vertex includes its
+        // heuristic cost, so it is removed from both ends before comparing
+        if (v->GetCurrentCost() - v->GetHeuristicCost() >
             ((u->GetCurrentCost() - u->GetHeuristicCost()) + uv->GetCost()))
         {
             v->SetCurrentCost((u->GetCurrentCost() - u->GetHeuristicCost()) +
@@ -94,42 +176,82 @@ namespace graph
         return false;
     }
 
-    namespace
+    /**
+     * @brief Get the path from the source of the last search to a target vertex,
+     * following the predecessor edges stored in the vertices
+     * @param graph The graph containing the vertices and edges
+     * @param targetID ID of the last vertex of the path
+     * @param path Receives the path, its previous content is cleared
+     * @return True if the target was reached by the last search, False otherwise
+     *
+     * Every search on a Graph resets the current cost of all vertices to the maximum
+     * value of typeG, so a vertex with that cost was not reached by the last search.
+     * The cumulative costs are summed from the edge costs, so they do not carry the
+     * heuristic stored in the current cost of the vertices by the informed searches.
+     */
+    template<typename typeG,
+             typename typeT,
+             typename typeD,
+             std::size_t nDim,
+             bool        directed>
+    inline bool GetPath(Graph<typeG, typeT, typeD, nDim, directed>& graph,
+                        std::size_t                                 targetID,
+                        PathResult<typeG>&                          path)
     {
-        /**
-         * @brief Calculate the heuristic cost between two vertices
-         * @param heuristic The heuristic function to be used
-         * @param u Pointer to the first vertex
-         * @param v Pointer to the second vertex
-         * @return The heuristic cost between the two vertices
-         */
-        template<typename typeG, typename typeT, typename typeD, std::size_t nDim>
-        inline double_t CalculateHeuristic(heuristics::distance::Heuristic    heuristic,
-                                           Vertex<typeG, typeT, typeD, nDim>* u,
-                                           Vertex<typeG, typeT, typeD, nDim>* v)
+        path.Clear();
+
+        if (not graph.GetVertices().Contains(targetID))
+            return false;
+
+        Vertex<typeG, typeT, typeD, nDim>* v = &graph.GetVertex(targetID);
+
+        if (v->GetCurrentCost() == std::numeric_limits<typeG>::max())
+            return false;
+
+        Edge<typeG, typeT, typeD, nDim>* uv;
+
+        path.m_vertexIDs.PushBack(v->GetID());
+
+        // The edges keep pointers to their end vertices, so no lookup by ID is
+        // needed to step to the predecessor or to get the cost of the edge
+        while ((uv = v->GetEdge2Predecessor()))
         {
-            switch (heuristic)
+            // Predecessors left by an older search may form a cycle
+            if (path.m_edgeIDs.Size() >= graph.GetNumVertices())
             {
-                case heuristics::distance::Heuristic::MANHATTAN:
-                    return heuristics::distance::Manhattan(u, v);
+                path.Clear();
+                return false;
+            }
+
+            v = uv->GetVertices().GetFirst()->GetID() == v->GetID()
+                    ? uv->GetVertices().GetSecond()
+                    : uv->GetVertices().GetFirst();
 
-                case heuristics::distance::Heuristic::EUCLIDEAN:
-                    return heuristics::distance::Euclidean(u, v);
+            path.m_vertexIDs.PushBack(v->GetID());
+            path.m_edgeIDs.PushBack(uv->GetID());
+            path.m_costs.PushBack(uv->GetCost());
+        }
 
-                case heuristics::distance::Heuristic::MINKOWSKI:
-                    return heuristics::distance::Minkowski(u, v);
+        path.Reverse();
 
-                case heuristics::distance::Heuristic::HAMMING:
-                    return heuristics::distance::Hamming(u, v);
+        // The edge costs were collected from the target back to the source, so
+        // their suffix sums are the costs of the vertices in the same order
+        std::size_t numEdges = path.m_costs.Size();
 
-                default:
-                    std::cerr << "Invalid heuristic function. Using Euclidean distance "
-                                 "as default."
-                              << std::endl;
-                    return heuristics::distance::Euclidean(u, v);
-            }
+        path.m_costs.PushBack(0);
+
+        for (std::size_t i = numEdges; i-- > 0;)
+            path.m_costs[i] += path.m_costs[i + 1];
+
+        for (std::size_t i = 0, j = numEdges + 1; i + 1 < j;)
+        {
+            typeG cost        = path.m_costs[i];
+            path.m_costs[i++] = path.m_costs[--j];
+            path.m_costs[j]   = cost;
         }
-    } // namespace
+
+        return true;
+    }
 
     /**
      * @brief Print the path from a vertex v to its most distant ancestor
@@ -144,35 +266,22 @@ namespace graph
     inline void PrintPath(Graph<typeG, typeT, typeD, nDim, directed>& graph,
                           Vertex<typeG, typeT, typeD, nDim>*          v)
     {
-        // Create a vector to store the path
-        Vector<std::size_t> path;
-        Vector<typeG>       costs;
-
-        Edge<typeG, typeT, typeD, nDim>* uv;
+        PathResult<typeG> path;
 
-        path.PushBack(v->GetID());
-        costs.PushBack(0);
-
-        // Get the path
-        while ((uv = v->GetEdge2Predecessor()))
+        // The vertex may not have been reached, print it alone
+        if (not GetPath(graph, v->GetID(), path) or path.m_edgeIDs.Size() == 0)
         {
-            uv->GetVertices().GetFirst()->GetID() == v->GetID()
-                ? v = &graph.GetVertices()[uv->GetVertices().GetSecond()->GetID()]
-                : v = &graph.GetVertices()[uv->GetVertices().GetFirst()->GetID()];
-
-            path.PushBack(v->GetID());
-            costs.PushBack(uv->GetCost());
+            std::cout << "Path: " << v->GetID() << std::endl;
+            return;
         }
 
-        // Print the path
         std::cout << "Path: ";
-        for (int32_t i = path.Size() - 1; i >= 0; i--)
+        for (std::size_t i = 0; i < path.m_edgeIDs.Size(); i++)
         {
-            if (i == 0)
-                std::cout << path[i] << std::endl;
-            else
-                std::cout << path[i] << " --:" << costs[i] << ":-> ";
+            std::cout << path.m_vertexIDs[i]
+                      << " --:" << path.m_costs[i + 1] - path.m_costs[i] << ":-> ";
         }
+        std::cout << path.m_vertexIDs[path.m_edgeIDs.Size()] << std::endl;
     }
 
     /**
@@ -8,6 +8,7 @@
 #define GREEDY_BFS_H_
 
 #include <cstddef>
+#include <limits>
 #include <stdexcept>
 
 #include "graph.h"
@@ -19,22 +20,34 @@ namespace graph
 {
     /**
      * @brief Greedy Best-First Search algorithm to find the shortest path between
-     * two vertices in a graph
+     * two vertices in a graph, with a heuristic given as a policy
      * @param graph Graph to be searched
      * @param sourceID ID of the source vertex
      * @param targetID ID of the target vertex
-     * @param heuristic Heuristic to be used in the algorithm
+     * @param heuristic Function object heuristic(v, t) that estimates the cost to
+     * reach the target vertex t from vertex v. Its call is inlined in the search.
+     * Policies that satisfy BatchHeuristicPolicy score the vertices discovered by
+     * each expansion in one block
+     * @param stats Optional counters to be filled with the work done by the search
+     *
+     * The queue is ordered by the heuristic alone, which does not change during the
+     * query, so every vertex is scored and queued only once, when it is discovered.
+     * Later discoveries of a queued vertex reuse the score stored in it. The vertices
+     * discovered store the cost of their path in the search tree, so GetPath works
+     * as usual.
      */
     template<typename typeG,
              typename typeT,
              typename typeD,
              std::size_t nDim,
-             bool        directed>
+             bool        directed,
+             typename Policy>
+    requires heuristics::distance::HeuristicPolicy<Policy, typeG, typeT, typeD, nDim>
     inline bool GreedyBFS(Graph<typeG, typeT, typeD, nDim, directed>& graph,
                           std::size_t                                 sourceID,
                           std::size_t                                 targetID,
-                          heuristics::distance::Heuristic             heuristic =
-                              heuristics::distance::Heuristic::EUCLIDEAN)
+                          Policy                                      heuristic,
+                          SearchStatistics*                           stats = nullptr)
     {
         // Check if the graph contains the source and target vertices
         if (not(graph.ContainsVertex(sourceID) and graph.ContainsVertex(targetID)))
@@ -51,6 +64,7 @@ namespace graph
         {
             pair.GetSecond().SetLabel(VertexLabel::UNVISITED);
             pair.GetSecond().SetHeuristicCost(0);
+            pair.GetSecond().SetCurrentCost(std::numeric_limits<typeG>::max());
             pair.GetSecond().SetEdge2Predecessor(nullptr);
         }
 
@@ -71,7 +85,29 @@ namespace graph
             return false;
         }
 
-        u->SetHeuristicCost(CalculateHeuristic(heuristic, u, t));
+        // Policies with a batch kernel score the vertices discovered by an
+        // expansion with one call, before they are queued. The buffers are reused
+        // across the expansions
+        constexpr bool batch =
+            heuristics::distance::BatchHeuristicPolicy<Policy, nDim>;
+
+        heuristics::distance::CoordinateBlock<nDim> block;
+        Vector<Vertex<typeG, typeT, typeD, nDim>*>  reached;
+        Vector<double_t>                            distances;
+        double_t                                    targetCoordinates[nDim];
+
+        if constexpr (batch)
+        {
+            for (std::size_t d = 0; d < nDim; d++)
+                targetCoordinates[d] = static_cast<double_t>(t->GetCoordinates().At(d));
+        }
+
+        u->SetHeuristicCost(heuristic(u, t));
+        u->SetCurrentCost(0);
+        u->SetLabel(VertexLabel::PROCESSING);
+
+        if (stats)
+            stats->m_heuristicEvaluations++;
 
         minPQueue.Enqueue(u);
 
@@ -81,26 +117,70 @@ namespace graph
 
             u->SetLabel(VertexLabel::VISITED);
 
+            if (stats)
+                stats->m_settledVertices++;
+
             if (u->GetID() == targetID)
             {
                 // PrintPath(graph, u);
                 return true;
             }
 
+            if constexpr (batch)
+            {
+                block.Clear();
+                reached.Clear();
+            }
+
             // Pair<first, second> = <ID, Edge>
             for (auto& pair : u->GetAdjacencyList())
             {
                 // Edge uv (or vu, if is non-directed)
                 uv = pair.GetSecond();
 
+                if (stats)
+                    stats->m_relaxedEdges++;
+
                 v = GetAdjacentVertex(graph, u, uv);
 
                 if (v->GetLabel() == VertexLabel::UNVISITED)
                 {
-                    v->SetHeuristicCost(CalculateHeuristic(heuristic, v, t));
+                    v->SetLabel(VertexLabel::PROCESSING);
+                    v->SetCurrentCost(u->GetCurrentCost() + uv->GetCost());
                     v->SetEdge2Predecessor(uv);
 
-                    minPQueue.Enqueue(v);
+                    if (stats)
+                        stats->m_heuristicEvaluations++;
+
+                    if constexpr (batch)
+                    {
+                        block.PushBack(v);
+                        reached.PushBack(v);
+                    }
+                    else
+                    {
+                        v->SetHeuristicCost(heuristic(v, t));
+                        minPQueue.Enqueue(v);
+                    }
+                }
+                else if (v->GetLabel() == VertexLabel::PROCESSING and stats)
+                {
+                    stats->m_heuristicCacheHits++;
+                }
+            }
+
+            if constexpr (batch)
+            {
+                while (distances.Size() < reached.Size())
+                    distances.PushBack(0);
+
+                if (reached.Size() > 0)
+                    heuristic(block, targetCoordinates, &distances[0]);
+
+                for (std::size_t i = 0; i < reached.Size(); i++)
+                {
+                    reached[i]->SetHeuristicCost(distances[i]);
+                    minPQueue.Enqueue(reached[i]);
                 }
             }
         }
@@ -108,6 +188,33 @@ namespace graph
         return false;
     }
 
+    /**
+     * @brief Greedy Best-First Search algorithm to find the shortest path between
+     * two vertices in a graph
+     * @param graph Graph to be searched
+     * @param sourceID ID of the source vertex
+     * @param targetID ID of the target vertex
+     * @param heuristic Heuristic to be used in the algorithm. It is dispatched to
+     * its policy once, before the search starts
+     * @param stats Optional counters to be filled with the work done by the search
+     */
+    template<typename typeG,
+             typename typeT,
+             typename typeD,
+             std::size_t nDim,
+             bool        directed>
+    inline bool GreedyBFS(Graph<typeG, typeT, typeD, nDim, directed>& graph,
+                          std::size_t                                 sourceID,
+                          std::size_t                                 targetID,
+                          heuristics::distance::Heuristic             heuristic =
+                              heuristics::distance::Heuristic::EUCLIDEAN,
+                          SearchStatistics*                           stats = nullptr)
+    {
+        return heuristics::distance::Dispatch(heuristic, [&](auto policy) {
+            return GreedyBFS(graph, sourceID, targetID, policy, stats);
+        });
+    }
+
 } // namespace graph
 
 #endif // GREEDY_BFS_H_
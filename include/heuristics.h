@@ -8,9 +8,17 @@
 #define HEURISTICS_H_
 
 #include <cmath>
+#include <concepts>
 #include <cstddef>
 #include <cstdlib>
 #include <limits>
+#include <stdexcept>
+
+#if defined(__AVX2__) or defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+#include "vector.h"
 
 #include "vertex.h"
 
@@ -42,10 +50,11 @@ namespace heuristics
 
             for (std::size_t i = 0; i < nDim; i++)
             {
-                sum += std::pow(
-                    std::abs(static_cast<double_t>(source->GetCoordinates().At(i)) -
-                             static_cast<double_t>(target->GetCoordinates().At(i))),
-                    2);
+                double_t difference =
+                    static_cast<double_t>(source->GetCoordinates().At(i)) -
+                    static_cast<double_t>(target->GetCoordinates().At(i));
+
+                sum += difference * difference;
             }
 
             return std::sqrt(sum);
@@ -113,6 +122,385 @@ namespace heuristics
             return sum;
         }
 
+        /**
+         * @brief Coordinates of a block of vertices stored axis by axis (structure
+         * of arrays), as read by the batch distance kernels
+         *
+         * @tparam nDim Number of coordinates of each vertex
+         *
+         * A search fills the block with the neighbors of the vertex being expanded
+         * and scores all of them against the target with one kernel call. Clear
+         * keeps the memory of the axes, so a block reused across expansions stops
+         * allocating once it has held the largest neighborhood.
+         */
+        template<std::size_t nDim>
+        class CoordinateBlock
+        {
+            private:
+                Vector<double_t> m_axes[nDim];
+
+            public:
+                /**
+                 * @brief Remove all the vertices from the block
+                 */
+                void Clear()
+                {
+                    for (std::size_t d = 0; d < nDim; d++)
+                        this->m_axes[d].Clear();
+                }
+
+                /**
+                 * @brief Append the coordinates of a vertex to the block
+                 * @param vertex Pointer to the vertex
+                 * @throw std::out_of_range If the vertex has fewer than nDim
+                 * coordinates. The block is left unchanged
+                 */
+                template<typename typeG, typename typeT, typename typeD>
+                void PushBack(graph::Vertex<typeG, typeT, typeD, nDim>* vertex)
+                {
+                    if (vertex->GetCoordinates().Size() < nDim)
+                        throw std::out_of_range("Vertex without coordinates");
+
+                    for (std::size_t d = 0; d < nDim; d++)
+                        this->m_axes[d].PushBack(
+                            static_cast<double_t>(vertex->GetCoordinates()[d]));
+                }
+
+                /**
+                 * @return The number of vertices in the block
+                 */
+                std::size_t Size() const
+                {
+                    return this->m_axes[0].Size();
+                }
+
+                /**
+                 * @param d Index of the coordinate
+                 * @return Pointer to the d-th coordinate of every vertex of the block
+                 */
+                const double_t* GetAxis(std::size_t d) const
+                {
+                    return this->Size() > 0 ? &this->m_axes[d][0] : nullptr;
+                }
+        };
+
+        /**
+         * @brief Euclidean distances from every vertex of a block to a target
+         * @param block Coordinates of the vertices
+         * @param target The nDim coordinates of the target
+         * @param distances Receives one distance per vertex of the block
+         *
+         * With AVX-512 or AVX2, 8 or 4 vertices are scored at once. The loop over
+         * the coordinates has a fixed length, so it is unrolled for each nDim, such
+         * as the common 2D and 3D cases. The remaining vertices are scored one by one.
+         */
+        template<std::size_t nDim>
+        inline void EuclideanBatch(const CoordinateBlock<nDim>& block,
+                                   const double_t*              target,
+                                   double_t*                    distances)
+        {
+            std::size_t size = block.Size();
+            std::size_t i    = 0;
+
+#if defined(__AVX512F__)
+            for (; i + 8 <= size; i += 8)
+            {
+                __m512d sum = _mm512_setzero_pd();
+
+                for (std::size_t d = 0; d < nDim; d++)
+                {
+                    __m512d difference =
+                        _mm512_sub_pd(_mm512_loadu_pd(block.GetAxis(d) + i),
+                                      _mm512_set1_pd(target[d]));
+
+                    sum = _mm512_fmadd_pd(difference, difference, sum);
+                }
+
+                _mm512_storeu_pd(distances + i, _mm512_sqrt_pd(sum));
+            }
+#elif defined(__AVX2__)
+            for (; i + 4 <= size; i += 4)
+            {
+                __m256d sum = _mm256_setzero_pd();
+
+                for (std::size_t d = 0; d < nDim; d++)
+                {
+                    __m256d difference =
+                        _mm256_sub_pd(_mm256_loadu_pd(block.GetAxis(d) + i),
+                                      _mm256_set1_pd(target[d]));
+
+                    sum = _mm256_add_pd(sum, _mm256_mul_pd(difference, difference));
+                }
+
+                _mm256_storeu_pd(distances + i, _mm256_sqrt_pd(sum));
+            }
+#endif
+
+            for (; i < size; i++)
+            {
+                double_t sum = 0;
+
+                for (std::size_t d = 0; d < nDim; d++)
+                {
+                    double_t difference = block.GetAxis(d)[i] - target[d];
+                    sum += difference * difference;
+                }
+
+                distances[i] = std::sqrt(sum);
+            }
+        }
+
+        /**
+         * @brief Manhattan distances from every vertex of a block to a target
+         * @param block Coordinates of the vertices
+         * @param target The nDim coordinates of the target
+         * @param distances Receives one distance per vertex of the block
+         *
+         * Vectorized as EuclideanBatch.
+         */
+        template<std::size_t nDim>
+        inline void ManhattanBatch(const CoordinateBlock<nDim>& block,
+                                   const double_t*              target,
+                                   double_t*                    distances)
+        {
+            std::size_t size = block.Size();
+            std::size_t i    = 0;
+
+#if defined(__AVX512F__)
+            for (; i + 8 <= size; i += 8)
+            {
+                __m512d sum = _mm512_setzero_pd();
+
+                for (std::size_t d = 0; d < nDim; d++)
+                {
+                    __m512d difference =
+                        _mm512_sub_pd(_mm512_loadu_pd(block.GetAxis(d) + i),
+                                      _mm512_set1_pd(target[d]));
+
+                    sum = _mm512_add_pd(sum, _mm512_abs_pd(difference));
+                }
+
+                _mm512_storeu_pd(distances + i, sum);
+            }
+#elif defined(__AVX2__)
+            // Clearing the sign bit gives the absolute value
+            const __m256d sign = _mm256_set1_pd(-0.0);
+
+            for (; i + 4 <= size; i += 4)
+            {
+                __m256d sum = _mm256_setzero_pd();
+
+                for (std::size_t d = 0; d < nDim; d++)
+                {
+                    __m256d difference =
+                        _mm256_sub_pd(_mm256_loadu_pd(block.GetAxis(d) + i),
+                                      _mm256_set1_pd(target[d]));
+
+                    sum = _mm256_add_pd(sum, _mm256_andnot_pd(sign, difference));
+                }
+
+                _mm256_storeu_pd(distances + i, sum);
+            }
+#endif
+
+            for (; i < size; i++)
+            {
+                double_t sum = 0;
+
+                for (std::size_t d = 0; d < nDim; d++)
+                    sum += std::abs(block.GetAxis(d)[i] - target[d]);
+
+                distances[i] = sum;
+            }
+        }
+
+        /**
+         * @brief Minkowski distances from every vertex of a block to a target
+         * @param block Coordinates of the vertices
+         * @param target The nDim coordinates of the target
+         * @param distances Receives one distance per vertex of the block
+         * @param p Exponent of the Minkowski distance
+         *
+         * Exponents 1 and 2 use the vectorized Manhattan and Euclidean kernels.
+         * Other exponents need std::pow, so they are computed one by one, but still
+         * read the coordinates from the contiguous axes of the block.
+         */
+        template<std::size_t nDim>
+        inline void MinkowskiBatch(const CoordinateBlock<nDim>& block,
+                                   const double_t*              target,
+                                   double_t*                    distances,
+                                   double_t                     p = 3)
+        {
+            if (p == 1)
+                return ManhattanBatch(block, target, distances);
+
+            if (p == 2)
+                return EuclideanBatch(block, target, distances);
+
+            for (std::size_t i = 0; i < block.Size(); i++)
+            {
+                double_t sum = 0;
+
+                for (std::size_t d = 0; d < nDim; d++)
+                    sum += std::pow(std::abs(block.GetAxis(d)[i] - target[d]), p);
+
+                distances[i] = std::pow(sum, 1 / p);
+            }
+        }
+
+        /**
+         * @brief Heuristic policies, function objects that compute one of the
+         * heuristics above between a vertex and the target
+         *
+         * The searches take the policy as a template parameter, so the heuristic is
+         * chosen when the search is compiled and its call is inlined in the loop
+         * that relaxes the edges. Any other function object that satisfies
+         * HeuristicPolicy, such as a lambda, can be given to the searches the same
+         * way.
+         *
+         * The geometric policies also score a whole CoordinateBlock with their batch
+         * kernel, so AStar and GreedyBFS score all the neighbors discovered by an
+         * expansion with one call.
+         */
+        struct EuclideanPolicy
+        {
+                template<typename typeG,
+                         typename typeT,
+                         typename typeD,
+                         std::size_t nDim>
+                double_t
+                operator()(graph::Vertex<typeG, typeT, typeD, nDim>* source,
+                           graph::Vertex<typeG, typeT, typeD, nDim>* target) const
+                {
+                    return Euclidean(source, target);
+                }
+
+                template<std::size_t nDim>
+                void operator()(const CoordinateBlock<nDim>& block,
+                                const double_t*              target,
+                                double_t*                    distances) const
+                {
+                    EuclideanBatch(block, target, distances);
+                }
+        };
+
+        struct ManhattanPolicy
+        {
+                template<typename typeG,
+                         typename typeT,
+                         typename typeD,
+                         std::size_t nDim>
+                double_t
+                operator()(graph::Vertex<typeG, typeT, typeD, nDim>* source,
+                           graph::Vertex<typeG, typeT, typeD, nDim>* target) const
+                {
+                    return Manhattan(source, target);
+                }
+
+                template<std::size_t nDim>
+                void operator()(const CoordinateBlock<nDim>& block,
+                                const double_t*              target,
+                                double_t*                    distances) const
+                {
+                    ManhattanBatch(block, target, distances);
+                }
+        };
+
+        struct MinkowskiPolicy
+        {
+                // Exponent of the Minkowski distance
+                double_t m_p = 3;
+
+                template<typename typeG,
+                         typename typeT,
+                         typename typeD,
+                         std::size_t nDim>
+                double_t
+                operator()(graph::Vertex<typeG, typeT, typeD, nDim>* source,
+                           graph::Vertex<typeG, typeT, typeD, nDim>* target) const
+                {
+                    return Minkowski(source, target, this->m_p);
+                }
+
+                template<std::size_t nDim>
+                void operator()(const CoordinateBlock<nDim>& block,
+                                const double_t*              target,
+                                double_t*                    distances) const
+                {
+                    MinkowskiBatch(block, target, distances, this->m_p);
+                }
+        };
+
+        struct HammingPolicy
+        {
+                template<typename typeG,
+                         typename typeT,
+                         typename typeD,
+                         std::size_t nDim>
+                double_t
+                operator()(graph::Vertex<typeG, typeT, typeD, nDim>* source,
+                           graph::Vertex<typeG, typeT, typeD, nDim>* target) const
+                {
+                    return Hamming(source, target);
+                }
+        };
+
+        /**
+         * @brief A function object that estimates the cost between two vertices of a
+         * graph with the given template parameters
+         */
+        template<typename Policy,
+                 typename typeG,
+                 typename typeT,
+                 typename typeD,
+                 std::size_t nDim>
+        concept HeuristicPolicy =
+            requires(const Policy&                             policy,
+                     graph::Vertex<typeG, typeT, typeD, nDim>* vertex) {
+                { policy(vertex, vertex) } -> std::convertible_to<double_t>;
+            };
+
+        /**
+         * @brief A heuristic policy that also scores every vertex of a
+         * CoordinateBlock against the coordinates of the target
+         */
+        template<typename Policy, std::size_t nDim>
+        concept BatchHeuristicPolicy =
+            requires(const Policy&                policy,
+                     const CoordinateBlock<nDim>& block,
+                     const double_t*              target,
+                     double_t*                    distances) { policy(block, target, distances); };
+
+        /**
+         * @brief Call a function with the policy of a heuristic
+         * @param heuristic The heuristic chosen at run time
+         * @param function Generic callable that receives the policy, usually a
+         * lambda that runs a whole search with it
+         * @return What the function returns
+         *
+         * The heuristic is dispatched once, so the search runs with the policy
+         * already inlined. Unknown values fall back to the Euclidean distance.
+         */
+        template<typename Function>
+        inline decltype(auto) Dispatch(Heuristic heuristic, Function&& function)
+        {
+            switch (heuristic)
+            {
+                case Heuristic::MANHATTAN:
+                    return function(ManhattanPolicy());
+
+                case Heuristic::MINKOWSKI:
+                    return function(MinkowskiPolicy());
+
+                case Heuristic::HAMMING:
+                    return function(HammingPolicy());
+
+                case Heuristic::EUCLIDEAN:
+                default:
+                    return function(EuclideanPolicy());
+            }
+        }
+
     } // namespace distance
 
 } // namespace heuristics
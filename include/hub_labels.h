@@ -0,0 +1,697 @@
+/*
+ * Filename: hub_labels.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef HUB_LABELS_H_
+#define HUB_LABELS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "vector.h"
+
+#include "contraction_hierarchy.h"
+#include "parallel.h"
+
+namespace graph
+{
+    namespace
+    {
+        // Identifies the files written by HubLabels::Save
+        constexpr uint64_t HUB_LABELS_FILE_MAGIC = 0x31425548; // "HUB1"
+
+        /**
+         * @brief Round a number of bytes up to a multiple of 8, so every section of
+         * a labels file stays aligned when mapped
+         */
+        inline std::size_t PadTo8(std::size_t bytes)
+        {
+            return (bytes + 7) / 8 * 8;
+        }
+
+        /**
+         * @brief Smallest costA[i] + costB[j] over the hubs shared by two labels
+         * @param hubsA, costsA, sizeA First label, sorted by hub
+         * @param hubsB, costsB, sizeB Second label, sorted by hub
+         * @return The smallest sum, or the maximum value of typeG if the labels
+         * have no hub in common
+         *
+         * With AVX2, blocks of 8 hubs of each label are compared all against all by
+         * rotating one of the blocks, and the block whose last hub is smaller is
+         * skipped. The remaining hubs are merged one by one.
+         */
+        template<typename typeG>
+        inline typeG MinCommonHubCost(const uint32_t* hubsA,
+                                      const typeG*    costsA,
+                                      std::size_t     sizeA,
+                                      const uint32_t* hubsB,
+                                      const typeG*    costsB,
+                                      std::size_t     sizeB)
+        {
+            typeG best = std::numeric_limits<typeG>::max();
+
+            std::size_t i = 0;
+            std::size_t j = 0;
+
+#if defined(__AVX2__)
+            const __m256i rotate = _mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 0);
+
+            while (i + 8 <= sizeA and j + 8 <= sizeB)
+            {
+                __m256i a =
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(hubsA + i));
+                __m256i b =
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(hubsB + j));
+
+                __m256i equal = _mm256_cmpeq_epi32(a, b);
+
+                for (std::size_t r = 1; r < 8; r++)
+                {
+                    b     = _mm256_permutevar8x32_epi32(b, rotate);
+                    equal = _mm256_or_si256(equal, _mm256_cmpeq_epi32(a, b));
+                }
+
+                uint32_t mask = _mm256_movemask_ps(_mm256_castsi256_ps(equal));
+
+                // Matches are rare, so their positions in B are found one by one
+                while (mask)
+                {
+                    std::size_t k = __builtin_ctz(mask);
+                    mask &= mask - 1;
+
+                    std::size_t l = j;
+                    while (hubsB[l] != hubsA[i + k])
+                        l++;
+
+                    if (costsA[i + k] + costsB[l] < best)
+                        best = costsA[i + k] + costsB[l];
+                }
+
+                uint32_t lastA = hubsA[i + 7];
+                uint32_t lastB = hubsB[j + 7];
+
+                if (lastA <= lastB)
+                    i += 8;
+
+                if (lastB <= lastA)
+                    j += 8;
+            }
+#endif
+
+            while (i < sizeA and j < sizeB)
+            {
+                if (hubsA[i] < hubsB[j])
+                {
+                    i++;
+                }
+                else if (hubsB[j] < hubsA[i])
+                {
+                    j++;
+                }
+                else
+                {
+                    if (costsA[i] + costsB[j] < best)
+                        best = costsA[i] + costsB[j];
+
+                    i++;
+                    j++;
+                }
+            }
+
+            return best;
+        }
+    } // namespace
+
+    /**
+     * @brief Hub labeling distance oracle
+     *
+     * @tparam typeG The type for the cost of the graph's edges
+     *
+     * Every vertex v has a forward label, a list of pairs (hub, d(v, hub)), and a
+     * backward label, a list of pairs (hub, d(hub, v)). The labels cover all
+     * shortest paths: for any s and t, some vertex of the shortest path from s to t
+     * is in the forward label of s and in the backward label of t. A query is thus
+     * the minimum of d(s, hub) + d(hub, t) over the common hubs of two labels, found
+     * by merging the labels, which are sorted by hub. No graph is traversed.
+     *
+     * The labels are built from the vertex order of a ContractionHierarchy, from
+     * the most to the least important vertex: the label of v is v itself merged
+     * with the labels of its upward neighbors, and the entries whose cost is
+     * beaten by a query on the labels built so far are pruned. Vertices whose
+     * upward neighbors are all done are processed in parallel.
+     *
+     * Labels are stored in flat arrays (offsets, hubs and costs), which can be saved
+     * to a file and later mapped into memory with Map, so a large index is shared by
+     * processes and loaded without copies. Hubs are stored as 32-bit vertex IDs.
+     */
+    template<typename typeG>
+    class HubLabels
+    {
+        private:
+            std::size_t m_numVertices;
+
+            // Labels built in memory, empty when the labels are mapped from a file
+            Vector<uint64_t> m_ownedOffsets[2];
+            Vector<uint32_t> m_ownedHubs[2];
+            Vector<typeG>    m_ownedCosts[2];
+
+            // Forward (index 0) and backward (index 1) labels read by the queries,
+            // pointing either to the vectors above or to the mapped file
+            const uint64_t* m_offsets[2];
+            const uint32_t* m_hubs[2];
+            const typeG*    m_costs[2];
+
+            void*       m_mapping;
+            std::size_t m_mappingSize;
+
+            /**
+             * @brief Release the mapped file, if any
+             */
+            void Unmap();
+
+            /**
+             * @brief Point the labels read by the queries to the owned vectors
+             */
+            void UseOwnedLabels();
+
+        public:
+            HubLabels();
+            ~HubLabels();
+
+            HubLabels(const HubLabels&)            = delete;
+            HubLabels& operator=(const HubLabels&) = delete;
+
+            /**
+             * @brief Build the labels from a contraction hierarchy
+             * @param hierarchy The contraction hierarchy of the graph
+             * @param numThreads Number of threads to be used. Zero means one thread
+             * per hardware thread
+             */
+            void Build(const ContractionHierarchy<typeG>& hierarchy,
+                       std::size_t                        numThreads = 0);
+
+            /**
+             * @brief Cost of the shortest path between two vertices
+             * @param sourceID The ID of the source vertex
+             * @param targetID The ID of the target vertex
+             * @return The cost, or the maximum value of typeG if the target cannot be
+             * reached
+             */
+            typeG Query(std::size_t sourceID, std::size_t targetID) const;
+
+            /**
+             * @return The size of the vertex ID space covered by the labels
+             */
+            std::size_t GetNumVertices() const;
+
+            /**
+             * @param vertexID ID of the vertex
+             * @param backward True to get the size of the backward label
+             * @return The number of entries in the label of the vertex
+             */
+            std::size_t GetLabelSize(std::size_t vertexID, bool backward = false) const;
+
+            /**
+             * @return The total number of entries of the forward and backward labels
+             */
+            std::size_t GetNumEntries() const;
+
+            /**
+             * @brief Write the labels to a binary file
+             * @param path Path of the file
+             * @return True if the file was written, false otherwise
+             */
+            bool Save(const std::string& path) const;
+
+            /**
+             * @brief Map a file created by Save into memory and answer the queries
+             * directly from it
+             * @param path Path of the file
+             * @return True if the file was mapped, false if it could not be opened,
+             * was created for another cost type, or its header or offsets do not
+             * match its size. The labels are left unchanged when false is returned
+             */
+            bool Map(const std::string& path);
+    };
+
+    template<typename typeG>
+    HubLabels<typeG>::HubLabels()
+    {
+        this->m_numVertices = 0;
+        this->m_mapping     = nullptr;
+        this->m_mappingSize = 0;
+
+        for (std::size_t side = 0; side < 2; side++)
+            this->m_ownedOffsets[side].PushBack(0);
+
+        this->UseOwnedLabels();
+    }
+
+    template<typename typeG>
+    HubLabels<typeG>::~HubLabels()
+    {
+        this->Unmap();
+    }
+
+    template<typename typeG>
+    void HubLabels<typeG>::Unmap()
+    {
+        if (this->m_mapping)
+            munmap(this->m_mapping, this->m_mappingSize);
+
+        this->m_mapping     = nullptr;
+        this->m_mappingSize = 0;
+    }
+
+    template<typename typeG>
+    void HubLabels<typeG>::UseOwnedLabels()
+    {
+        for (std::size_t side = 0; side < 2; side++)
+        {
+            this->m_offsets[side] = &this->m_ownedOffsets[side][0];
+            this->m_hubs[side] =
+                this->m_ownedHubs[side].Size() > 0 ? &this->m_ownedHubs[side][0]
+                                                   : nullptr;
+            this->m_costs[side] =
+                this->m_ownedCosts[side].Size() > 0 ? &this->m_ownedCosts[side][0]
+                                                    : nullptr;
+        }
+    }
+
+    template<typename typeG>
+    void HubLabels<typeG>::Build(const ContractionHierarchy<typeG>& hierarchy,
+                                 std::size_t                        numThreads)
+    {
+        std::size_t n = hierarchy.GetNumVertices();
+
+        this->Unmap();
+        this->m_numVertices = n;
+
+        // The level of a vertex is the length of its longest upward path, so the
+        // labels of a level only depend on the labels of the levels below it
+        Vector<std::size_t> order(n, 0);
+        Vector<std::size_t> level(n, 0);
+        std::size_t         numLevels = 0;
+
+        for (std::size_t v = 0; v < n; v++)
+            order[hierarchy.GetRank(v)] = v;
+
+        for (std::size_t r = n; r-- > 0;)
+        {
+            std::size_t v = order[r];
+
+            for (std::size_t side = 0; side < 2; side++)
+            {
+                for (std::size_t arc = hierarchy.GetFirstArc(v, side == 1);
+                     arc < hierarchy.GetLastArc(v, side == 1);
+                     arc++)
+                {
+                    std::size_t w = hierarchy.GetHead(arc, side == 1);
+
+                    if (level[v] < level[w] + 1)
+                        level[v] = level[w] + 1;
+                }
+            }
+
+            if (numLevels < level[v] + 1)
+                numLevels = level[v] + 1;
+        }
+
+        Vector<Vector<std::size_t>> levels;
+        for (std::size_t l = 0; l < numLevels; l++)
+            levels.PushBack(Vector<std::size_t>());
+
+        for (std::size_t r = n; r-- > 0;)
+            levels[level[order[r]]].PushBack(order[r]);
+
+        Vector<Vector<uint32_t>> hubs[2];
+        Vector<Vector<typeG>>    costs[2];
+
+        for (std::size_t side = 0; side < 2; side++)
+        {
+            for (std::size_t v = 0; v < n; v++)
+            {
+                hubs[side].PushBack(Vector<uint32_t>());
+                costs[side].PushBack(Vector<typeG>());
+            }
+        }
+
+        auto CommonHubCost = [&](std::size_t forwardID, std::size_t backwardID) {
+            return MinCommonHubCost(&hubs[0][forwardID][0],
+                                    &costs[0][forwardID][0],
+                                    hubs[0][forwardID].Size(),
+                                    &hubs[1][backwardID][0],
+                                    &costs[1][backwardID][0],
+                                    hubs[1][backwardID].Size());
+        };
+
+        numThreads = parallel::GetNumThreads(numThreads);
+
+        // Per-thread buffers of the label being merged or pruned
+        std::unique_ptr<Vector<uint32_t>[]> mergedHubs(
+            new Vector<uint32_t>[numThreads]);
+        std::unique_ptr<Vector<typeG>[]> mergedCosts(new Vector<typeG>[numThreads]);
+
+        auto BuildLabel = [&](std::size_t v, std::size_t side, std::size_t thread) {
+            Vector<uint32_t>& label     = hubs[side][v];
+            Vector<typeG>&    labelCost = costs[side][v];
+
+            label.Clear();
+            labelCost.Clear();
+            label.PushBack(static_cast<uint32_t>(v));
+            labelCost.PushBack(0);
+
+            // Merge the label of each upward neighbor w, shifted by the cost of the
+            // arc, keeping the smallest cost of each hub
+            for (std::size_t arc = hierarchy.GetFirstArc(v, side == 1);
+                 arc < hierarchy.GetLastArc(v, side == 1);
+                 arc++)
+            {
+                std::size_t w    = hierarchy.GetHead(arc, side == 1);
+                typeG       cost = hierarchy.GetCost(arc, side == 1);
+
+                Vector<uint32_t>& mergedHub  = mergedHubs[thread];
+                Vector<typeG>&    mergedCost = mergedCosts[thread];
+
+                mergedHub.Clear();
+                mergedCost.Clear();
+
+                std::size_t i = 0;
+                std::size_t j = 0;
+
+                while (i < label.Size() or j < hubs[side][w].Size())
+                {
+                    if (j == hubs[side][w].Size() or
+                        (i < label.Size() and label[i] < hubs[side][w][j]))
+                    {
+                        mergedHub.PushBack(label[i]);
+                        mergedCost.PushBack(labelCost[i++]);
+                    }
+                    else if (i == label.Size() or hubs[side][w][j] < label[i])
+                    {
+                        mergedHub.PushBack(hubs[side][w][j]);
+                        mergedCost.PushBack(costs[side][w][j++] + cost);
+                    }
+                    else
+                    {
+                        typeG shifted = costs[side][w][j++] + cost;
+
+                        mergedHub.PushBack(label[i]);
+                        mergedCost.PushBack(shifted < labelCost[i] ? shifted
+                                                                   : labelCost[i]);
+                        i++;
+                    }
+                }
+
+                label     = mergedHub;
+                labelCost = mergedCost;
+            }
+        };
+
+        // An entry (hub, cost) is dropped when the labels already give a shorter
+        // path, since then the hub is not on a shortest path
+        auto PruneLabel = [&](std::size_t v, std::size_t side, std::size_t thread) {
+            Vector<uint32_t>& label     = hubs[side][v];
+            Vector<typeG>&    labelCost = costs[side][v];
+
+            Vector<uint32_t>& keptHubs  = mergedHubs[thread];
+            Vector<typeG>&    keptCosts = mergedCosts[thread];
+
+            keptHubs.Clear();
+            keptCosts.Clear();
+
+            for (std::size_t i = 0; i < label.Size(); i++)
+            {
+                std::size_t hub = label[i];
+
+                // The labels of the other hubs are complete, since they are in lower
+                // levels than v
+                bool keep = hub == v or
+                            not((side == 0 ? CommonHubCost(v, hub)
+                                           : CommonHubCost(hub, v)) < labelCost[i]);
+
+                if (keep)
+                {
+                    keptHubs.PushBack(label[i]);
+                    keptCosts.PushBack(labelCost[i]);
+                }
+            }
+
+            label     = keptHubs;
+            labelCost = keptCosts;
+        };
+
+        for (std::size_t l = 0; l < numLevels; l++)
+        {
+            parallel::For(
+                levels[l].Size(),
+                [&](std::size_t i, std::size_t threadIndex) {
+                    std::size_t v = levels[l][i];
+
+                    BuildLabel(v, 0, threadIndex);
+                    BuildLabel(v, 1, threadIndex);
+                    PruneLabel(v, 0, threadIndex);
+                    PruneLabel(v, 1, threadIndex);
+                },
+                numThreads);
+        }
+
+        // Flatten the labels
+        for (std::size_t side = 0; side < 2; side++)
+        {
+            this->m_ownedOffsets[side] = Vector<uint64_t>(n + 1, 0);
+
+            for (std::size_t v = 0; v < n; v++)
+                this->m_ownedOffsets[side][v + 1] =
+                    this->m_ownedOffsets[side][v] + hubs[side][v].Size();
+
+            std::size_t numEntries = this->m_ownedOffsets[side][n];
+
+            this->m_ownedHubs[side]  = Vector<uint32_t>(numEntries, 0);
+            this->m_ownedCosts[side] = Vector<typeG>(numEntries, 0);
+
+            for (std::size_t v = 0; v < n; v++)
+            {
+                for (std::size_t i = 0; i < hubs[side][v].Size(); i++)
+                {
+                    this->m_ownedHubs[side][this->m_ownedOffsets[side][v] + i] =
+                        hubs[side][v][i];
+                    this->m_ownedCosts[side][this->m_ownedOffsets[side][v] + i] =
+                        costs[side][v][i];
+                }
+            }
+        }
+
+        this->UseOwnedLabels();
+    }
+
+    template<typename typeG>
+    typeG HubLabels<typeG>::Query(std::size_t sourceID, std::size_t targetID) const
+    {
+        if (sourceID >= this->m_numVertices or targetID >= this->m_numVertices)
+            return std::numeric_limits<typeG>::max();
+
+        uint64_t s = this->m_offsets[0][sourceID];
+        uint64_t t = this->m_offsets[1][targetID];
+
+        return MinCommonHubCost(this->m_hubs[0] + s,
+                                this->m_costs[0] + s,
+                                this->m_offsets[0][sourceID + 1] - s,
+                                this->m_hubs[1] + t,
+                                this->m_costs[1] + t,
+                                this->m_offsets[1][targetID + 1] - t);
+    }
+
+    template<typename typeG>
+    std::size_t HubLabels<typeG>::GetNumVertices() const
+    {
+        return this->m_numVertices;
+    }
+
+    template<typename typeG>
+    std::size_t HubLabels<typeG>::GetLabelSize(std::size_t vertexID,
+                                               bool        backward) const
+    {
+        std::size_t side = backward ? 1 : 0;
+
+        return this->m_offsets[side][vertexID + 1] - this->m_offsets[side][vertexID];
+    }
+
+    template<typename typeG>
+    std::size_t HubLabels<typeG>::GetNumEntries() const
+    {
+        return this->m_offsets[0][this->m_numVertices] +
+               this->m_offsets[1][this->m_numVertices];
+    }
+
+    template<typename typeG>
+    bool HubLabels<typeG>::Save(const std::string& path) const
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+        if (not file.is_open())
+            return false;
+
+        // Header: magic, size of the cost type, number of vertices and number of
+        // entries of the forward and backward labels
+        uint64_t header[5] = { HUB_LABELS_FILE_MAGIC,
+                               sizeof(typeG),
+                               this->m_numVertices,
+                               this->m_offsets[0][this->m_numVertices],
+                               this->m_offsets[1][this->m_numVertices] };
+
+        file.write(reinterpret_cast<const char*>(header), sizeof(header));
+
+        // Each section is padded to 8 bytes, so Map can read it in place
+        const char padding[8] = {};
+
+        auto WriteSection = [&](const void* data, std::size_t bytes) {
+            if (bytes > 0)
+                file.write(reinterpret_cast<const char*>(data), bytes);
+
+            file.write(padding, PadTo8(bytes) - bytes);
+        };
+
+        for (std::size_t side = 0; side < 2; side++)
+            WriteSection(this->m_offsets[side],
+                         (this->m_numVertices + 1) * sizeof(uint64_t));
+
+        for (std::size_t side = 0; side < 2; side++)
+            WriteSection(this->m_hubs[side], header[3 + side] * sizeof(uint32_t));
+
+        for (std::size_t side = 0; side < 2; side++)
+            WriteSection(this->m_costs[side], header[3 + side] * sizeof(typeG));
+
+        return file.good();
+    }
+
+    template<typename typeG>
+    bool HubLabels<typeG>::Map(const std::string& path)
+    {
+        int file = open(path.c_str(), O_RDONLY);
+
+        if (file < 0)
+            return false;
+
+        struct stat info;
+
+        if (fstat(file, &info) != 0 or
+            static_cast<std::size_t>(info.st_size) < 5 * sizeof(uint64_t))
+        {
+            close(file);
+            return false;
+        }
+
+        std::size_t size    = info.st_size;
+        void*       mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, file, 0);
+
+        // The mapping stays valid after the file is closed
+        close(file);
+
+        if (mapping == MAP_FAILED)
+            return false;
+
+        const uint64_t* header = static_cast<const uint64_t*>(mapping);
+
+        std::size_t n = header[2];
+
+        // The offsets take 2 (n + 1) words and each label entry takes a hub and a
+        // cost. The counts are checked by division, so a corrupt header cannot
+        // overflow the expected size
+        std::size_t remaining  = size - 5 * sizeof(uint64_t);
+        std::size_t entryBytes = sizeof(uint32_t) + sizeof(typeG);
+
+        bool valid = header[0] == HUB_LABELS_FILE_MAGIC and
+                     header[1] == sizeof(typeG) and
+                     n < remaining / (2 * sizeof(uint64_t));
+
+        if (valid)
+        {
+            remaining -= 2 * (n + 1) * sizeof(uint64_t);
+
+            valid = header[3] <= remaining / entryBytes and
+                    header[4] <= remaining / entryBytes and
+                    remaining == PadTo8(header[3] * sizeof(uint32_t)) +
+                                     PadTo8(header[4] * sizeof(uint32_t)) +
+                                     PadTo8(header[3] * sizeof(typeG)) +
+                                     PadTo8(header[4] * sizeof(typeG));
+        }
+
+        const char* section = static_cast<const char*>(mapping) + 5 * sizeof(uint64_t);
+
+        const uint64_t* offsets[2];
+        const uint32_t* hubs[2];
+        const typeG*    costs[2];
+
+        for (std::size_t side = 0; valid and side < 2; side++)
+        {
+            offsets[side] = reinterpret_cast<const uint64_t*>(section);
+            section += PadTo8((n + 1) * sizeof(uint64_t));
+
+            // Query reads the label of v between offsets v and v + 1, so the offsets
+            // must start at 0, never decrease and end at the number of entries
+            valid = offsets[side][0] == 0 and offsets[side][n] == header[3 + side];
+
+            for (std::size_t v = 0; valid and v < n; v++)
+                valid = offsets[side][v] <= offsets[side][v + 1];
+        }
+
+        if (not valid)
+        {
+            munmap(mapping, size);
+            return false;
+        }
+
+        for (std::size_t side = 0; side < 2; side++)
+        {
+            hubs[side] = reinterpret_cast<const uint32_t*>(section);
+            section += PadTo8(header[3 + side] * sizeof(uint32_t));
+        }
+
+        for (std::size_t side = 0; side < 2; side++)
+        {
+            costs[side] = reinterpret_cast<const typeG*>(section);
+            section += PadTo8(header[3 + side] * sizeof(typeG));
+        }
+
+        this->Unmap();
+
+        this->m_mapping     = mapping;
+        this->m_mappingSize = size;
+        this->m_numVertices = n;
+
+        for (std::size_t side = 0; side < 2; side++)
+        {
+            this->m_offsets[side] = offsets[side];
+            this->m_hubs[side]    = hubs[side];
+            this->m_costs[side]   = costs[side];
+        }
+
+        // The labels built in memory are no longer needed
+        for (std::size_t side = 0; side < 2; side++)
+        {
+            this->m_ownedOffsets[side] = Vector<uint64_t>();
+            this->m_ownedHubs[side]    = Vector<uint32_t>();
+            this->m_ownedCosts[side]   = Vector<typeG>();
+        }
+
+        return true;
+    }
+} // namespace graph
+
+#endif // HUB_LABELS_H_
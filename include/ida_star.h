@@ -7,140 +7,442 @@
 #ifndef IDA_STAR_H_
 #define IDA_STAR_H_
 
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "vector.h"
+
+#include "frozen_graph.h"
 #include "graph.h"
 #include "graph_utils.h"
 #include "heuristics.h"
-#include "priority_queue_bheap.h"
 #include "vertex.h"
 
 namespace graph
 {
-    namespace
+    /**
+     * @brief Bounded table of the smallest cost with which each vertex was reached
+     * in the current iteration of an IDA* search
+     *
+     * @tparam typeG The type for the cost of the graph's edges
+     *
+     * A vertex reached again in the same iteration with a cost and a depth that are
+     * not smaller cannot lead to a better path, since its subtree was already
+     * searched with a larger budget and at least as many edges left before the depth
+     * limit, so it is pruned. The table is open addressing with a few probes
+     * per vertex and never grows: when all the probed slots are in use, the first one
+     * is overwritten, which only loses pruning opportunities. Entries of previous
+     * iterations count as free slots, so starting an iteration is O(1).
+     */
+    template<typename typeG>
+    class TranspositionTable
+    {
+        private:
+            // Number of slots probed for each vertex
+            static constexpr std::size_t NUM_PROBES = 4;
+
+            struct Entry
+            {
+                    std::size_t m_vertexID;
+                    typeG       m_cost;
+                    std::size_t m_depth;
+                    uint32_t    m_iteration;
+            };
+
+            Vector<Entry> m_entries;
+            std::size_t   m_shift;
+            uint32_t      m_iteration;
+
+        public:
+            /**
+             * @param capacity Largest number of entries. It is rounded down to a
+             * power of two. Zero disables the table
+             */
+            TranspositionTable(std::size_t capacity);
+
+            /**
+             * @brief Start a new iteration, forgetting all the entries
+             */
+            void NextIteration();
+
+            /**
+             * @brief Record that a vertex was reached with a given cost and depth
+             * @param vertexID ID of the vertex
+             * @param cost Cost of the path that reached the vertex
+             * @param depth Number of edges of the path that reached the vertex
+             * @return False if the vertex was already reached in this iteration with
+             * a cost and a depth that are not larger, so it can be pruned, true
+             * otherwise
+             */
+            bool Visit(std::size_t vertexID, typeG cost, std::size_t depth);
+    };
+
+    template<typename typeG>
+    TranspositionTable<typeG>::TranspositionTable(std::size_t capacity)
+    {
+        std::size_t bits = 0;
+
+        while (bits < 63 and (std::size_t(2) << bits) <= capacity)
+            bits++;
+
+        // Tables smaller than a probe sequence are not worth it
+        if (capacity < NUM_PROBES)
+            bits = 0;
+        else
+            this->m_entries =
+                Vector<Entry>(std::size_t(1) << bits, Entry{ 0, typeG(), 0, 0 });
+
+        this->m_shift     = 64 - bits;
+        this->m_iteration = 0;
+    }
+
+    template<typename typeG>
+    void TranspositionTable<typeG>::NextIteration()
     {
-        /**
-         * @brief Recursive function that performs the Iterative Deepening A* search
-         *
-         * @param graph The graph to be traversed
-         * @param currentVertexID The current vertex being visited
-         * @param targetVertexID The target vertex to be reached
-         * @param depth The current depth of the search
-         * @param label The current label of the search
-         * @return True if the target vertex is reached, false otherwise
-         **/
-        template<typename typeG,
-                 typename typeT,
-                 typename typeD,
-                 std::size_t nDim,
-                 bool        directed>
-        inline bool IDAStar(Graph<typeG, typeT, typeD, nDim, directed>& graph,
-                            std::size_t                                 currentVertexID,
-                            std::size_t                                 targetVertexID,
-                            std::size_t                                 depth,
-                            std::size_t                                 label,
-                            heuristics::distance::Heuristic             heuristic =
-                                heuristics::distance::Heuristic::EUCLIDEAN)
+        this->m_iteration++;
+
+        // The stamps wrapped around, so old entries could look current
+        if (this->m_iteration == 0)
+        {
+            for (std::size_t i = 0; i < this->m_entries.Size(); i++)
+                this->m_entries[i].m_iteration = 0;
+
+            this->m_iteration = 1;
+        }
+    }
+
+    template<typename typeG>
+    bool TranspositionTable<typeG>::Visit(std::size_t vertexID,
+                                          typeG       cost,
+                                          std::size_t depth)
+    {
+        if (this->m_entries.Size() == 0)
+            return true;
+
+        std::size_t mask = this->m_entries.Size() - 1;
+
+        // Fibonacci hashing spreads consecutive IDs over the table
+        std::size_t home =
+            (uint64_t(vertexID) * UINT64_C(0x9E3779B97F4A7C15)) >> this->m_shift;
+
+        std::size_t free = this->m_entries.Size();
+
+        for (std::size_t i = 0; i < NUM_PROBES; i++)
         {
-            if (currentVertexID == targetVertexID)
+            std::size_t index = (home + i) & mask;
+            Entry&      entry = this->m_entries[index];
+
+            if (entry.m_iteration == this->m_iteration and entry.m_vertexID == vertexID)
+            {
+                // A deeper visit may have had its subtree cut by the depth limit,
+                // so it does not cover a shallower one with the same cost
+                if (not(cost < entry.m_cost) and entry.m_depth <= depth)
+                    return false;
+
+                entry.m_cost  = cost;
+                entry.m_depth = depth;
                 return true;
+            }
+
+            bool stale = entry.m_iteration != this->m_iteration;
+
+            if (stale and free == this->m_entries.Size())
+                free = index;
+        }
+
+        if (free == this->m_entries.Size())
+            free = home;
+
+        this->m_entries[free] = Entry{ vertexID, cost, depth, this->m_iteration };
+
+        return true;
+    }
+
+    /**
+     * @brief Iterative Deepening A* search on a frozen graph
+     *
+     * @param graph The frozen graph to be searched
+     * @param sourceID The ID of the source vertex
+     * @param targetID The ID of the target vertex
+     * @param estimate Callable estimate(v) returning an admissible estimate of the
+     * cost from vertex v to the target. It is called at most once per vertex
+     * @param path Receives the path found, its previous content is cleared
+     * @param maxDepth Largest number of edges of the path. Vertices at this depth
+     * are not expanded
+     * @param tableSize Number of entries of the transposition table. Zero disables
+     * the table
+     * @param stats Optional counters to be filled with the work done by the search
+     * @return The cost of the shortest path, or the maximum value of typeG if the
+     * target cannot be reached within the depth limit
+     *
+     * Each iteration is a depth-first search that prunes the vertices whose
+     * f = g + h exceeds a bound. The first bound is h(source), and each next bound
+     * is the smallest f that exceeded the previous one, so the first path found has
+     * the optimal cost. The depth-first search keeps an explicit stack of frames
+     * (vertex, next arc, cost), so it does not recurse and does not allocate per
+     * vertex. Vertices on the current path are skipped to avoid cycles.
+     */
+    template<typename typeG, typename Estimate>
+    inline typeG IDAStar(
+        const FrozenGraph<typeG>& graph,
+        std::size_t               sourceID,
+        std::size_t               targetID,
+        Estimate                  estimate,
+        PathResult<typeG>&        path,
+        std::size_t               maxDepth  = std::numeric_limits<std::size_t>::max(),
+        std::size_t               tableSize = 0,
+        SearchStatistics*         stats     = nullptr)
+    {
+        // Defines the infinity value for the typeG type
+        typeG INFINITY_VALUE = std::numeric_limits<typeG>::max();
+
+        std::size_t n = graph.GetNumVertices();
+
+        path.Clear();
+
+        if (sourceID >= n or targetID >= n)
+            return INFINITY_VALUE;
+
+        // The estimates do not change between iterations, so they are kept
+        Vector<double_t> heuristics(n, 0);
+        Vector<bool>     estimated(n, false);
+
+        auto Heuristic = [&](std::size_t v) -> double_t {
+            if (estimated[v])
+            {
+                if (stats)
+                    stats->m_heuristicCacheHits++;
+
+                return heuristics[v];
+            }
+
+            if (stats)
+                stats->m_heuristicEvaluations++;
+
+            estimated[v]  = true;
+            heuristics[v] = estimate(v);
+
+            return heuristics[v];
+        };
+
+        struct Frame
+        {
+                std::size_t m_vertexID;
+
+                // Next arc of the vertex to be followed
+                std::size_t m_arc;
 
-            if (depth <= 0)
-                return false;
+                typeG m_cost;
+        };
 
-            // Auxiliar variables to make code most legible
-            Vertex<typeG, typeT, typeD, nDim>* u = nullptr;
-            Vertex<typeG, typeT, typeD, nDim>* v = nullptr;
+        Vector<Frame>             stack;
+        Vector<bool>              onPath(n, false);
+        TranspositionTable<typeG> table(tableSize);
 
-            Edge<typeG, typeT, typeD, nDim>* uv;
+        double_t bound = Heuristic(sourceID);
+
+        while (true)
+        {
+            double_t next = std::numeric_limits<double_t>::infinity();
 
-            u = &graph.GetVertex(currentVertexID);
+            table.NextIteration();
+            table.Visit(sourceID, 0, 0);
 
-            u->SetLabel(label);
+            stack.Clear();
+            stack.PushBack(Frame{ sourceID, graph.GetFirstArc(sourceID), 0 });
+            onPath[sourceID] = true;
 
-            // Use priority queue to get the child with the smallest cost
-            bheap::PriorityQueue<Vertex<typeG, typeT, typeD, nDim>*,
-                                 decltype(compare::Vertex<typeG, typeT, typeD, nDim>)>
-                minPQueue;
+            if (stats)
+                stats->m_settledVertices++;
 
-            // Add all neighbors of vertex u to the priority queue
-            // Pair<first, second> = <ID, Edge>
-            for (auto& pair : u->GetAdjacencyList())
+            while (stack.Size() > 0 and stack[stack.Size() - 1].m_vertexID != targetID)
             {
-                // Edge uv (or vu, if is non-directed)
-                uv = pair.GetSecond();
+                Frame& top = stack[stack.Size() - 1];
+
+                // The depth of the top vertex is the number of frames below it
+                if (top.m_arc == graph.GetLastArc(top.m_vertexID) or
+                    stack.Size() > maxDepth)
+                {
+                    onPath[top.m_vertexID] = false;
+                    stack.PopBack();
+                    continue;
+                }
+
+                std::size_t arc = top.m_arc++;
+                std::size_t v   = graph.GetHead(arc);
 
-                v = GetAdjacentVertex(graph, u, uv);
+                if (stats)
+                    stats->m_relaxedEdges++;
 
-                if (v->GetLabel() != label)
+                if (onPath[v])
+                    continue;
+
+                typeG    cost = top.m_cost + graph.GetCost(arc);
+                double_t f    = static_cast<double_t>(cost) + Heuristic(v);
+
+                if (f > bound)
                 {
-                    v->SetHeuristicCost(
-                        CalculateHeuristic(heuristic,
-                                           v,
-                                           &graph.GetVertex(targetVertexID)));
-
-                    if (Relax(u, v, uv))
-                    {
-                        v->SetLabel(label);
-                        minPQueue.Push(v);
-                    }
+                    next = f < next ? f : next;
+                    continue;
                 }
-            }
 
-            while (not minPQueue.IsEmpty())
-            {
-                v = minPQueue.Dequeue();
+                // v is pushed on top of the frames of its ancestors
+                if (not table.Visit(v, cost, stack.Size()))
+                    continue;
 
-                if (IDAStar(graph, v->GetID(), targetVertexID, --depth, label))
-                    return true;
+                // top is not used after this point, since it may be moved
+                stack.PushBack(Frame{ v, graph.GetFirstArc(v), cost });
+                onPath[v] = true;
+
+                if (stats)
+                    stats->m_settledVertices++;
             }
 
-            return false;
+            if (stack.Size() > 0)
+                break;
+
+            // Nothing was cut by the bound, so the target cannot be reached
+            if (next == std::numeric_limits<double_t>::infinity())
+                return INFINITY_VALUE;
+
+            bound = next;
+        }
+
+        // The stack holds the path, and the arc that leads to each frame is the one
+        // before the cursor of the frame below it
+        for (std::size_t i = 0; i < stack.Size(); i++)
+        {
+            path.m_vertexIDs.PushBack(stack[i].m_vertexID);
+            path.m_costs.PushBack(stack[i].m_cost);
+
+            if (i > 0)
+                path.m_edgeIDs.PushBack(graph.GetEdgeID(stack[i - 1].m_arc - 1));
         }
-    } // namespace
+
+        return stack[stack.Size() - 1].m_cost;
+    }
 
     /**
-     * @brief Iterative Deepening A* search algorithm
+     * @brief Iterative Deepening A* search algorithm, with a heuristic given as a
+     * policy
      *
      * @param graph The graph to be traversed
      * @param startVertexID The start vertex
      * @param targetVertexID The target vertex
-     * @param maxDepth The maximum depth of the search
-     * @param heuristic The heuristic to be used
+     * @param maxDepth The maximum depth of the search, in number of edges
+     * @param heuristic Function object heuristic(v, t) that estimates the cost to
+     * reach the target vertex t from vertex v. It must be admissible
+     * @param stats Optional counters to be filled with the work done by the search
+     * @param tableSize Number of entries of the transposition table. Zero disables
+     * the table
      * @return True if the target vertex is reached, false otherwise
+     *
+     * The graph is frozen and searched by the FrozenGraph overload. The vertices on
+     * the path found store their cost and the edge to their predecessor, as done by
+     * AStar, so GetPath and PrintPath work as usual.
      **/
     template<typename typeG,
              typename typeT,
              std::size_t nDim,
              bool        directed,
-             typename typeD>
+             typename typeD,
+             typename Policy>
+    requires heuristics::distance::HeuristicPolicy<Policy, typeG, typeT, typeD, nDim>
     inline bool IDAStar(Graph<typeG, typeT, typeD, nDim, directed>& graph,
                         std::size_t                                 startVertexID,
                         std::size_t                                 targetVertexID,
                         std::size_t                                 maxDepth,
-                        heuristics::distance::Heuristic             heuristic =
-                            heuristics::distance::Heuristic::EUCLIDEAN)
+                        Policy                                      heuristic,
+                        SearchStatistics*                           stats     = nullptr,
+                        std::size_t                                 tableSize = 0)
     {
         typeG INFINITY_VALUE = std::numeric_limits<typeG>::max();
 
-        // Set the current cost of all vertices to infinity
+        if (not(graph.ContainsVertex(startVertexID) and
+                graph.ContainsVertex(targetVertexID)))
+            return false;
+
+        FrozenGraph<typeG> frozen(graph);
+
+        Vector<Vertex<typeG, typeT, typeD, nDim>*> vertices(frozen.GetNumVertices(),
+                                                            nullptr);
+
+        // Pair<first, second> = <ID, Vertex>
         for (auto& pair : graph.GetVertices())
+        {
             pair.GetSecond().SetCurrentCost(INFINITY_VALUE);
+            pair.GetSecond().SetEdge2Predecessor(nullptr);
+            vertices[pair.GetFirst()] = &pair.GetSecond();
+        }
 
-        graph.GetVertex(startVertexID).SetCurrentCost(0);
+        Vertex<typeG, typeT, typeD, nDim>* target = vertices[targetVertexID];
 
-        for (std::size_t i = 0; i < maxDepth; i++)
-        {
-            if (IDAStar(graph, startVertexID, targetVertexID, i, i, heuristic))
-                return true;
+        PathResult<typeG> path;
 
-            // Reset the costs of the vertices
-            for (auto& pair : graph.GetVertices())
-                pair.GetSecond().SetCurrentCost(INFINITY_VALUE);
+        typeG cost = IDAStar(
+            frozen,
+            startVertexID,
+            targetVertexID,
+            [&](std::size_t v) -> double_t { return heuristic(vertices[v], target); },
+            path,
+            maxDepth,
+            tableSize,
+            stats);
+
+        if (cost == INFINITY_VALUE)
+            return false;
+
+        for (std::size_t i = 0; i < path.m_vertexIDs.Size(); i++)
+        {
+            vertices[path.m_vertexIDs[i]]->SetCurrentCost(path.m_costs[i]);
 
-            // Set the cost of the start vertex to 0
-            graph.GetVertex(startVertexID).SetCurrentCost(0);
+            if (i > 0)
+                vertices[path.m_vertexIDs[i]]->SetEdge2Predecessor(
+                    graph.GetEdges().Get(path.m_edgeIDs[i - 1]));
         }
 
-        return false;
+        return true;
+    }
+
+    /**
+     * @brief Iterative Deepening A* search algorithm
+     *
+     * @param graph The graph to be traversed
+     * @param startVertexID The start vertex
+     * @param targetVertexID The target vertex
+     * @param maxDepth The maximum depth of the search, in number of edges
+     * @param heuristic The heuristic to be used. It is dispatched to its policy
+     * once, before the search starts
+     * @param stats Optional counters to be filled with the work done by the search
+     * @param tableSize Number of entries of the transposition table. Zero disables
+     * the table
+     * @return True if the target vertex is reached, false otherwise
+     **/
+    template<typename typeG,
+             typename typeT,
+             std::size_t nDim,
+             bool        directed,
+             typename typeD>
+    inline bool IDAStar(Graph<typeG, typeT, typeD, nDim, directed>& graph,
+                        std::size_t                                 startVertexID,
+                        std::size_t                                 targetVertexID,
+                        std::size_t                                 maxDepth,
+                        heuristics::distance::Heuristic             heuristic =
+                            heuristics::distance::Heuristic::EUCLIDEAN,
+                        SearchStatistics* stats     = nullptr,
+                        std::size_t       tableSize = 0)
+    {
+        return heuristics::distance::Dispatch(heuristic, [&](auto policy) {
+            return IDAStar(graph,
+                           startVertexID,
+                           targetVertexID,
+                           maxDepth,
+                           policy,
+                           stats,
+                           tableSize);
+        });
     }
 } // namespace graph
 
@@ -7,79 +7,340 @@
 #ifndef IDDFS_H_
 #define IDDFS_H_
 
+#include <atomic>
 #include <cstddef>
+#include <limits>
+#include <memory>
 
+#include "vector.h"
+
+#include "frozen_graph.h"
 #include "graph.h"
 #include "graph_utils.h"
+#include "parallel.h"
+#include "vertex.h"
 
 namespace graph
 {
     namespace
     {
         /**
-         * @brief Recursive function that performs the Iterative Deepening Depth First
-         * Search
-         * @param graph The graph to be traversed
-         * @param currentVertexID The current vertex being visited
-         * @param targetVertexID The target vertex to be reached
-         * @param depth The current depth of the search
-         * @param label The current label of the search
-         * @return True if the target vertex is reached, false otherwise
+         * @brief State of the depth-limited searches of a thread, reused by all the
+         * iterations of an IDDFS query so they do not allocate
+         *
+         * The stack holds one frame per vertex of the current path, with the next
+         * arc of the vertex to be followed, and the vertices of the current path are
+         * marked in a dense vector so cycles are skipped in O(1).
          */
-        template<typename typeG,
-                 typename typeT,
-                 typename typeD,
-                 std::size_t nDim,
-                 bool        directed>
-        inline bool IDDFS(Graph<typeG, typeT, typeD, nDim, directed>& graph,
-                          std::size_t                                 currentVertexID,
-                          std::size_t                                 targetVertexID,
-                          std::size_t                                 depth,
-                          std::size_t                                 label)
+        struct DepthLimitedWorkspace
         {
-            if (currentVertexID == targetVertexID)
-                return true;
+                struct Frame
+                {
+                        std::size_t m_vertexID;
+
+                        // Next arc of the vertex to be followed
+                        std::size_t m_arc;
+                };
 
-            if (depth <= 0)
-                return false;
+                Vector<Frame> m_stack;
+                Vector<bool>  m_onPath;
 
-            // Auxiliar variables to make code most legible
-            Vertex<typeG, typeT, typeD, nDim>* u = nullptr;
-            Vertex<typeG, typeT, typeD, nDim>* v = nullptr;
+                /**
+                 * @brief Empty the stack and size the marks for a graph
+                 * @param numVertices Size of the vertex ID space of the graph
+                 */
+                void Reset(std::size_t numVertices)
+                {
+                    while (this->m_stack.Size() > 0)
+                    {
+                        std::size_t top = this->m_stack.Size() - 1;
 
-            Edge<typeG, typeT, typeD, nDim>* uv;
+                        this->m_onPath[this->m_stack[top].m_vertexID] = false;
+                        this->m_stack.PopBack();
+                    }
 
-            u = &graph.GetVertex(currentVertexID);
+                    if (this->m_onPath.Size() != numVertices)
+                        this->m_onPath = Vector<bool>(numVertices, false);
+                }
+        };
 
-            u->SetLabel(label);
+        /**
+         * @brief Depth-limited search from the frames already on the stack of a
+         * workspace
+         * @param graph The frozen graph to be searched
+         * @param targetID The ID of the target vertex
+         * @param limit Largest depth, in number of edges, of the vertices expanded
+         * @param workspace The workspace whose stack holds the path to resume from
+         * @param base The search ends when the stack shrinks to this size
+         * @param cancel Set by another thread when the search can stop
+         * @param cut Set to true if a vertex with arcs was not expanded because of
+         * the limit, so a deeper iteration can reach more vertices
+         * @param stats Counters of the work done, or nullptr
+         * @return True if the target is on the top of the stack, false if the search
+         * ended or was cancelled
+         */
+        template<typename typeG>
+        inline bool DepthLimited(const FrozenGraph<typeG>& graph,
+                                 std::size_t               targetID,
+                                 std::size_t               limit,
+                                 DepthLimitedWorkspace&    workspace,
+                                 std::size_t               base,
+                                 const std::atomic<bool>&  cancel,
+                                 bool&                     cut,
+                                 SearchStatistics*         stats)
+        {
+            Vector<DepthLimitedWorkspace::Frame>& stack = workspace.m_stack;
 
-            // Pair<first, second> = <ID, Edge>
-            for (auto& pair : u->GetAdjacencyList())
+            while (stack.Size() > base)
             {
-                // Edge uv (or vu, if is non-directed)
-                uv = pair.GetSecond();
+                DepthLimitedWorkspace::Frame& top = stack[stack.Size() - 1];
+
+                if (top.m_vertexID == targetID)
+                    return true;
 
-                v = GetAdjacentVertex(graph, u, uv);
+                std::size_t last = graph.GetLastArc(top.m_vertexID);
 
-                if (v->GetLabel() != label)
+                // The depth of the top vertex is the number of frames below it
+                if (stack.Size() > limit and top.m_arc < last)
+                    cut = true;
+
+                if (stack.Size() > limit or top.m_arc == last)
                 {
-                    if (IDDFS(graph, v->GetID(), targetVertexID, --depth, label))
-                        return true;
+                    workspace.m_onPath[top.m_vertexID] = false;
+                    stack.PopBack();
+                    continue;
                 }
+
+                std::size_t v = graph.GetHead(top.m_arc++);
+
+                if (stats)
+                    stats->m_relaxedEdges++;
+
+                if (workspace.m_onPath[v])
+                    continue;
+
+                if (cancel.load(std::memory_order_relaxed))
+                    return false;
+
+                // top is not used after this point, since it may be moved
+                stack.PushBack(
+                    DepthLimitedWorkspace::Frame{ v, graph.GetFirstArc(v) });
+                workspace.m_onPath[v] = true;
+
+                if (stats)
+                    stats->m_settledVertices++;
             }
 
             return false;
         }
+
+        /**
+         * @brief Copy the path on the stack of a workspace to a path result
+         */
+        template<typename typeG>
+        inline void CopyStackPath(const FrozenGraph<typeG>&    graph,
+                                  const DepthLimitedWorkspace& workspace,
+                                  PathResult<typeG>&           path)
+        {
+            const Vector<DepthLimitedWorkspace::Frame>& stack = workspace.m_stack;
+
+            path.Clear();
+
+            typeG cost = 0;
+
+            for (std::size_t i = 0; i < stack.Size(); i++)
+            {
+                // The arc that leads to each frame is the one before the cursor of
+                // the frame below it
+                if (i > 0)
+                {
+                    std::size_t arc = stack[i - 1].m_arc - 1;
+
+                    cost += graph.GetCost(arc);
+                    path.m_edgeIDs.PushBack(graph.GetEdgeID(arc));
+                }
+
+                path.m_vertexIDs.PushBack(stack[i].m_vertexID);
+                path.m_costs.PushBack(cost);
+            }
+        }
     } // namespace
 
+    /**
+     * @brief Iterative Deepening Depth First Search on a frozen graph
+     *
+     * @param graph The frozen graph to be searched
+     * @param sourceID The ID of the source vertex
+     * @param targetID The ID of the target vertex
+     * @param path Receives the path found, its previous content is cleared
+     * @param maxDepth Largest number of edges of the path
+     * @param numThreads Number of threads to be used. Zero means one thread per
+     * hardware thread
+     * @param stats Optional counters to be filled with the work done by the search
+     * @return The number of edges of the path with fewest edges, or the maximum value
+     * of std::size_t if the target cannot be reached within the depth limit
+     *
+     * Iteration L runs a depth-limited search that expands the vertices up to depth
+     * L, for L = 0, 1, ..., maxDepth, skipping the vertices on the current path. The
+     * searches use an explicit stack, so deep graphs do not overflow the call stack,
+     * and the iterations stop early when no vertex was cut by the limit, since a
+     * deeper one would search the same paths.
+     *
+     * With more than one thread, the children of the source are split among the
+     * threads in each iteration, each thread with its own workspace. The first
+     * thread to reach the target raises a flag that the others check before each
+     * push, so they stop within one vertex. All the paths of an iteration have the
+     * same number of edges, so the result does not depend on which thread wins,
+     * although the path may.
+     *
+     * Complexity: O(b^d), where b is the branching factor and d is the depth of the
+     * shallowest solution
+     */
+    template<typename typeG>
+    inline std::size_t IDDFS(
+        const FrozenGraph<typeG>& graph,
+        std::size_t               sourceID,
+        std::size_t               targetID,
+        PathResult<typeG>&        path,
+        std::size_t               maxDepth   = std::numeric_limits<std::size_t>::max(),
+        std::size_t               numThreads = 1,
+        SearchStatistics*         stats      = nullptr)
+    {
+        constexpr std::size_t NO_PATH = std::numeric_limits<std::size_t>::max();
+
+        std::size_t n = graph.GetNumVertices();
+
+        path.Clear();
+
+        if (sourceID >= n or targetID >= n)
+            return NO_PATH;
+
+        std::size_t first       = graph.GetFirstArc(sourceID);
+        std::size_t numChildren = graph.GetLastArc(sourceID) - first;
+
+        numThreads = parallel::GetNumThreads(numThreads);
+        numThreads = numThreads < numChildren ? numThreads : numChildren;
+        numThreads = numThreads > 1 ? numThreads : 1;
+
+        std::unique_ptr<DepthLimitedWorkspace[]> workspaces(
+            new DepthLimitedWorkspace[numThreads]);
+        Vector<SearchStatistics> counters(numThreads);
+
+        std::atomic<bool> found(false);
+
+        // Index of the workspace whose stack holds the path found
+        std::size_t winner = 0;
+
+        for (std::size_t limit = 0; limit <= maxDepth and not found; limit++)
+        {
+            bool cut = false;
+
+            if (numThreads == 1 or limit == 0)
+            {
+                DepthLimitedWorkspace& workspace = workspaces[0];
+
+                workspace.Reset(n);
+                workspace.m_stack.PushBack(
+                    DepthLimitedWorkspace::Frame{ sourceID, first });
+                workspace.m_onPath[sourceID] = true;
+
+                if (stats)
+                    stats->m_settledVertices++;
+
+                found = DepthLimited(
+                    graph, targetID, limit, workspace, 0, found, cut, stats);
+            }
+            else
+            {
+                std::atomic<bool> anyCut(false);
+
+                parallel::For(
+                    numChildren,
+                    [&](std::size_t child, std::size_t threadIndex) {
+                        DepthLimitedWorkspace& workspace = workspaces[threadIndex];
+
+                        std::size_t v = graph.GetHead(first + child);
+
+                        if (v == sourceID or found.load(std::memory_order_relaxed))
+                            return;
+
+                        // The source frame is left past the child's arc, so the
+                        // path can be copied as usual
+                        workspace.Reset(n);
+                        workspace.m_stack.PushBack(DepthLimitedWorkspace::Frame{
+                            sourceID, first + child + 1 });
+                        workspace.m_stack.PushBack(
+                            DepthLimitedWorkspace::Frame{ v, graph.GetFirstArc(v) });
+                        workspace.m_onPath[sourceID] = true;
+                        workspace.m_onPath[v]        = true;
+
+                        SearchStatistics& counter = counters[threadIndex];
+
+                        counter.m_settledVertices++;
+                        counter.m_relaxedEdges++;
+
+                        bool threadCut = false;
+                        bool reached   = DepthLimited(graph,
+                                                    targetID,
+                                                    limit,
+                                                    workspace,
+                                                    1,
+                                                    found,
+                                                    threadCut,
+                                                    &counter);
+
+                        if (reached and not found.exchange(true))
+                            winner = threadIndex;
+
+                        if (threadCut)
+                            anyCut = true;
+                    },
+                    numThreads);
+
+                cut = anyCut;
+
+                if (stats)
+                    stats->m_settledVertices++;
+            }
+
+            // Nothing was cut by the limit, so the target cannot be reached
+            if (not found and not cut)
+                break;
+        }
+
+        if (stats)
+        {
+            for (std::size_t t = 0; t < numThreads; t++)
+            {
+                stats->m_settledVertices += counters[t].m_settledVertices;
+                stats->m_relaxedEdges += counters[t].m_relaxedEdges;
+            }
+        }
+
+        if (not found)
+            return NO_PATH;
+
+        CopyStackPath(graph, workspaces[winner], path);
+
+        return path.m_vertexIDs.Size() - 1;
+    }
+
     /**
      * @brief Iterative Deepening Depth First Search
      * @param graph The graph to be traversed
      * @param startVertexID The start vertex
      * @param targetVertexID The target vertex
-     * @param maxDepth The maximum depth of the search
+     * @param maxDepth The maximum depth of the search, in number of edges
+     * @param numThreads Number of threads to be used. Zero means one thread per
+     * hardware thread
+     * @param stats Optional counters to be filled with the work done by the search
      * @return True if the target vertex is reached, false otherwise
      *
+     * The graph is frozen and searched by the FrozenGraph overload. The vertices on
+     * the path found store their number of edges from the start vertex as their
+     * cost and the edge to their predecessor, so GetPath and PrintPath work as
+     * usual.
+     *
      * Complexity: O(b^d), where b is the branching factor and d is the depth of the
      * shallowest solution
      */
@@ -91,17 +352,46 @@ namespace graph
     inline bool IDDFS(Graph<typeG, typeT, typeD, nDim, directed>& graph,
                       std::size_t                                 startVertexID,
                       std::size_t                                 targetVertexID,
-                      std::size_t                                 maxDepth)
+                      std::size_t                                 maxDepth,
+                      std::size_t                                 numThreads = 1,
+                      SearchStatistics*                           stats      = nullptr)
     {
-        for (std::size_t i = 0; i < maxDepth; i++)
+        typeG INFINITY_VALUE = std::numeric_limits<typeG>::max();
+
+        if (not(graph.ContainsVertex(startVertexID) and
+                graph.ContainsVertex(targetVertexID)))
+            return false;
+
+        FrozenGraph<typeG> frozen(graph);
+
+        // Pair<first, second> = <ID, Vertex>
+        for (auto& pair : graph.GetVertices())
         {
-            if (IDDFS(graph, startVertexID, targetVertexID, i, i))
-            {
-                return true;
-            }
+            pair.GetSecond().SetCurrentCost(INFINITY_VALUE);
+            pair.GetSecond().SetEdge2Predecessor(nullptr);
+        }
+
+        PathResult<typeG> path;
+
+        std::size_t depth = IDDFS(
+            frozen, startVertexID, targetVertexID, path, maxDepth, numThreads, stats);
+
+        if (depth == std::numeric_limits<std::size_t>::max())
+            return false;
+
+        for (std::size_t i = 0; i < path.m_vertexIDs.Size(); i++)
+        {
+            Vertex<typeG, typeT, typeD, nDim>& vertex =
+                graph.GetVertex(path.m_vertexIDs[i]);
+
+            vertex.SetCurrentCost(i);
+
+            if (i > 0)
+                vertex.SetEdge2Predecessor(
+                    graph.GetEdges().Get(path.m_edgeIDs[i - 1]));
         }
 
-        return false;
+        return true;
     }
 } // namespace graph
 
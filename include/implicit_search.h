@@ -0,0 +1,932 @@
+/*
+ * Filename: implicit_search.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef IMPLICIT_SEARCH_H_
+#define IMPLICIT_SEARCH_H_
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <type_traits>
+
+#include "pair.h"
+#include "priority_queue_bheap.h"
+#include "vector.h"
+
+#include "graph_utils.h"
+
+namespace graph
+{
+    /**
+     * Searches over implicit graphs, whose vertices are states generated on demand
+     * instead of Vertex objects. A search is described by callables:
+     *
+     *      successors(state, emit)  calls emit(next, cost) for each move
+     *      isGoal(state)            true for the states that end the search
+     *      hash(state)              64-bit hash of a state
+     *      heuristic(state)         admissible estimate of the cost to a goal
+     *
+     * States are compared with Equal, std::equal_to<State> by default, and must be
+     * default constructible and copyable. The states reached by a search are kept in
+     * an Arena and indexed by an open addressing StateSet, so no Vertex or Edge is
+     * ever created.
+     */
+    namespace implicit
+    {
+        // Default limit of the number of states or of the depth of a search
+        constexpr std::size_t UNLIMITED = std::numeric_limits<std::size_t>::max();
+
+        /**
+         * @brief Append-only storage of objects in fixed-size blocks
+         *
+         * @tparam T The type of the objects
+         *
+         * Objects are identified by their index, in allocation order. Blocks are
+         * never moved, so references to the objects stay valid while new objects
+         * are allocated, and growing does not copy the objects already stored.
+         */
+        template<typename T>
+        class Arena
+        {
+            private:
+                // Number of objects per block, a power of two
+                static constexpr std::size_t BLOCK_BITS = 12;
+                static constexpr std::size_t BLOCK_SIZE = std::size_t(1) << BLOCK_BITS;
+
+                Vector<T*>  m_blocks;
+                std::size_t m_size;
+
+            public:
+                Arena();
+                ~Arena();
+
+                Arena(const Arena&)            = delete;
+                Arena& operator=(const Arena&) = delete;
+
+                /**
+                 * @brief Store a copy of an object
+                 * @return The index of the new object
+                 */
+                std::size_t Allocate(const T& value);
+
+                T&       operator[](std::size_t index);
+                const T& operator[](std::size_t index) const;
+
+                /**
+                 * @return The number of objects stored
+                 */
+                std::size_t Size() const;
+
+                /**
+                 * @brief Remove all the objects, keeping the blocks for reuse
+                 */
+                void Clear();
+        };
+
+        template<typename T>
+        Arena<T>::Arena()
+        {
+            this->m_size = 0;
+        }
+
+        template<typename T>
+        Arena<T>::~Arena()
+        {
+            for (std::size_t i = 0; i < this->m_blocks.Size(); i++)
+                delete[] this->m_blocks[i];
+        }
+
+        template<typename T>
+        std::size_t Arena<T>::Allocate(const T& value)
+        {
+            if ((this->m_size >> BLOCK_BITS) == this->m_blocks.Size())
+                this->m_blocks.PushBack(new T[BLOCK_SIZE]);
+
+            (*this)[this->m_size] = value;
+
+            return this->m_size++;
+        }
+
+        template<typename T>
+        T& Arena<T>::operator[](std::size_t index)
+        {
+            return this->m_blocks[index >> BLOCK_BITS][index & (BLOCK_SIZE - 1)];
+        }
+
+        template<typename T>
+        const T& Arena<T>::operator[](std::size_t index) const
+        {
+            return this->m_blocks[index >> BLOCK_BITS][index & (BLOCK_SIZE - 1)];
+        }
+
+        template<typename T>
+        std::size_t Arena<T>::Size() const
+        {
+            return this->m_size;
+        }
+
+        template<typename T>
+        void Arena<T>::Clear()
+        {
+            this->m_size = 0;
+        }
+
+        /**
+         * @brief Set of states that gives each state a dense ID
+         *
+         * @tparam State The type of the states
+         * @tparam Hash Callable hash(state) returning a 64-bit hash
+         * @tparam Equal Callable equal(a, b) telling whether two states are the same
+         *
+         * The states are stored in an Arena, in insertion order, so their IDs are
+         * consecutive and can index other arenas. The index is an open addressing
+         * table with linear probing whose slots hold the full hash and the ID of a
+         * state, so most probes do not touch the states and growing does not hash
+         * them again. The table doubles when it is three quarters full.
+         */
+        template<typename State, typename Hash, typename Equal = std::equal_to<State>>
+        class StateSet
+        {
+            public:
+                // Marks a missing state
+                static constexpr std::size_t NO_STATE =
+                    std::numeric_limits<std::size_t>::max();
+
+            private:
+                struct Slot
+                {
+                        uint64_t    m_hash;
+                        std::size_t m_id;
+                };
+
+                Arena<State> m_states;
+                Vector<Slot> m_slots;
+                std::size_t  m_shift;
+
+                Hash  m_hash;
+                Equal m_equal;
+
+                /**
+                 * @brief First slot probed for a hash
+                 */
+                std::size_t Home(uint64_t hash) const;
+
+                /**
+                 * @brief Double the number of slots
+                 */
+                void Grow();
+
+            public:
+                StateSet(Hash hash = Hash(), Equal equal = Equal());
+
+                /**
+                 * @brief Insert a state, unless an equal state is already in the set
+                 * @param state The state to be inserted
+                 * @param inserted Receives true if the state was not in the set
+                 * @return The ID of the state in the set
+                 */
+                std::size_t Insert(const State& state, bool& inserted);
+
+                /**
+                 * @return The ID of a state equal to the given one, or NO_STATE if
+                 * there is none
+                 */
+                std::size_t Find(const State& state) const;
+
+                /**
+                 * @return The state with the given ID
+                 */
+                const State& operator[](std::size_t id) const;
+
+                /**
+                 * @return The number of states in the set
+                 */
+                std::size_t Size() const;
+
+                /**
+                 * @brief Remove all the states, keeping the memory for reuse
+                 */
+                void Clear();
+        };
+
+        template<typename State, typename Hash, typename Equal>
+        StateSet<State, Hash, Equal>::StateSet(Hash hash, Equal equal)
+            : m_hash(hash), m_equal(equal)
+        {
+            this->m_slots = Vector<Slot>(16, Slot{ 0, NO_STATE });
+            this->m_shift = 64 - 4;
+        }
+
+        template<typename State, typename Hash, typename Equal>
+        std::size_t StateSet<State, Hash, Equal>::Home(uint64_t hash) const
+        {
+            // Fibonacci hashing, so weak hashes of the caller are spread as well
+            return (hash * UINT64_C(0x9E3779B97F4A7C15)) >> this->m_shift;
+        }
+
+        template<typename State, typename Hash, typename Equal>
+        void StateSet<State, Hash, Equal>::Grow()
+        {
+            Vector<Slot> slots(2 * this->m_slots.Size(), Slot{ 0, NO_STATE });
+
+            this->m_shift--;
+
+            std::size_t mask = slots.Size() - 1;
+
+            for (std::size_t i = 0; i < this->m_slots.Size(); i++)
+            {
+                if (this->m_slots[i].m_id == NO_STATE)
+                    continue;
+
+                std::size_t index = this->Home(this->m_slots[i].m_hash);
+
+                while (slots[index].m_id != NO_STATE)
+                    index = (index + 1) & mask;
+
+                slots[index] = this->m_slots[i];
+            }
+
+            this->m_slots = slots;
+        }
+
+        template<typename State, typename Hash, typename Equal>
+        std::size_t StateSet<State, Hash, Equal>::Insert(const State& state,
+                                                         bool&        inserted)
+        {
+            if (4 * (this->m_states.Size() + 1) > 3 * this->m_slots.Size())
+                this->Grow();
+
+            uint64_t    hash  = this->m_hash(state);
+            std::size_t mask  = this->m_slots.Size() - 1;
+            std::size_t index = this->Home(hash);
+
+            for (; this->m_slots[index].m_id != NO_STATE; index = (index + 1) & mask)
+            {
+                const Slot& slot = this->m_slots[index];
+
+                if (slot.m_hash == hash and
+                    this->m_equal(this->m_states[slot.m_id], state))
+                {
+                    inserted = false;
+                    return slot.m_id;
+                }
+            }
+
+            inserted             = true;
+            this->m_slots[index] = Slot{ hash, this->m_states.Allocate(state) };
+
+            return this->m_slots[index].m_id;
+        }
+
+        template<typename State, typename Hash, typename Equal>
+        std::size_t StateSet<State, Hash, Equal>::Find(const State& state) const
+        {
+            uint64_t    hash  = this->m_hash(state);
+            std::size_t mask  = this->m_slots.Size() - 1;
+            std::size_t index = this->Home(hash);
+
+            for (; this->m_slots[index].m_id != NO_STATE; index = (index + 1) & mask)
+            {
+                const Slot& slot = this->m_slots[index];
+
+                if (slot.m_hash == hash and
+                    this->m_equal(this->m_states[slot.m_id], state))
+                    return slot.m_id;
+            }
+
+            return NO_STATE;
+        }
+
+        template<typename State, typename Hash, typename Equal>
+        const State& StateSet<State, Hash, Equal>::operator[](std::size_t id) const
+        {
+            return this->m_states[id];
+        }
+
+        template<typename State, typename Hash, typename Equal>
+        std::size_t StateSet<State, Hash, Equal>::Size() const
+        {
+            return this->m_states.Size();
+        }
+
+        template<typename State, typename Hash, typename Equal>
+        void StateSet<State, Hash, Equal>::Clear()
+        {
+            for (std::size_t i = 0; i < this->m_slots.Size(); i++)
+                this->m_slots[i].m_id = NO_STATE;
+
+            this->m_states.Clear();
+        }
+
+        /**
+         * @brief A path of states as plain data, the counterpart of PathResult for
+         * implicit graphs
+         */
+        template<typename State, typename typeG>
+        struct StatePath
+        {
+                // States from the start of the path to its goal
+                Vector<State> m_states;
+
+                // Cost from the start of the path up to each state
+                Vector<typeG> m_costs;
+
+                /**
+                 * @brief Remove the path, keeping the memory of the buffers
+                 */
+                void Clear()
+                {
+                    this->m_states.Clear();
+                    this->m_costs.Clear();
+                }
+        };
+
+        namespace
+        {
+            /**
+             * @brief Best-first search shared by UCS and AStar
+             * @param informed True if the heuristic must be counted in the
+             * statistics
+             *
+             * The key of a state is its cost plus its heuristic, in the common type
+             * of typeG and double_t, so narrow heuristics such as the uint8_t
+             * entries of a PatternDatabase neither wrap nor truncate the cost. Keys are pushed lazily and stale entries
+             * are skipped when popped. A state reached with a smaller cost after it
+             * was expanded is expanded again, so heuristics that are admissible but
+             * not consistent still give optimal costs.
+             */
+            template<typename Equal,
+                     typename State,
+                     typename typeG,
+                     typename Successors,
+                     typename Goal,
+                     typename Hash,
+                     typename Heuristic>
+            inline typeG BestFirst(const State&             start,
+                                   Successors&              successors,
+                                   Goal&                    isGoal,
+                                   Hash&                    hash,
+                                   Heuristic&               heuristic,
+                                   bool                     informed,
+                                   StatePath<State, typeG>& path,
+                                   std::size_t              maxStates,
+                                   SearchStatistics*        stats)
+            {
+                using typeK = std::common_type_t<typeG, double_t>;
+
+                constexpr std::size_t NO_STATE = StateSet<State, Hash, Equal>::NO_STATE;
+
+                // Defines the infinity value for the typeG type
+                typeG INFINITY_VALUE = std::numeric_limits<typeG>::max();
+
+                struct Info
+                {
+                        std::size_t m_parent;
+                        typeG       m_cost;
+                        typeK       m_heuristic;
+                        bool        m_closed;
+                };
+
+                StateSet<State, Hash, Equal> states(hash);
+                Arena<Info>                  infos;
+
+                // Pair<first, second> = <key, state ID>
+                bheap::PriorityQueue<Pair<typeK, std::size_t>,
+                                     decltype(compare::Key<typeK, std::size_t>)>
+                    queue;
+
+                auto Estimate = [&](const State& state) {
+                    if (informed and stats)
+                        stats->m_heuristicEvaluations++;
+
+                    return static_cast<typeK>(heuristic(state));
+                };
+
+                auto Key = [&](std::size_t id) {
+                    return static_cast<typeK>(infos[id].m_cost) + infos[id].m_heuristic;
+                };
+
+                path.Clear();
+
+                bool inserted;
+
+                states.Insert(start, inserted);
+                infos.Allocate(Info{ NO_STATE, 0, Estimate(start), false });
+                queue.Enqueue(Pair<typeK, std::size_t>(Key(0), 0));
+
+                std::size_t goal = NO_STATE;
+
+                while (not queue.IsEmpty())
+                {
+                    Pair<typeK, std::size_t> entry = queue.Dequeue();
+
+                    std::size_t u = entry.GetSecond();
+
+                    // Skip the entries left behind by a cost improvement
+                    if (infos[u].m_closed or entry.GetFirst() != Key(u))
+                        continue;
+
+                    infos[u].m_closed = true;
+
+                    if (stats)
+                        stats->m_settledVertices++;
+
+                    if (isGoal(states[u]))
+                    {
+                        goal = u;
+                        break;
+                    }
+
+                    typeG cost = infos[u].m_cost;
+
+                    // The arena keeps states[u] in place while successors are added
+                    successors(states[u], [&](const State& next, typeG moveCost) {
+                        if (stats)
+                            stats->m_relaxedEdges++;
+
+                        std::size_t v;
+
+                        if (states.Size() < maxStates)
+                            v = states.Insert(next, inserted);
+                        else if ((v = states.Find(next)) == NO_STATE)
+                            return;
+                        else
+                            inserted = false;
+
+                        if (inserted)
+                        {
+                            infos.Allocate(
+                                Info{ u, cost + moveCost, Estimate(next), false });
+                        }
+                        else
+                        {
+                            if (informed and stats)
+                                stats->m_heuristicCacheHits++;
+
+                            if (not(cost + moveCost < infos[v].m_cost))
+                                return;
+
+                            infos[v].m_parent = u;
+                            infos[v].m_cost   = cost + moveCost;
+                            infos[v].m_closed = false;
+                        }
+
+                        queue.Enqueue(Pair<typeK, std::size_t>(Key(v), v));
+                    });
+                }
+
+                if (goal == NO_STATE)
+                    return INFINITY_VALUE;
+
+                for (std::size_t v = goal; v != NO_STATE; v = infos[v].m_parent)
+                {
+                    path.m_states.PushBack(states[v]);
+                    path.m_costs.PushBack(infos[v].m_cost);
+                }
+
+                for (std::size_t i = 0, j = path.m_states.Size(); i + 1 < j;)
+                {
+                    State state       = path.m_states[i];
+                    typeG cost        = path.m_costs[i];
+                    path.m_states[i]  = path.m_states[--j];
+                    path.m_costs[i++] = path.m_costs[j];
+                    path.m_states[j]  = state;
+                    path.m_costs[j]   = cost;
+                }
+
+                return infos[goal].m_cost;
+            }
+
+            /**
+             * @brief Iterative deepening on f = g + h shared by IDAStar and IDDFS
+             * @param unitCosts True to count every move as cost 1
+             * @param informed True if the heuristic must be counted in the
+             * statistics
+             *
+             * Each iteration is a depth-first search with an explicit stack. The
+             * successors of a state are generated once, when it is pushed, into a
+             * shared buffer where each frame owns the segment after its parent's, so
+             * the buffers are reused by all the iterations. States on the current
+             * path are skipped to avoid cycles, comparing their hashes first.
+             */
+            template<typename Equal,
+                     typename State,
+                     typename typeG,
+                     typename Successors,
+                     typename Goal,
+                     typename Hash,
+                     typename Heuristic>
+            inline typeG DepthFirst(const State&             start,
+                                    Successors&              successors,
+                                    Goal&                    isGoal,
+                                    Hash&                    hash,
+                                    Heuristic&               heuristic,
+                                    bool                     unitCosts,
+                                    bool                     informed,
+                                    StatePath<State, typeG>& path,
+                                    std::size_t              maxDepth,
+                                    SearchStatistics*        stats)
+            {
+                // Defines the infinity value for the typeG type
+                typeG INFINITY_VALUE = std::numeric_limits<typeG>::max();
+
+                struct Frame
+                {
+                        State    m_state;
+                        uint64_t m_hash;
+                        typeG    m_cost;
+
+                        // Segment of the buffer with the successors not yet followed
+                        std::size_t m_first;
+                        std::size_t m_next;
+                };
+
+                struct Child
+                {
+                        State m_state;
+                        typeG m_cost;
+                };
+
+                Vector<Frame> stack;
+                Vector<Child> children;
+                Equal         equal;
+
+                bool found = isGoal(start);
+
+                auto Estimate = [&](const State& state) -> double_t {
+                    if (informed and stats)
+                        stats->m_heuristicEvaluations++;
+
+                    return static_cast<double_t>(heuristic(state));
+                };
+
+                // Push a state and generate its successors, unless it is a goal or
+                // it is at the depth limit
+                auto Push = [&](const State& state, uint64_t stateHash, typeG cost) {
+                    std::size_t first = children.Size();
+
+                    stack.PushBack(Frame{ state, stateHash, cost, first, first });
+
+                    if (found or stack.Size() > maxDepth)
+                        return;
+
+                    if (stats)
+                        stats->m_settledVertices++;
+
+                    successors(state, [&](const State& next, typeG moveCost) {
+                        if (stats)
+                            stats->m_relaxedEdges++;
+
+                        typeG cost = unitCosts ? typeG(1) : moveCost;
+
+                        children.PushBack(Child{ next, cost });
+                    });
+                };
+
+                path.Clear();
+
+                double_t bound = Estimate(start);
+
+                while (true)
+                {
+                    double_t next = std::numeric_limits<double_t>::infinity();
+
+                    stack.Clear();
+                    children.Clear();
+
+                    Push(start, hash(start), 0);
+
+                    while (not found and stack.Size() > 0)
+                    {
+                        Frame& top = stack[stack.Size() - 1];
+
+                        if (top.m_next == children.Size())
+                        {
+                            while (children.Size() > top.m_first)
+                                children.PopBack();
+
+                            stack.PopBack();
+                            continue;
+                        }
+
+                        // Copied, since pushing may move the buffer
+                        Child child = children[top.m_next++];
+                        typeG cost  = top.m_cost + child.m_cost;
+
+                        uint64_t childHash = hash(child.m_state);
+                        bool     onPath    = false;
+
+                        for (std::size_t i = 0; i < stack.Size() and not onPath; i++)
+                            onPath = stack[i].m_hash == childHash and
+                                     equal(stack[i].m_state, child.m_state);
+
+                        if (onPath)
+                            continue;
+
+                        double_t f =
+                            static_cast<double_t>(cost) + Estimate(child.m_state);
+
+                        if (f > bound)
+                        {
+                            next = f < next ? f : next;
+                            continue;
+                        }
+
+                        found = isGoal(child.m_state);
+
+                        Push(child.m_state, childHash, cost);
+                    }
+
+                    if (found)
+                        break;
+
+                    // Nothing was cut by the bound, so no goal can be reached
+                    if (next == std::numeric_limits<double_t>::infinity())
+                        return INFINITY_VALUE;
+
+                    bound = next;
+                }
+
+                for (std::size_t i = 0; i < stack.Size(); i++)
+                {
+                    path.m_states.PushBack(stack[i].m_state);
+                    path.m_costs.PushBack(stack[i].m_cost);
+                }
+
+                return stack[stack.Size() - 1].m_cost;
+            }
+        } // namespace
+
+        /**
+         * @brief Breadth-First Search on an implicit graph
+         * @param start The state where the search starts
+         * @param successors Callable successors(state, emit) that calls
+         * emit(next, cost) for each move. The costs are ignored
+         * @param isGoal Callable isGoal(state), true for the goal states
+         * @param hash Callable hash(state) returning a 64-bit hash
+         * @param path Receives the path found, its previous content is cleared. Its
+         * costs are numbers of moves
+         * @param maxStates Largest number of states to be stored. The states not
+         * stored are not searched
+         * @param stats Optional counters to be filled with the work done
+         * @return The number of moves of the shortest path to a goal, or the maximum
+         * value of typeG if no goal was found
+         *
+         * The states are stored in the order they are discovered, which is the BFS
+         * order, so the range of state IDs is the queue and no queue is allocated.
+         *
+         * Complexity: O(V + E), when V is the number of states stored and E is the
+         * number of moves generated
+         */
+        template<typename State,
+                 typename typeG,
+                 typename Successors,
+                 typename Goal,
+                 typename Hash,
+                 typename Equal = std::equal_to<State>>
+        inline typeG BFS(const State&             start,
+                         Successors               successors,
+                         Goal                     isGoal,
+                         Hash                     hash,
+                         StatePath<State, typeG>& path,
+                         std::size_t       maxStates = UNLIMITED,
+                         SearchStatistics* stats     = nullptr)
+        {
+            constexpr std::size_t NO_STATE = StateSet<State, Hash, Equal>::NO_STATE;
+
+            // Defines the infinity value for the typeG type
+            typeG INFINITY_VALUE = std::numeric_limits<typeG>::max();
+
+            StateSet<State, Hash, Equal> states(hash);
+            Arena<std::size_t>           parents;
+
+            path.Clear();
+
+            bool inserted;
+
+            states.Insert(start, inserted);
+            parents.Allocate(NO_STATE);
+
+            std::size_t goal = isGoal(start) ? 0 : NO_STATE;
+
+            for (std::size_t u = 0; u < states.Size() and goal == NO_STATE; u++)
+            {
+                if (stats)
+                    stats->m_settledVertices++;
+
+                successors(states[u], [&](const State& next, typeG) {
+                    if (stats)
+                        stats->m_relaxedEdges++;
+
+                    if (goal != NO_STATE or states.Size() >= maxStates)
+                        return;
+
+                    std::size_t v = states.Insert(next, inserted);
+
+                    if (not inserted)
+                        return;
+
+                    parents.Allocate(u);
+
+                    if (isGoal(next))
+                        goal = v;
+                });
+            }
+
+            if (goal == NO_STATE)
+                return INFINITY_VALUE;
+
+            for (std::size_t v = goal; v != NO_STATE; v = parents[v])
+                path.m_states.PushBack(states[v]);
+
+            for (std::size_t i = 0, j = path.m_states.Size(); i + 1 < j;)
+            {
+                State state        = path.m_states[i];
+                path.m_states[i++] = path.m_states[--j];
+                path.m_states[j]   = state;
+            }
+
+            for (std::size_t i = 0; i < path.m_states.Size(); i++)
+                path.m_costs.PushBack(typeG(i));
+
+            return typeG(path.m_states.Size() - 1);
+        }
+
+        /**
+         * @brief Uniform Cost Search on an implicit graph
+         * @param start The state where the search starts
+         * @param successors Callable successors(state, emit) that calls
+         * emit(next, cost) for each move. The costs must not be negative
+         * @param isGoal Callable isGoal(state), true for the goal states
+         * @param hash Callable hash(state) returning a 64-bit hash
+         * @param path Receives the path found, its previous content is cleared
+         * @param maxStates Largest number of states to be stored. The states not
+         * stored are not searched
+         * @param stats Optional counters to be filled with the work done
+         * @return The cost of the cheapest path to a goal, or the maximum value of
+         * typeG if no goal was found
+         */
+        template<typename State,
+                 typename typeG,
+                 typename Successors,
+                 typename Goal,
+                 typename Hash,
+                 typename Equal = std::equal_to<State>>
+        inline typeG UCS(const State&             start,
+                         Successors               successors,
+                         Goal                     isGoal,
+                         Hash                     hash,
+                         StatePath<State, typeG>& path,
+                         std::size_t       maxStates = UNLIMITED,
+                         SearchStatistics* stats     = nullptr)
+        {
+            auto zero = [](const State&) { return typeG(0); };
+
+            return BestFirst<Equal>(
+                start, successors, isGoal, hash, zero, false, path, maxStates, stats);
+        }
+
+        /**
+         * @brief A* search on an implicit graph
+         * @param start The state where the search starts
+         * @param successors Callable successors(state, emit) that calls
+         * emit(next, cost) for each move. The costs must not be negative
+         * @param isGoal Callable isGoal(state), true for the goal states
+         * @param hash Callable hash(state) returning a 64-bit hash
+         * @param heuristic Callable heuristic(state) returning an admissible estimate
+         * of the cost to a goal. It is called once per stored state
+         * @param path Receives the path found, its previous content is cleared
+         * @param maxStates Largest number of states to be stored. The states not
+         * stored are not searched
+         * @param stats Optional counters to be filled with the work done
+         * @return The cost of the cheapest path to a goal, or the maximum value of
+         * typeG if no goal was found
+         */
+        template<typename State,
+                 typename typeG,
+                 typename Successors,
+                 typename Goal,
+                 typename Hash,
+                 typename Heuristic,
+                 typename Equal = std::equal_to<State>>
+        inline typeG AStar(const State&             start,
+                           Successors               successors,
+                           Goal                     isGoal,
+                           Hash                     hash,
+                           Heuristic                heuristic,
+                           StatePath<State, typeG>& path,
+                           std::size_t       maxStates = UNLIMITED,
+                           SearchStatistics* stats     = nullptr)
+        {
+            return BestFirst<Equal>(start,
+                                    successors,
+                                    isGoal,
+                                    hash,
+                                    heuristic,
+                                    true,
+                                    path,
+                                    maxStates,
+                                    stats);
+        }
+
+        /**
+         * @brief Iterative Deepening A* search on an implicit graph
+         * @param start The state where the search starts
+         * @param successors Callable successors(state, emit) that calls
+         * emit(next, cost) for each move. The costs must not be negative
+         * @param isGoal Callable isGoal(state), true for the goal states
+         * @param hash Callable hash(state) returning a 64-bit hash, used to detect
+         * the states already on the path
+         * @param heuristic Callable heuristic(state) returning an admissible estimate
+         * of the cost to a goal
+         * @param path Receives the path found, its previous content is cleared
+         * @param maxDepth Largest number of moves of the path
+         * @param stats Optional counters to be filled with the work done
+         * @return The cost of the cheapest path to a goal, or the maximum value of
+         * typeG if no goal was found within the depth limit
+         *
+         * Memory is linear in the depth of the path, since no state is stored
+         * besides the ones on the path and their successors.
+         */
+        template<typename State,
+                 typename typeG,
+                 typename Successors,
+                 typename Goal,
+                 typename Hash,
+                 typename Heuristic,
+                 typename Equal = std::equal_to<State>>
+        inline typeG IDAStar(const State&             start,
+                             Successors               successors,
+                             Goal                     isGoal,
+                             Hash                     hash,
+                             Heuristic                heuristic,
+                             StatePath<State, typeG>& path,
+                             std::size_t       maxDepth = UNLIMITED,
+                             SearchStatistics* stats    = nullptr)
+        {
+            return DepthFirst<Equal>(start,
+                                     successors,
+                                     isGoal,
+                                     hash,
+                                     heuristic,
+                                     false,
+                                     true,
+                                     path,
+                                     maxDepth,
+                                     stats);
+        }
+
+        /**
+         * @brief Iterative Deepening Depth First Search on an implicit graph
+         * @param start The state where the search starts
+         * @param successors Callable successors(state, emit) that calls
+         * emit(next, cost) for each move. The costs are ignored
+         * @param isGoal Callable isGoal(state), true for the goal states
+         * @param hash Callable hash(state) returning a 64-bit hash, used to detect
+         * the states already on the path
+         * @param path Receives the path found, its previous content is cleared. Its
+         * costs are numbers of moves
+         * @param maxDepth Largest number of moves of the path
+         * @param stats Optional counters to be filled with the work done
+         * @return The number of moves of the shortest path to a goal, or the maximum
+         * value of typeG if no goal was found within the depth limit
+         *
+         * Complexity: O(b^d), where b is the branching factor and d is the depth of
+         * the shallowest goal
+         */
+        template<typename State,
+                 typename typeG,
+                 typename Successors,
+                 typename Goal,
+                 typename Hash,
+                 typename Equal = std::equal_to<State>>
+        inline typeG IDDFS(const State&             start,
+                           Successors               successors,
+                           Goal                     isGoal,
+                           Hash                     hash,
+                           StatePath<State, typeG>& path,
+                           std::size_t       maxDepth = UNLIMITED,
+                           SearchStatistics* stats    = nullptr)
+        {
+            auto zero = [](const State&) { return 0; };
+
+            return DepthFirst<Equal>(start,
+                                     successors,
+                                     isGoal,
+                                     hash,
+                                     zero,
+                                     true,
+                                     false,
+                                     path,
+                                     maxDepth,
+                                     stats);
+        }
+    } // namespace implicit
+} // namespace graph
+
+#endif // IMPLICIT_SEARCH_H_
@@ -0,0 +1,526 @@
+/*
+ * Filename: isochrone.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef ISOCHRONE_H_
+#define ISOCHRONE_H_
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "quick_sort.h"
+#include "vector.h"
+
+#include "frozen_graph.h"
+#include "graph.h"
+#include "search_workspace.h"
+
+namespace graph
+{
+    /**
+     * @brief Shapes of the polygons built by Isochrones
+     */
+    enum class HullType
+    {
+        // Smallest convex polygon that contains the reached vertices
+        CONVEX,
+
+        // Convex hull dug inwards where its edges are long compared to the
+        // distance to the vertices inside it (Park and Oh)
+        CONCAVE,
+    };
+
+    /**
+     * @brief Builds isochrones, the polygons that enclose the vertices reachable
+     * from a source within given costs (e.g., everything within 15 minutes)
+     *
+     * @tparam typeG The type for the cost of the graph's edges
+     * @tparam typeT The type of the coordinates of the vertices
+     * @tparam typeD The type of the data of the vertices
+     * @tparam nDim The dimension of the vertices. Only the first two coordinates
+     * are used
+     * @tparam directed Whether the graph is directed
+     *
+     * The graph is frozen once and the coordinates of the vertices are read in
+     * place through pointers to the Vertex objects, so the graph must not change
+     * while the isochrones are in use. All cutoffs of a query are served by the
+     * same bounded Dijkstra search, which is resumed from one cutoff to the next.
+     * The convex hull of a cutoff is built from the hull of the previous cutoff and
+     * the vertices settled since then, so no point is sorted twice.
+     *
+     * The polygons are lists of vertex IDs in counterclockwise order where, as in
+     * geom::ConvexHull, the first vertex is repeated at the end. Vertices added
+     * without nDim coordinates are searched through, but left out of the polygons.
+     */
+    template<typename typeG,
+             typename typeT,
+             typename typeD,
+             std::size_t nDim,
+             bool        directed>
+    class Isochrones
+    {
+        private:
+            FrozenGraph<typeG>     m_graph;
+            SearchWorkspace<typeG> m_workspace;
+
+            // Coordinates of each vertex, owned by the Vertex objects of the graph,
+            // or nullptr for the vertices without coordinates
+            Vector<const typeT*> m_coordinates;
+
+            // Marks the vertices on the hull being dug, by query generation
+            Vector<uint32_t> m_onHull;
+            uint32_t         m_generation;
+
+            double_t X(std::size_t vertexID) const;
+            double_t Y(std::size_t vertexID) const;
+
+            /**
+             * @brief Cross product of (b - a) and (c - a), positive when a, b and c
+             * turn counterclockwise
+             */
+            double_t Cross(std::size_t a, std::size_t b, std::size_t c) const;
+
+            /**
+             * @brief Distance between two vertices
+             */
+            double_t Distance(std::size_t a, std::size_t b) const;
+
+            /**
+             * @brief Distance from vertex p to the segment between a and b
+             */
+            double_t SegmentDistance(std::size_t p, std::size_t a, std::size_t b) const;
+
+            /**
+             * @brief Compute the convex hull of a set of vertices with Andrew's
+             * monotone chain
+             * @param points IDs of the vertices. They are sorted by the function
+             * @param hull Receives the hull in counterclockwise order, without
+             * repeating the first vertex
+             */
+            void BuildConvexHull(Vector<std::size_t>& points,
+                                 Vector<std::size_t>& hull) const;
+
+            /**
+             * @brief Dig a convex hull into a concave one
+             * @param points IDs of all the vertices enclosed by the hull
+             * @param hull Hull in counterclockwise order, without repeating the first
+             * vertex
+             * @param concavity An edge is dug when its length divided by the
+             * distance from the candidate vertex to the nearest end of the edge is
+             * larger than this value
+             */
+            void DigConcaveHull(const Vector<std::size_t>& points,
+                                Vector<std::size_t>&       hull,
+                                double_t                   concavity);
+
+            /**
+             * @brief Whether the segment between a and b properly crosses an edge of
+             * the hull that does not share an end with it
+             */
+            bool CrossesHull(const Vector<std::size_t>& hull,
+                             std::size_t                a,
+                             std::size_t                b) const;
+
+        public:
+            /**
+             * @brief Constructor that prepares the isochrones of a graph
+             * @param graph The graph to be searched. It must not change while the
+             * isochrones are in use
+             */
+            Isochrones(Graph<typeG, typeT, typeD, nDim, directed>& graph);
+
+            /**
+             * @brief Build the isochrones of a source
+             * @param sourceID The ID of the source vertex
+             * @param cutoffs The largest cost of each isochrone
+             * @param polygons Receives one polygon per cutoff, in the order of the
+             * cutoffs
+             * @param hull The shape of the polygons
+             * @param concavity Used by concave hulls. Smaller values give more
+             * detailed polygons
+             */
+            void Compute(std::size_t                  sourceID,
+                         const Vector<typeG>&         cutoffs,
+                         Vector<Vector<std::size_t>>& polygons,
+                         HullType                     hull      = HullType::CONVEX,
+                         double_t                     concavity = 1);
+    };
+
+    template<typename typeG,
+             typename typeT,
+             typename typeD,
+             std::size_t nDim,
+             bool        directed>
+    Isochrones<typeG, typeT, typeD, nDim, directed>::Isochrones(
+        Graph<typeG, typeT, typeD, nDim, directed>& graph)
+        : m_graph(graph)
+    {
+        static_assert(nDim >= 2, "Isochrones need at least two coordinates");
+
+        this->m_coordinates =
+            Vector<const typeT*>(this->m_graph.GetNumVertices(), nullptr);
+        this->m_onHull     = Vector<uint32_t>(this->m_graph.GetNumVertices(), 0);
+        this->m_generation = 0;
+
+        // Pair<first, second> = <ID, Vertex>
+        for (auto& pair : graph.GetVertices())
+        {
+            if (pair.GetSecond().GetCoordinates().Size() == nDim)
+                this->m_coordinates[pair.GetFirst()] =
+                    &pair.GetSecond().GetCoordinates()[0];
+        }
+    }
+
+    template<typename typeG,
+             typename typeT,
+             typename typeD,
+             std::size_t nDim,
+             bool        directed>
+    double_t Isochrones<typeG, typeT, typeD, nDim, directed>::X(
+        std::size_t vertexID) const
+    {
+        return static_cast<double_t>(this->m_coordinates[vertexID][0]);
+    }
+
+    template<typename typeG,
+             typename typeT,
+             typename typeD,
+             std::size_t nDim,
+             bool        directed>
+    double_t Isochrones<typeG, typeT, typeD, nDim, directed>::Y(
+        std::size_t vertexID) const
+    {
+        return static_cast<double_t>(this->m_coordinates[vertexID][1]);
+    }
+
+    template<typename typeG,
+             typename typeT,
+             typename typeD,
+             std::size_t nDim,
+             bool        directed>
+    double_t Isochrones<typeG, typeT, typeD, nDim, directed>::Cross(
+        std::size_t a,
+        std::size_t b,
+        std::size_t c) const
+    {
+        return (this->X(b) - this->X(a)) * (this->Y(c) - this->Y(a)) -
+               (this->Y(b) - this->Y(a)) * (this->X(c) - this->X(a));
+    }
+
+    template<typename typeG,
+             typename typeT,
+             typename typeD,
+             std::size_t nDim,
+             bool        directed>
+    double_t Isochrones<typeG, typeT, typeD, nDim, directed>::Distance(
+        std::size_t a,
+        std::size_t b) const
+    {
+        return std::hypot(this->X(b) - this->X(a), this->Y(b) - this->Y(a));
+    }
+
+    template<typename typeG,
+             typename typeT,
+             typename typeD,
+             std::size_t nDim,
+             bool        directed>
+    double_t Isochrones<typeG, typeT, typeD, nDim, directed>::SegmentDistance(
+        std::size_t p,
+        std::size_t a,
+        std::size_t b) const
+    {
+        double_t dx     = this->X(b) - this->X(a);
+        double_t dy     = this->Y(b) - this->Y(a);
+        double_t length = dx * dx + dy * dy;
+
+        if (length == 0)
+            return this->Distance(p, a);
+
+        // Projection of p on the line, clamped to the segment
+        double_t t =
+            ((this->X(p) - this->X(a)) * dx + (this->Y(p) - this->Y(a)) * dy) / length;
+
+        t = t < 0 ? 0 : (t > 1 ? 1 : t);
+
+        return std::hypot(this->X(a) + t * dx - this->X(p),
+                          this->Y(a) + t * dy - this->Y(p));
+    }
+
+    template<typename typeG,
+             typename typeT,
+             typename typeD,
+             std::size_t nDim,
+             bool        directed>
+    void Isochrones<typeG, typeT, typeD, nDim, directed>::BuildConvexHull(
+        Vector<std::size_t>& points,
+        Vector<std::size_t>& hull) const
+    {
+        hull.Clear();
+
+        sort::Quick(points, [this](const std::size_t& a, const std::size_t& b) {
+            return this->X(a) < this->X(b) or
+                   (this->X(a) == this->X(b) and this->Y(a) < this->Y(b));
+        });
+
+        if (points.Size() < 3)
+        {
+            for (std::size_t i = 0; i < points.Size(); i++)
+                hull.PushBack(points[i]);
+
+            return;
+        }
+
+        // Lower chain from left to right, then upper chain from right to left.
+        // Collinear vertices are dropped
+        for (std::size_t i = 0; i < points.Size(); i++)
+        {
+            while (hull.Size() >= 2 and
+                   this->Cross(hull[hull.Size() - 2],
+                               hull[hull.Size() - 1],
+                               points[i]) <= 0)
+                hull.PopBack();
+
+            hull.PushBack(points[i]);
+        }
+
+        std::size_t lowerSize = hull.Size();
+
+        for (std::size_t i = points.Size() - 1; i-- > 0;)
+        {
+            while (hull.Size() > lowerSize and
+                   this->Cross(hull[hull.Size() - 2],
+                               hull[hull.Size() - 1],
+                               points[i]) <= 0)
+                hull.PopBack();
+
+            hull.PushBack(points[i]);
+        }
+
+        // The first vertex closes the upper chain
+        hull.PopBack();
+    }
+
+    template<typename typeG,
+             typename typeT,
+             typename typeD,
+             std::size_t nDim,
+             bool        directed>
+    bool Isochrones<typeG, typeT, typeD, nDim, directed>::CrossesHull(
+        const Vector<std::size_t>& hull,
+        std::size_t                a,
+        std::size_t                b) const
+    {
+        for (std::size_t i = 0; i < hull.Size(); i++)
+        {
+            std::size_t c = hull[i];
+            std::size_t d = hull[(i + 1) % hull.Size()];
+
+            if (c == a or c == b or d == a or d == b)
+                continue;
+
+            double_t d1 = this->Cross(a, b, c);
+            double_t d2 = this->Cross(a, b, d);
+            double_t d3 = this->Cross(c, d, a);
+            double_t d4 = this->Cross(c, d, b);
+
+            if (((d1 > 0 and d2 < 0) or (d1 < 0 and d2 > 0)) and
+                ((d3 > 0 and d4 < 0) or (d3 < 0 and d4 > 0)))
+                return true;
+        }
+
+        return false;
+    }
+
+    template<typename typeG,
+             typename typeT,
+             typename typeD,
+             std::size_t nDim,
+             bool        directed>
+    void Isochrones<typeG, typeT, typeD, nDim, directed>::DigConcaveHull(
+        const Vector<std::size_t>& points,
+        Vector<std::size_t>&       hull,
+        double_t                   concavity)
+    {
+        std::size_t NO_VERTEX = SearchWorkspace<typeG>::NO_VERTEX;
+
+        if (++this->m_generation == 0)
+        {
+            this->m_onHull     = Vector<uint32_t>(this->m_onHull.Size(), 0);
+            this->m_generation = 1;
+        }
+
+        for (std::size_t i = 0; i < hull.Size(); i++)
+            this->m_onHull[hull[i]] = this->m_generation;
+
+        std::size_t i = 0;
+
+        while (hull.Size() >= 3 and i < hull.Size())
+        {
+            std::size_t h    = hull.Size();
+            std::size_t a    = hull[i];
+            std::size_t b    = hull[(i + 1) % h];
+            std::size_t prev = hull[(i + h - 1) % h];
+            std::size_t next = hull[(i + 2) % h];
+
+            // Inner vertex nearest to the edge, among those that are nearer to it
+            // than to the neighboring edges
+            std::size_t best         = NO_VERTEX;
+            double_t    bestDistance = 0;
+
+            for (std::size_t k = 0; k < points.Size(); k++)
+            {
+                std::size_t p = points[k];
+
+                if (not this->m_coordinates[p] or
+                    this->m_onHull[p] == this->m_generation)
+                    continue;
+
+                double_t distance = this->SegmentDistance(p, a, b);
+
+                if (distance >= this->SegmentDistance(p, prev, a) or
+                    distance >= this->SegmentDistance(p, b, next))
+                    continue;
+
+                if (best == NO_VERTEX or distance < bestDistance)
+                {
+                    best         = p;
+                    bestDistance = distance;
+                }
+            }
+
+            bool dig = false;
+
+            if (best != NO_VERTEX)
+            {
+                double_t nearestEnd = std::fmin(this->Distance(best, a),
+                                                this->Distance(best, b));
+
+                dig = nearestEnd > 0 and
+                      this->Distance(a, b) / nearestEnd > concavity and
+                      not this->CrossesHull(hull, a, best) and
+                      not this->CrossesHull(hull, best, b);
+
+                // The new edges must not leave any inner vertex outside
+                for (std::size_t k = 0; dig and k < points.Size(); k++)
+                {
+                    std::size_t q = points[k];
+
+                    if (not this->m_coordinates[q] or
+                        this->m_onHull[q] == this->m_generation or q == best)
+                        continue;
+
+                    if (this->Cross(a, best, q) < 0 and this->Cross(best, b, q) < 0 and
+                        this->Cross(b, a, q) < 0)
+                        dig = false;
+                }
+            }
+
+            if (not dig)
+            {
+                i++;
+                continue;
+            }
+
+            // Insert the vertex between a and b and check the edge (a, best) again
+            hull.PushBack(best);
+
+            for (std::size_t k = hull.Size() - 1; k > i + 1; k--)
+                hull[k] = hull[k - 1];
+
+            hull[i + 1] = best;
+
+            this->m_onHull[best] = this->m_generation;
+        }
+    }
+
+    template<typename typeG,
+             typename typeT,
+             typename typeD,
+             std::size_t nDim,
+             bool        directed>
+    void Isochrones<typeG, typeT, typeD, nDim, directed>::Compute(
+        std::size_t                  sourceID,
+        const Vector<typeG>&         cutoffs,
+        Vector<Vector<std::size_t>>& polygons,
+        HullType                     hull,
+        double_t                     concavity)
+    {
+        polygons.Clear();
+
+        for (std::size_t c = 0; c < cutoffs.Size(); c++)
+            polygons.PushBack(Vector<std::size_t>());
+
+        if (sourceID >= this->m_graph.GetNumVertices() or
+            not this->m_coordinates[sourceID])
+            return;
+
+        // The cutoffs are served from the smallest to the largest
+        Vector<std::size_t> order;
+
+        for (std::size_t c = 0; c < cutoffs.Size(); c++)
+        {
+            order.PushBack(c);
+
+            for (std::size_t k = order.Size() - 1;
+                 k > 0 and cutoffs[order[k]] < cutoffs[order[k - 1]];
+                 k--)
+            {
+                std::size_t swap = order[k];
+                order[k]         = order[k - 1];
+                order[k - 1]     = swap;
+            }
+        }
+
+        this->m_workspace.Reset(this->m_graph.GetNumVertices());
+        this->m_workspace.Update(sourceID, 0);
+
+        const Vector<std::size_t>& settled = this->m_workspace.GetSettledOrder();
+
+        Vector<std::size_t> points;
+        Vector<std::size_t> convex;
+        std::size_t         used = 0;
+        std::size_t         u;
+
+        for (std::size_t c = 0; c < order.Size(); c++)
+        {
+            while (this->m_workspace.PopMin(u, cutoffs[order[c]]))
+            {
+                for (std::size_t arc = this->m_graph.GetFirstArc(u);
+                     arc < this->m_graph.GetLastArc(u);
+                     arc++)
+                {
+                    this->m_workspace.Update(this->m_graph.GetHead(arc),
+                                             this->m_workspace.GetCost(u) +
+                                                 this->m_graph.GetCost(arc),
+                                             u,
+                                             arc);
+                }
+            }
+
+            // The new hull only depends on the previous hull and the new vertices
+            points = convex;
+
+            for (; used < settled.Size(); used++)
+            {
+                if (this->m_coordinates[settled[used]])
+                    points.PushBack(settled[used]);
+            }
+
+            this->BuildConvexHull(points, convex);
+
+            Vector<std::size_t>& polygon = polygons[order[c]];
+            polygon                      = convex;
+
+            if (hull == HullType::CONCAVE)
+                this->DigConcaveHull(settled, polygon, concavity);
+
+            if (polygon.Size() > 0)
+                polygon.PushBack(polygon[0]);
+        }
+    }
+} // namespace graph
+
+#endif // ISOCHRONE_H_
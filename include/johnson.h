@@ -0,0 +1,123 @@
+/*
+ * Filename: johnson.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef JOHNSON_H_
+#define JOHNSON_H_
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+
+#include "vector.h"
+
+#include "bellman_ford.h"
+#include "distance_table.h"
+#include "frozen_graph.h"
+#include "parallel.h"
+#include "search_workspace.h"
+
+namespace graph
+{
+    /**
+     * @brief Run Johnson's algorithm to find the shortest paths between all pairs of
+     * vertices of a graph that may have negative edge costs
+     * @param graph The frozen graph on which to calculate the shortest paths
+     * @param table Receives the costs. A table in memory is sized by Allocate. A
+     *        table backed by a file, such as one made by Create, is filled in place
+     *        and must be writable and of the size of the graph
+     * @param numThreads Number of threads to be used. Zero means one thread per
+     *        hardware thread
+     * @return False if the graph has a negative cycle or the table is backed by a
+     *         file that cannot receive the costs, in which case the table is not
+     *         changed, True otherwise
+     *
+     * A Bellman-Ford search from all vertices at once gives a potential h(v) to
+     * every vertex such that cost(u, v) + h(u) - h(v) is never negative. Then one
+     * Dijkstra search per source runs on these reduced costs, which do not change
+     * the shortest paths, and the cost of each path is restored by subtracting
+     * h(source) - h(target). The searches are spread among the threads, each thread
+     * with its own workspace, and each search only writes its own row of the table.
+     *
+     * Complexity: O(V * E * log(V)), when V is the number of vertices and E is the
+     * number of edges in the graph
+     */
+    template<typename typeG>
+    inline bool Johnson(const FrozenGraph<typeG>& graph,
+                        DistanceTable<typeG>&     table,
+                        std::size_t               numThreads = 0)
+    {
+        // Defines the infinity value for the typeG type
+        typeG INFINITY_VALUE = std::numeric_limits<typeG>::max();
+
+        std::size_t n = graph.GetNumVertices();
+
+        // A file-backed table is never replaced by one in memory, since it may not
+        // fit in the RAM
+        if (table.IsMapped() and
+            (not table.IsWritable() or table.GetNumVertices() != n))
+            return false;
+
+        Vector<std::size_t> sources;
+        for (std::size_t v = 0; v < n; v++)
+            sources.PushBack(v);
+
+        Vector<typeG>       potentials;
+        Vector<std::size_t> predecessors;
+
+        if (not MultiSourceBellmanFord(
+                graph, sources, potentials, predecessors, numThreads))
+            return false;
+
+        if (not table.IsMapped() and table.GetNumVertices() != n)
+            table.Allocate(n);
+
+        numThreads = parallel::GetNumThreads(numThreads);
+
+        std::unique_ptr<SearchWorkspace<typeG>[]> workspaces(
+            new SearchWorkspace<typeG>[numThreads]);
+
+        parallel::For(
+            n,
+            [&](std::size_t s, std::size_t threadIndex) {
+                SearchWorkspace<typeG>& workspace = workspaces[threadIndex];
+
+                workspace.Reset(n);
+                workspace.Update(s, 0);
+
+                std::size_t u;
+
+                while (workspace.PopMin(u))
+                {
+                    for (std::size_t arc = graph.GetFirstArc(u);
+                         arc < graph.GetLastArc(u);
+                         arc++)
+                    {
+                        std::size_t v = graph.GetHead(arc);
+
+                        workspace.Update(v,
+                                         workspace.GetCost(u) + graph.GetCost(arc) +
+                                             potentials[u] - potentials[v],
+                                         u,
+                                         arc);
+                    }
+                }
+
+                typeG* row = table.GetRow(s);
+
+                for (std::size_t v = 0; v < n; v++)
+                {
+                    row[v] = workspace.IsSettled(v)
+                                 ? workspace.GetCost(v) - potentials[s] + potentials[v]
+                                 : INFINITY_VALUE;
+                }
+            },
+            numThreads);
+
+        return true;
+    }
+} // namespace graph
+
+#endif // JOHNSON_H_
@@ -0,0 +1,383 @@
+/*
+ * Filename: k_shortest_paths.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef K_SHORTEST_PATHS_H_
+#define K_SHORTEST_PATHS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+
+#include "vector.h"
+
+#include "dijkstra.h"
+#include "frozen_graph.h"
+#include "graph.h"
+#include "graph_utils.h"
+#include "parallel.h"
+#include "search_workspace.h"
+
+namespace graph
+{
+    namespace
+    {
+        /**
+         * @brief Scratch memory of the thread running a spur search
+         */
+        template<typename typeG>
+        struct SpurSearchState
+        {
+                SearchWorkspace<typeG> m_workspace;
+
+                // Vertices of the root path carry the current generation
+                Vector<uint32_t> m_bannedVertices;
+                uint32_t         m_generation = 0;
+
+                // Edges that may not leave the spur vertex
+                Vector<std::size_t> m_bannedEdges;
+        };
+
+        /**
+         * @return True if both paths start with the same first numEdges edges
+         */
+        template<typename typeG>
+        inline bool SameRoot(const PathResult<typeG>& p1,
+                             const PathResult<typeG>& p2,
+                             std::size_t              numEdges)
+        {
+            if (p1.m_edgeIDs.Size() < numEdges or p2.m_edgeIDs.Size() < numEdges)
+                return false;
+
+            for (std::size_t i = 0; i < numEdges; i++)
+                if (p1.m_edgeIDs[i] != p2.m_edgeIDs[i])
+                    return false;
+
+            return true;
+        }
+
+        /**
+         * @brief Reverse the elements of a vector from a given position to its end
+         */
+        template<typename type>
+        inline void ReverseFrom(Vector<type>& values, std::size_t from)
+        {
+            for (std::size_t i = from, j = values.Size(); i + 1 < j;)
+            {
+                type value  = values[i];
+                values[i++] = values[--j];
+                values[j]   = value;
+            }
+        }
+    } // namespace
+
+    /**
+     * @brief Find the K shortest loopless paths between two vertices, by Yen's
+     * algorithm
+     * @param graph The frozen graph to search
+     * @param sourceID ID of the first vertex of the paths
+     * @param targetID ID of the last vertex of the paths
+     * @param k Number of paths wanted
+     * @param paths Receives up to k paths sorted by cost. It has fewer than k paths
+     * when the graph does not have k loopless paths from source to target
+     * @param numThreads Number of threads to be used. Zero means one thread per
+     * hardware thread
+     *
+     * Each new path deviates from the previous one at some spur vertex: it keeps the
+     * root of the previous path up to the spur vertex and then takes the shortest
+     * path to the target that avoids the root vertices and the edges that other
+     * accepted paths with the same root take at the spur vertex. These removals are
+     * only masks kept by the search, so the graph is never changed.
+     *
+     * A single backward Dijkstra from the target is shared by every spur search.
+     * Removing vertices and edges can only make paths longer, so its costs are an
+     * exact lower bound that drives the spur searches as an A* heuristic, and when
+     * the tree path from a spur vertex avoids all the masks it is the spur path
+     * itself and no search is needed. The spur searches of one path are independent
+     * and run in parallel, each thread with its own workspace and masks.
+     */
+    template<typename typeG>
+    inline void KShortestPaths(const FrozenGraph<typeG>&  graph,
+                               std::size_t                sourceID,
+                               std::size_t                targetID,
+                               std::size_t                k,
+                               Vector<PathResult<typeG>>& paths,
+                               std::size_t                numThreads = 0)
+    {
+        std::size_t n = graph.GetNumVertices();
+
+        paths = Vector<PathResult<typeG>>();
+
+        if (k == 0 or sourceID >= n or targetID >= n)
+            return;
+
+        // Costs from every vertex to the target
+        SearchWorkspace<typeG> tree;
+        Dijkstra(graph, targetID, tree, true);
+
+        if (not tree.IsReached(sourceID))
+            return;
+
+        numThreads = parallel::GetNumThreads(numThreads);
+
+        std::unique_ptr<SpurSearchState<typeG>[]> states(
+            new SpurSearchState<typeG>[numThreads]);
+
+        // Append the path of the shortest path tree from a vertex to the target
+        auto AppendTreePath = [&](std::size_t vertexID, PathResult<typeG>& path) {
+            typeG rootCost = path.m_costs[path.m_costs.Size() - 1] +
+                             tree.GetCost(vertexID);
+
+            while (vertexID != targetID)
+            {
+                std::size_t arc = tree.GetArc(vertexID);
+
+                path.m_edgeIDs.PushBack(graph.GetEdgeID(arc, true));
+
+                vertexID = tree.GetPredecessor(vertexID);
+
+                path.m_vertexIDs.PushBack(vertexID);
+                path.m_costs.PushBack(rootCost - tree.GetCost(vertexID));
+            }
+        };
+
+        // Shortest path, straight from the tree
+        PathResult<typeG> first;
+        first.m_vertexIDs.PushBack(sourceID);
+        first.m_costs.PushBack(0);
+        AppendTreePath(sourceID, first);
+
+        paths.PushBack(first);
+
+        // Pool of found paths that were not accepted yet
+        Vector<PathResult<typeG>> candidates;
+
+        Vector<PathResult<typeG>> spurPaths;
+        Vector<uint8_t>           spurFound;
+
+        while (paths.Size() < k)
+        {
+            const PathResult<typeG>& last     = paths[paths.Size() - 1];
+            std::size_t              numSpurs = last.m_edgeIDs.Size();
+
+            spurPaths = Vector<PathResult<typeG>>(numSpurs, PathResult<typeG>());
+            spurFound = Vector<uint8_t>(numSpurs, 0);
+
+            parallel::For(
+                numSpurs,
+                [&](std::size_t i, std::size_t threadIndex) {
+                    SpurSearchState<typeG>& state     = states[threadIndex];
+                    SearchWorkspace<typeG>& workspace = state.m_workspace;
+
+                    std::size_t spurID = last.m_vertexIDs[i];
+
+                    if (state.m_bannedVertices.Size() < n)
+                        state.m_bannedVertices = Vector<uint32_t>(n, 0);
+
+                    if (++state.m_generation == 0)
+                    {
+                        state.m_bannedVertices = Vector<uint32_t>(n, 0);
+                        state.m_generation     = 1;
+                    }
+
+                    for (std::size_t j = 0; j < i; j++)
+                    {
+                        state.m_bannedVertices[last.m_vertexIDs[j]] =
+                            state.m_generation;
+                    }
+
+                    state.m_bannedEdges.Clear();
+
+                    // Edges already taken at the spur vertex by paths with this root
+                    for (std::size_t p = 0; p < paths.Size(); p++)
+                    {
+                        if (paths[p].m_edgeIDs.Size() > i and
+                            SameRoot(paths[p], last, i))
+                            state.m_bannedEdges.PushBack(paths[p].m_edgeIDs[i]);
+                    }
+
+                    auto IsBanned = [&](std::size_t vertexID) {
+                        return state.m_bannedVertices[vertexID] == state.m_generation;
+                    };
+
+                    auto IsBannedEdge = [&](std::size_t edgeID) {
+                        for (std::size_t j = 0; j < state.m_bannedEdges.Size(); j++)
+                            if (state.m_bannedEdges[j] == edgeID)
+                                return true;
+
+                        return false;
+                    };
+
+                    PathResult<typeG>& path = spurPaths[i];
+
+                    for (std::size_t j = 0; j <= i; j++)
+                    {
+                        path.m_vertexIDs.PushBack(last.m_vertexIDs[j]);
+                        path.m_costs.PushBack(last.m_costs[j]);
+                    }
+
+                    for (std::size_t j = 0; j < i; j++)
+                        path.m_edgeIDs.PushBack(last.m_edgeIDs[j]);
+
+                    // The tree path is the spur path if it avoids the masks
+                    bool        treePathFree = true;
+                    std::size_t v            = spurID;
+
+                    while (treePathFree and v != targetID)
+                    {
+                        if (v == spurID and
+                            IsBannedEdge(graph.GetEdgeID(tree.GetArc(v), true)))
+                            treePathFree = false;
+
+                        v = tree.GetPredecessor(v);
+
+                        if (IsBanned(v))
+                            treePathFree = false;
+                    }
+
+                    if (treePathFree)
+                    {
+                        AppendTreePath(spurID, path);
+                        spurFound[i] = 1;
+                        return;
+                    }
+
+                    // A* keyed by cost plus the tree cost to the target. The tree cost
+                    // of a vertex never changes, so comparing keys of the same vertex
+                    // is the same as comparing its costs
+                    workspace.Reset(n);
+                    workspace.Update(spurID, tree.GetCost(spurID));
+
+                    std::size_t u;
+
+                    while (workspace.PopMin(u) and u != targetID)
+                    {
+                        typeG cost = workspace.GetCost(u) - tree.GetCost(u);
+
+                        for (std::size_t arc = graph.GetFirstArc(u);
+                             arc < graph.GetLastArc(u);
+                             arc++)
+                        {
+                            v = graph.GetHead(arc);
+
+                            if (IsBanned(v) or not tree.IsReached(v))
+                                continue;
+
+                            if (u == spurID and IsBannedEdge(graph.GetEdgeID(arc)))
+                                continue;
+
+                            workspace.Update(v,
+                                             cost + graph.GetCost(arc) +
+                                                 tree.GetCost(v),
+                                             u,
+                                             arc);
+                        }
+                    }
+
+                    if (not workspace.IsSettled(targetID))
+                        return;
+
+                    // Walk the spur path back from the target, then put it in order
+                    std::size_t spurStart = path.m_edgeIDs.Size();
+
+                    for (v = targetID; v != spurID; v = workspace.GetPredecessor(v))
+                    {
+                        path.m_vertexIDs.PushBack(v);
+                        path.m_edgeIDs.PushBack(graph.GetEdgeID(workspace.GetArc(v)));
+                    }
+
+                    ReverseFrom(path.m_vertexIDs, spurStart + 1);
+                    ReverseFrom(path.m_edgeIDs, spurStart);
+
+                    for (std::size_t j = spurStart; j < path.m_edgeIDs.Size(); j++)
+                    {
+                        std::size_t arc = workspace.GetArc(path.m_vertexIDs[j + 1]);
+
+                        path.m_costs.PushBack(path.m_costs[j] + graph.GetCost(arc));
+                    }
+
+                    spurFound[i] = 1;
+                },
+                numThreads);
+
+            // Add the new spur paths to the candidates, skipping repeated ones
+            for (std::size_t i = 0; i < numSpurs; i++)
+            {
+                if (not spurFound[i])
+                    continue;
+
+                const PathResult<typeG>& path = spurPaths[i];
+
+                bool repeated = false;
+
+                for (std::size_t c = 0; not repeated and c < candidates.Size(); c++)
+                {
+                    repeated =
+                        candidates[c].m_edgeIDs.Size() == path.m_edgeIDs.Size() and
+                        SameRoot(candidates[c], path, path.m_edgeIDs.Size());
+                }
+
+                if (not repeated)
+                    candidates.PushBack(path);
+            }
+
+            if (candidates.Size() == 0)
+                break;
+
+            // Accept the cheapest candidate, ties broken by the number of edges
+            std::size_t best = 0;
+
+            for (std::size_t c = 1; c < candidates.Size(); c++)
+            {
+                const PathResult<typeG>& path = candidates[c];
+
+                const PathResult<typeG>& bestPath = candidates[best];
+
+                typeG cost     = path.m_costs[path.m_costs.Size() - 1];
+                typeG bestCost = bestPath.m_costs[bestPath.m_costs.Size() - 1];
+
+                if (cost < bestCost or
+                    (cost == bestCost and
+                     path.m_edgeIDs.Size() < bestPath.m_edgeIDs.Size()))
+                    best = c;
+            }
+
+            paths.PushBack(candidates[best]);
+
+            candidates[best] = candidates[candidates.Size() - 1];
+            candidates.PopBack();
+        }
+    }
+
+    /**
+     * @brief KShortestPaths overload that searches a graph, freezing it first
+     * @param graph The graph to search, which is not changed
+     * @param sourceID ID of the first vertex of the paths
+     * @param targetID ID of the last vertex of the paths
+     * @param k Number of paths wanted
+     * @param paths Receives up to k paths sorted by cost
+     * @param numThreads Number of threads to be used. Zero means one thread per
+     * hardware thread
+     */
+    template<typename typeG,
+             typename typeT,
+             typename typeD,
+             std::size_t nDim,
+             bool        directed>
+    inline void KShortestPaths(Graph<typeG, typeT, typeD, nDim, directed>& graph,
+                               std::size_t                                 sourceID,
+                               std::size_t                                 targetID,
+                               std::size_t                                 k,
+                               Vector<PathResult<typeG>>&                  paths,
+                               std::size_t numThreads = 0)
+    {
+        FrozenGraph<typeG> frozen(graph);
+
+        KShortestPaths(frozen, sourceID, targetID, k, paths, numThreads);
+    }
+} // namespace graph
+
+#endif // K_SHORTEST_PATHS_H_
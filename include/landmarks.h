@@ -0,0 +1,643 @@
+/*
+ * Filename: landmarks.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef LANDMARKS_H_
+#define LANDMARKS_H_
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+
+#include "vector.h"
+
+#include "dijkstra.h"
+#include "frozen_graph.h"
+#include "parallel.h"
+#include "search_workspace.h"
+
+namespace graph
+{
+    /**
+     * @brief Strategies to choose the landmarks of an ALT index
+     */
+    enum class LandmarkSelection
+    {
+        // Each new landmark is the vertex farthest from the landmarks chosen so far
+        FARTHEST,
+
+        // Each new landmark is the leaf of the shortest path tree branch that is
+        // worst covered by the landmarks chosen so far (Goldberg and Werneck)
+        AVOID,
+    };
+
+    /**
+     * @brief Landmark distance tables used by the ALT (A*, Landmarks, Triangle
+     * inequality) heuristic
+     *
+     * @tparam typeG The type for the cost of the graph's edges
+     *
+     * For each landmark L the tables store d(L, v) and d(v, L) for every vertex v.
+     * By the triangle inequality, for any vertices v and t
+     *
+     *      d(v, t) >= d(L, t) - d(L, v)   and   d(v, t) >= d(v, L) - d(t, L)
+     *
+     * so the largest of these differences is a lower bound that, unlike the
+     * geometric distances, follows the edge costs (e.g., travel times). In undirected
+     * graphs both tables are the same and only one is stored.
+     *
+     * The tables are stored row by row, one row of GetNumVertices() entries per
+     * landmark. Unreachable vertices have the maximum value of typeG. The tables
+     * must be rebuilt whenever the graph or its costs change.
+     */
+    template<typename typeG>
+    class Landmarks
+    {
+        private:
+            std::size_t m_numVertices;
+            bool        m_directed;
+
+            Vector<std::size_t> m_landmarks;
+
+            // Row i stores d(landmarks[i], v) and d(v, landmarks[i]), respectively
+            Vector<typeG> m_fromLandmarks;
+            Vector<typeG> m_toLandmarks;
+
+            /**
+             * @brief Compute the table rows of the landmarks in [first, last)
+             * @param graph The frozen graph
+             * @param first, last Range of landmark indices
+             * @param from, to Whether the rows d(L, v) and d(v, L) must be computed
+             * @param numThreads Number of threads to be used
+             */
+            void ComputeRows(const FrozenGraph<typeG>& graph,
+                             std::size_t               first,
+                             std::size_t               last,
+                             bool                      from,
+                             bool                      to,
+                             std::size_t               numThreads);
+
+            /**
+             * @brief Choose the next landmark with the FARTHEST strategy
+             */
+            std::size_t SelectFarthest(const FrozenGraph<typeG>& graph,
+                                       SearchWorkspace<typeG>&   workspace,
+                                       Vector<typeG>&            minCost,
+                                       const Vector<bool>&       candidate);
+
+            /**
+             * @brief Choose the next landmark with the AVOID strategy
+             */
+            std::size_t SelectAvoid(const FrozenGraph<typeG>& graph,
+                                    SearchWorkspace<typeG>&   workspace,
+                                    const Vector<bool>&       candidate,
+                                    std::mt19937&             generator);
+
+        public:
+            Landmarks();
+
+            /**
+             * @brief Choose the landmarks and compute their distance tables
+             * @param graph The frozen graph to be preprocessed
+             * @param numLandmarks Number of landmarks to be chosen. Fewer landmarks
+             * are chosen if the graph does not have enough vertices with edges
+             * @param selection The strategy used to choose the landmarks
+             * @param numThreads Number of threads used to compute the tables. Zero
+             * means one thread per hardware thread
+             */
+            void Build(const FrozenGraph<typeG>& graph,
+                       std::size_t               numLandmarks,
+                       LandmarkSelection selection  = LandmarkSelection::AVOID,
+                       std::size_t       numThreads = 0);
+
+            /**
+             * @brief Compute the distance tables of a given set of landmarks
+             * @param graph The frozen graph to be preprocessed
+             * @param landmarks IDs of the landmark vertices
+             * @param numThreads Number of threads used to compute the tables. Zero
+             * means one thread per hardware thread
+             */
+            void Build(const FrozenGraph<typeG>&  graph,
+                       const Vector<std::size_t>& landmarks,
+                       std::size_t                numThreads = 0);
+
+            /**
+             * @brief Lower bound of the cost to go from a vertex to another
+             * @param vertexID ID of the vertex
+             * @param targetID ID of the target vertex
+             * @return The largest bound given by the landmarks, or zero
+             */
+            double_t LowerBound(std::size_t vertexID, std::size_t targetID) const;
+
+            /**
+             * @return The IDs of the landmark vertices
+             */
+            const Vector<std::size_t>& GetLandmarks() const;
+
+            /**
+             * @return The number of landmarks
+             */
+            std::size_t GetNumLandmarks() const;
+
+            /**
+             * @return The size of the vertex ID space covered by the tables
+             */
+            std::size_t GetNumVertices() const;
+
+            /**
+             * @return The cost d(L, v), where L is the i-th landmark
+             */
+            typeG GetCostFrom(std::size_t i, std::size_t vertexID) const;
+
+            /**
+             * @return The cost d(v, L), where L is the i-th landmark
+             */
+            typeG GetCostTo(std::size_t i, std::size_t vertexID) const;
+
+            /**
+             * @brief Write the landmarks and their tables to a binary file
+             * @param path Path of the file
+             * @return True if the file was written, false otherwise
+             */
+            bool Save(const std::string& path) const;
+
+            /**
+             * @brief Read the landmarks and their tables from a file created by Save
+             * @param path Path of the file
+             * @return True if the file was read, false if it could not be opened, was
+             * created for another cost type or does not have the size given by its
+             * header. The landmarks are left unchanged when false is returned
+             */
+            bool Load(const std::string& path);
+    };
+
+    template<typename typeG>
+    Landmarks<typeG>::Landmarks()
+    {
+        this->m_numVertices = 0;
+        this->m_directed    = false;
+    }
+
+    template<typename typeG>
+    void Landmarks<typeG>::ComputeRows(const FrozenGraph<typeG>& graph,
+                                       std::size_t               first,
+                                       std::size_t               last,
+                                       bool                      from,
+                                       bool                      to,
+                                       std::size_t               numThreads)
+    {
+        numThreads = parallel::GetNumThreads(numThreads);
+
+        std::unique_ptr<SearchWorkspace<typeG>[]> workspaces(
+            new SearchWorkspace<typeG>[numThreads]);
+
+        // Each task is a pair (landmark, direction), so the searches from and to
+        // the same landmark also run in parallel
+        parallel::For(
+            2 * (last - first),
+            [&](std::size_t task, std::size_t threadIndex) {
+                std::size_t i        = first + task / 2;
+                bool        backward = task % 2 == 1;
+
+                if ((backward and not to) or (not backward and not from))
+                    return;
+
+                SearchWorkspace<typeG>& workspace = workspaces[threadIndex];
+                Vector<typeG>&          table =
+                    backward ? this->m_toLandmarks : this->m_fromLandmarks;
+
+                Dijkstra(graph, this->m_landmarks[i], workspace, backward);
+
+                std::size_t row = i * this->m_numVertices;
+
+                for (std::size_t v = 0; v < this->m_numVertices; v++)
+                    table[row + v] = std::numeric_limits<typeG>::max();
+
+                for (std::size_t j = 0; j < workspace.GetTouched().Size(); j++)
+                {
+                    std::size_t v  = workspace.GetTouched()[j];
+                    table[row + v] = workspace.GetCost(v);
+                }
+            },
+            numThreads);
+    }
+
+    template<typename typeG>
+    std::size_t Landmarks<typeG>::SelectFarthest(const FrozenGraph<typeG>& graph,
+                                                 SearchWorkspace<typeG>&   workspace,
+                                                 Vector<typeG>&            minCost,
+                                                 const Vector<bool>&       candidate)
+    {
+        std::size_t best = SearchWorkspace<typeG>::NO_VERTEX;
+
+        if (this->m_landmarks.Size() == 0)
+        {
+            // The first landmark is the vertex farthest from an arbitrary start
+            std::size_t start = 0;
+
+            while (not candidate[start])
+                start++;
+
+            Dijkstra(graph, start, workspace);
+
+            for (std::size_t j = 0; j < workspace.GetTouched().Size(); j++)
+            {
+                std::size_t v = workspace.GetTouched()[j];
+
+                if (candidate[v] and
+                    (best == SearchWorkspace<typeG>::NO_VERTEX or
+                     workspace.GetCost(best) < workspace.GetCost(v)))
+                    best = v;
+            }
+
+            return best;
+        }
+
+        // Vertices that no landmark reaches are preferred, since they belong to
+        // components that are not covered yet
+        for (std::size_t v = 0; v < this->m_numVertices; v++)
+        {
+            if (candidate[v] and (best == SearchWorkspace<typeG>::NO_VERTEX or
+                                  minCost[best] < minCost[v]))
+                best = v;
+        }
+
+        return best;
+    }
+
+    template<typename typeG>
+    std::size_t Landmarks<typeG>::SelectAvoid(const FrozenGraph<typeG>& graph,
+                                              SearchWorkspace<typeG>&   workspace,
+                                              const Vector<bool>&       candidate,
+                                              std::mt19937&             generator)
+    {
+        std::size_t NO_VERTEX = SearchWorkspace<typeG>::NO_VERTEX;
+
+        // Pick a random root among the vertices with edges
+        std::uniform_int_distribution<std::size_t> distribution(
+            0,
+            this->m_numVertices - 1);
+
+        std::size_t root = distribution(generator);
+
+        while (not candidate[root])
+            root = (root + 1) % this->m_numVertices;
+
+        Dijkstra(graph, root, workspace);
+
+        const Vector<std::size_t>& order = workspace.GetSettledOrder();
+
+        // size(v) is the total amount by which the current landmarks underestimate
+        // the costs from the root to the vertices in the subtree of v. Subtrees that
+        // already contain a landmark are considered covered
+        Vector<double_t>    size(this->m_numVertices, 0);
+        Vector<bool>        covered(this->m_numVertices, false);
+        Vector<std::size_t> bestChild(this->m_numVertices, NO_VERTEX);
+
+        for (std::size_t i = 0; i < this->m_landmarks.Size(); i++)
+            covered[this->m_landmarks[i]] = true;
+
+        for (std::size_t j = order.Size(); j-- > 0;)
+        {
+            std::size_t v = order[j];
+            std::size_t p = workspace.GetPredecessor(v);
+
+            size[v] += static_cast<double_t>(workspace.GetCost(v)) -
+                       this->LowerBound(root, v);
+
+            if (covered[v])
+                size[v] = 0;
+
+            if (p == NO_VERTEX)
+                continue;
+
+            if (covered[v])
+                covered[p] = true;
+
+            size[p] += size[v];
+
+            if (bestChild[p] == NO_VERTEX or size[bestChild[p]] < size[v])
+                bestChild[p] = v;
+        }
+
+        // Follow the heaviest branch down to a leaf
+        std::size_t leaf = root;
+
+        while (bestChild[leaf] != NO_VERTEX and size[bestChild[leaf]] > 0)
+            leaf = bestChild[leaf];
+
+        if (covered[leaf])
+        {
+            // Everything reachable from the root is covered, so fall back to any
+            // vertex that is not a landmark yet
+            for (std::size_t v = 0; v < this->m_numVertices; v++)
+            {
+                if (candidate[v] and not covered[v])
+                    return v;
+            }
+
+            return NO_VERTEX;
+        }
+
+        return leaf;
+    }
+
+    template<typename typeG>
+    void Landmarks<typeG>::Build(const FrozenGraph<typeG>& graph,
+                                 std::size_t               numLandmarks,
+                                 LandmarkSelection         selection,
+                                 std::size_t               numThreads)
+    {
+        this->m_numVertices = graph.GetNumVertices();
+        this->m_directed    = graph.IsDirected();
+        this->m_landmarks.Clear();
+
+        // Only vertices with edges are worth being landmarks
+        Vector<bool> candidate(this->m_numVertices, false);
+        std::size_t  numCandidates = 0;
+
+        for (std::size_t v = 0; v < this->m_numVertices; v++)
+        {
+            if (graph.GetFirstArc(v) < graph.GetLastArc(v) or
+                graph.GetFirstArc(v, true) < graph.GetLastArc(v, true))
+            {
+                candidate[v] = true;
+                numCandidates++;
+            }
+        }
+
+        if (numLandmarks > numCandidates)
+            numLandmarks = numCandidates;
+
+        typeG INFINITY_VALUE = std::numeric_limits<typeG>::max();
+
+        this->m_fromLandmarks =
+            Vector<typeG>(numLandmarks * this->m_numVertices, INFINITY_VALUE);
+
+        this->m_toLandmarks = this->m_directed ? Vector<typeG>(numLandmarks *
+                                                                   this->m_numVertices,
+                                                               INFINITY_VALUE)
+                                               : Vector<typeG>();
+
+        // Choosing a landmark depends on the tables of the previous ones, so the
+        // selection is sequential. Only the rows the selection needs are computed
+        // here; the remaining ones are computed in parallel at the end
+        SearchWorkspace<typeG> workspace;
+        Vector<typeG>          minCost(this->m_numVertices, INFINITY_VALUE);
+        std::mt19937           generator(numLandmarks);
+        std::size_t            landmark;
+
+        while (this->m_landmarks.Size() < numLandmarks)
+        {
+            if (selection == LandmarkSelection::FARTHEST)
+                landmark = this->SelectFarthest(graph, workspace, minCost, candidate);
+            else
+                landmark = this->SelectAvoid(graph, workspace, candidate, generator);
+
+            if (landmark == SearchWorkspace<typeG>::NO_VERTEX)
+                break;
+
+            candidate[landmark] = false;
+            this->m_landmarks.PushBack(landmark);
+
+            std::size_t i = this->m_landmarks.Size() - 1;
+
+            if (selection == LandmarkSelection::FARTHEST)
+            {
+                this->ComputeRows(graph, i, i + 1, true, false, 1);
+
+                for (std::size_t v = 0; v < this->m_numVertices; v++)
+                {
+                    typeG cost = this->GetCostFrom(i, v);
+
+                    if (cost < minCost[v])
+                        minCost[v] = cost;
+                }
+            }
+            else
+            {
+                this->ComputeRows(graph, i, i + 1, true, this->m_directed, numThreads);
+            }
+        }
+
+        if (selection == LandmarkSelection::FARTHEST and this->m_directed)
+            this->ComputeRows(graph,
+                              0,
+                              this->m_landmarks.Size(),
+                              false,
+                              true,
+                              numThreads);
+    }
+
+    template<typename typeG>
+    void Landmarks<typeG>::Build(const FrozenGraph<typeG>&  graph,
+                                 const Vector<std::size_t>& landmarks,
+                                 std::size_t                numThreads)
+    {
+        this->m_numVertices = graph.GetNumVertices();
+        this->m_directed    = graph.IsDirected();
+        this->m_landmarks   = landmarks;
+
+        typeG INFINITY_VALUE = std::numeric_limits<typeG>::max();
+
+        this->m_fromLandmarks =
+            Vector<typeG>(landmarks.Size() * this->m_numVertices, INFINITY_VALUE);
+
+        this->m_toLandmarks = this->m_directed ? Vector<typeG>(landmarks.Size() *
+                                                                   this->m_numVertices,
+                                                               INFINITY_VALUE)
+                                               : Vector<typeG>();
+
+        this->ComputeRows(graph,
+                          0,
+                          landmarks.Size(),
+                          true,
+                          this->m_directed,
+                          numThreads);
+    }
+
+    template<typename typeG>
+    double_t Landmarks<typeG>::LowerBound(std::size_t vertexID,
+                                          std::size_t targetID) const
+    {
+        typeG INFINITY_VALUE = std::numeric_limits<typeG>::max();
+
+        double_t bound = 0;
+
+        for (std::size_t i = 0; i < this->m_landmarks.Size(); i++)
+        {
+            typeG fromV = this->GetCostFrom(i, vertexID);
+            typeG fromT = this->GetCostFrom(i, targetID);
+            typeG toV   = this->GetCostTo(i, vertexID);
+            typeG toT   = this->GetCostTo(i, targetID);
+
+            // d(v, t) >= d(L, t) - d(L, v)
+            if (fromV != INFINITY_VALUE and fromT != INFINITY_VALUE and
+                static_cast<double_t>(fromT) - static_cast<double_t>(fromV) > bound)
+                bound = static_cast<double_t>(fromT) - static_cast<double_t>(fromV);
+
+            // d(v, t) >= d(v, L) - d(t, L)
+            if (toV != INFINITY_VALUE and toT != INFINITY_VALUE and
+                static_cast<double_t>(toV) - static_cast<double_t>(toT) > bound)
+                bound = static_cast<double_t>(toV) - static_cast<double_t>(toT);
+        }
+
+        return bound;
+    }
+
+    template<typename typeG>
+    const Vector<std::size_t>& Landmarks<typeG>::GetLandmarks() const
+    {
+        return this->m_landmarks;
+    }
+
+    template<typename typeG>
+    std::size_t Landmarks<typeG>::GetNumLandmarks() const
+    {
+        return this->m_landmarks.Size();
+    }
+
+    template<typename typeG>
+    std::size_t Landmarks<typeG>::GetNumVertices() const
+    {
+        return this->m_numVertices;
+    }
+
+    template<typename typeG>
+    typeG Landmarks<typeG>::GetCostFrom(std::size_t i, std::size_t vertexID) const
+    {
+        return this->m_fromLandmarks[i * this->m_numVertices + vertexID];
+    }
+
+    template<typename typeG>
+    typeG Landmarks<typeG>::GetCostTo(std::size_t i, std::size_t vertexID) const
+    {
+        std::size_t index = i * this->m_numVertices + vertexID;
+
+        return this->m_directed ? this->m_toLandmarks[index]
+                                : this->m_fromLandmarks[index];
+    }
+
+    namespace
+    {
+        // Identifies the files written by Landmarks::Save
+        constexpr uint64_t LANDMARKS_FILE_MAGIC = 0x31544c41; // "ALT1"
+    } // namespace
+
+    template<typename typeG>
+    bool Landmarks<typeG>::Save(const std::string& path) const
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+        if (not file.is_open())
+            return false;
+
+        // Header: magic, size of the cost type, number of vertices, number of
+        // landmarks and whether the graph is directed
+        uint64_t header[5] = { LANDMARKS_FILE_MAGIC,
+                               sizeof(typeG),
+                               this->m_numVertices,
+                               this->m_landmarks.Size(),
+                               this->m_directed };
+
+        file.write(reinterpret_cast<const char*>(header), sizeof(header));
+
+        for (std::size_t i = 0; i < this->m_landmarks.Size(); i++)
+        {
+            uint64_t landmark = this->m_landmarks[i];
+            file.write(reinterpret_cast<const char*>(&landmark), sizeof(landmark));
+        }
+
+        if (this->m_fromLandmarks.Size() > 0)
+            file.write(reinterpret_cast<const char*>(&this->m_fromLandmarks[0]),
+                       this->m_fromLandmarks.Size() * sizeof(typeG));
+
+        if (this->m_toLandmarks.Size() > 0)
+            file.write(reinterpret_cast<const char*>(&this->m_toLandmarks[0]),
+                       this->m_toLandmarks.Size() * sizeof(typeG));
+
+        return file.good();
+    }
+
+    template<typename typeG>
+    bool Landmarks<typeG>::Load(const std::string& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+
+        if (not file.is_open())
+            return false;
+
+        file.seekg(0, std::ios::end);
+
+        uint64_t size = static_cast<uint64_t>(file.tellg());
+        uint64_t header[5];
+
+        file.seekg(0, std::ios::beg);
+        file.read(reinterpret_cast<char*>(header), sizeof(header));
+
+        if (not file.good() or size < sizeof(header) or
+            header[0] != LANDMARKS_FILE_MAGIC or header[1] != sizeof(typeG) or
+            header[4] > 1)
+            return false;
+
+        // Each landmark takes its ID and one or two rows of costs. The sizes are
+        // checked by division, so a corrupt header cannot overflow them
+        uint64_t remaining = size - sizeof(header);
+        uint64_t rowBytes  = sizeof(typeG) * (header[4] ? 2 : 1);
+
+        if (header[2] > remaining / rowBytes)
+            return false;
+
+        uint64_t landmarkBytes = sizeof(uint64_t) + header[2] * rowBytes;
+
+        if (header[3] > remaining / landmarkBytes or
+            header[3] * landmarkBytes != remaining)
+            return false;
+
+        Vector<std::size_t> landmarks;
+
+        for (std::size_t i = 0; i < header[3]; i++)
+        {
+            uint64_t landmark;
+            file.read(reinterpret_cast<char*>(&landmark), sizeof(landmark));
+            landmarks.PushBack(landmark);
+        }
+
+        std::size_t tableSize = header[3] * header[2];
+
+        Vector<typeG> fromLandmarks(tableSize, typeG());
+        Vector<typeG> toLandmarks =
+            header[4] ? Vector<typeG>(tableSize, typeG()) : Vector<typeG>();
+
+        if (tableSize > 0)
+        {
+            file.read(reinterpret_cast<char*>(&fromLandmarks[0]),
+                      tableSize * sizeof(typeG));
+
+            if (header[4])
+                file.read(reinterpret_cast<char*>(&toLandmarks[0]),
+                          tableSize * sizeof(typeG));
+        }
+
+        // The object is only changed by a complete read
+        if (not file.good())
+            return false;
+
+        this->m_numVertices   = header[2];
+        this->m_directed      = header[4];
+        this->m_landmarks     = landmarks;
+        this->m_fromLandmarks = fromLandmarks;
+        this->m_toLandmarks   = toLandmarks;
+
+        return true;
+    }
+} // namespace graph
+
+#endif // LANDMARKS_H_
@@ -0,0 +1,375 @@
+/*
+ * Filename: multi_source_bfs.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef MULTI_SOURCE_BFS_H_
+#define MULTI_SOURCE_BFS_H_
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+
+#include "vector.h"
+
+#include "frozen_graph.h"
+#include "graph.h"
+#include "graph_utils.h"
+#include "parallel.h"
+
+namespace graph
+{
+    /**
+     * @brief One bit per BFS of a batch, 64 BFSs per word
+     */
+    template<std::size_t nWords>
+    using BFSLanes = std::array<uint64_t, nWords>;
+
+    /**
+     * @brief Per-vertex lanes of a batch of BFSs, reused across the batches run by a
+     * thread
+     */
+    template<std::size_t nWords>
+    struct MultiSourceBFSWorkspace
+    {
+            // BFSs that reached each vertex
+            Vector<BFSLanes<nWords>> m_seen;
+
+            // BFSs for which each vertex is in the current frontier
+            Vector<BFSLanes<nWords>> m_visit;
+
+            // BFSs that reach each vertex in the next level, including the ones that
+            // had already reached it
+            Vector<BFSLanes<nWords>> m_next;
+
+            /**
+             * @brief Clear the lanes of all vertices
+             * @param numVertices Size of the vertex ID space of the graph
+             */
+            void Reset(std::size_t numVertices)
+            {
+                if (this->m_seen.Size() != numVertices)
+                {
+                    this->m_seen  = Vector<BFSLanes<nWords>>(numVertices);
+                    this->m_visit = Vector<BFSLanes<nWords>>(numVertices);
+                    this->m_next  = Vector<BFSLanes<nWords>>(numVertices);
+                }
+
+                for (std::size_t v = 0; v < numVertices; v++)
+                {
+                    this->m_seen[v].fill(0);
+                    this->m_visit[v].fill(0);
+                    this->m_next[v].fill(0);
+                }
+            }
+    };
+
+    namespace
+    {
+        template<std::size_t nWords>
+        inline bool AnyLane(const BFSLanes<nWords>& lanes)
+        {
+            uint64_t any = 0;
+
+            for (std::size_t w = 0; w < nWords; w++)
+                any |= lanes[w];
+
+            return any != 0;
+        }
+
+        /**
+         * @brief Call function(lane) for every lane set
+         */
+        template<std::size_t nWords, typename Function>
+        inline void ForEachLane(const BFSLanes<nWords>& lanes, Function function)
+        {
+            for (std::size_t w = 0; w < nWords; w++)
+                for (uint64_t word = lanes[w]; word != 0; word &= word - 1)
+                    function(64 * w + std::countr_zero(word));
+        }
+
+        /**
+         * @brief Run a batch of BFSs together
+         * @param graph The frozen graph to be traversed
+         * @param sources IDs of the source vertices
+         * @param first Index of the source of lane 0. The batch holds up to
+         * 64 * nWords sources
+         * @param workspace The lanes of the batch
+         * @param visit Called as visit(level, vertexID, lanes) with the lanes of the
+         * BFSs that reach the vertex at that level
+         * @param stats Counters of the work done, or nullptr
+         *
+         * Each level scans the arcs of a vertex once for all the BFSs that have it
+         * in their frontier, OR-ing their lanes into the heads. The loops over the
+         * words of the lanes have no dependencies, so they are left to the compiler
+         * to vectorize.
+         */
+        template<std::size_t nWords, typename typeG, typename Visit>
+        inline void MultiSourceBFSBatch(const FrozenGraph<typeG>&        graph,
+                                        const Vector<std::size_t>&       sources,
+                                        std::size_t                      first,
+                                        MultiSourceBFSWorkspace<nWords>& workspace,
+                                        Visit                            visit,
+                                        SearchStatistics*                stats)
+        {
+            std::size_t n    = graph.GetNumVertices();
+            std::size_t last = first + 64 * nWords;
+
+            last = last < sources.Size() ? last : sources.Size();
+
+            workspace.Reset(n);
+
+            bool active = false;
+
+            for (std::size_t i = first; i < last; i++)
+            {
+                if (sources[i] >= n)
+                    continue;
+
+                uint64_t bit = uint64_t(1) << ((i - first) & 63);
+
+                workspace.m_seen[sources[i]][(i - first) >> 6] |= bit;
+                workspace.m_visit[sources[i]][(i - first) >> 6] |= bit;
+                active = true;
+            }
+
+            for (std::size_t v = 0; active and v < n; v++)
+                if (AnyLane(workspace.m_visit[v]))
+                    visit(uint32_t(0), v, workspace.m_visit[v]);
+
+            for (uint32_t level = 1; active; level++)
+            {
+                for (std::size_t u = 0; u < n; u++)
+                {
+                    const BFSLanes<nWords>& lanes = workspace.m_visit[u];
+
+                    if (not AnyLane(lanes))
+                        continue;
+
+                    std::size_t firstArc = graph.GetFirstArc(u);
+                    std::size_t lastArc  = graph.GetLastArc(u);
+
+                    if (stats)
+                    {
+                        stats->m_settledVertices++;
+                        stats->m_relaxedEdges += lastArc - firstArc;
+                    }
+
+                    for (std::size_t arc = firstArc; arc < lastArc; arc++)
+                    {
+                        BFSLanes<nWords>& next = workspace.m_next[graph.GetHead(arc)];
+
+                        for (std::size_t w = 0; w < nWords; w++)
+                            next[w] |= lanes[w];
+                    }
+                }
+
+                active = false;
+
+                // The frontier of the next level holds the BFSs that reach each
+                // vertex for the first time
+                for (std::size_t v = 0; v < n; v++)
+                {
+                    BFSLanes<nWords>& seen  = workspace.m_seen[v];
+                    BFSLanes<nWords>& lanes = workspace.m_visit[v];
+                    BFSLanes<nWords>& next  = workspace.m_next[v];
+
+                    for (std::size_t w = 0; w < nWords; w++)
+                    {
+                        lanes[w] = next[w] & ~seen[w];
+                        seen[w] |= lanes[w];
+                        next[w] = 0;
+                    }
+
+                    if (AnyLane(lanes))
+                    {
+                        active = true;
+                        visit(level, v, lanes);
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Split the sources in batches of 64 * nWords and run them among the
+         * threads, each thread with its own workspace
+         * @param visit Called as visit(first, level, vertexID, lanes), where first is
+         * the index of the source of lane 0 of the batch
+         */
+        template<std::size_t nWords, typename typeG, typename Visit>
+        inline void MultiSourceBFSBatches(const FrozenGraph<typeG>&  graph,
+                                          const Vector<std::size_t>& sources,
+                                          Visit                      visit,
+                                          std::size_t                numThreads,
+                                          SearchStatistics*          stats)
+        {
+            std::size_t batchSize  = 64 * nWords;
+            std::size_t numBatches = (sources.Size() + batchSize - 1) / batchSize;
+
+            numThreads = parallel::GetNumThreads(numThreads);
+
+            std::unique_ptr<MultiSourceBFSWorkspace<nWords>[]> workspaces(
+                new MultiSourceBFSWorkspace<nWords>[numThreads]);
+            Vector<SearchStatistics> counters(numThreads);
+
+            parallel::For(
+                numBatches,
+                [&](std::size_t batch, std::size_t threadIndex) {
+                    std::size_t first = batch * batchSize;
+
+                    MultiSourceBFSBatch(
+                        graph,
+                        sources,
+                        first,
+                        workspaces[threadIndex],
+                        [&](uint32_t                level,
+                            std::size_t             v,
+                            const BFSLanes<nWords>& lanes) {
+                            visit(first, level, v, lanes);
+                        },
+                        &counters[threadIndex]);
+                },
+                numThreads);
+
+            if (stats)
+            {
+                for (std::size_t t = 0; t < numThreads; t++)
+                {
+                    stats->m_settledVertices += counters[t].m_settledVertices;
+                    stats->m_relaxedEdges += counters[t].m_relaxedEdges;
+                }
+            }
+        }
+    } // namespace
+
+    /**
+     * @brief Compute the number of edges from each of a set of sources to every
+     * vertex with bit-parallel BFSs (MS-BFS)
+     * @param graph The frozen graph to be traversed
+     * @param sources IDs of the source vertices
+     * @param hops Receives the number of edges in row-major order, so the hops from
+     * sources[i] to vertex v are hops[i * V + v]. Vertices not reached have the
+     * maximum value of uint32_t
+     * @param numThreads Number of threads to be used. Zero means one thread per
+     * hardware thread
+     * @param stats Optional counters to be filled with the work done by the search.
+     * A vertex is counted once per level in which it is in the frontier of any BFS
+     * of its batch
+     *
+     * The sources run in batches of 64 * nWords BFSs, so nWords = 1, 4 and 8 run 64,
+     * 256 and 512 BFSs at once. Each vertex holds one bit per BFS of the batch for
+     * the BFSs that reached it and for the BFSs that have it in their frontier, so
+     * the arcs of a vertex are scanned once per level for all the BFSs of the batch,
+     * as in Then et al., "The More the Merrier: Efficient Multi-Source Graph
+     * Traversal" (2014). The batches are spread among the threads.
+     *
+     * Complexity: O(D * (V + E) * nWords) per batch, when D is the largest number of
+     * edges from a source of the batch to a vertex it reaches
+     */
+    template<std::size_t nWords = 4, typename typeG>
+    inline void MultiSourceBFS(const FrozenGraph<typeG>&  graph,
+                               const Vector<std::size_t>& sources,
+                               Vector<uint32_t>&          hops,
+                               std::size_t                numThreads = 0,
+                               SearchStatistics*          stats      = nullptr)
+    {
+        std::size_t n = graph.GetNumVertices();
+
+        hops = Vector<uint32_t>(sources.Size() * n,
+                                std::numeric_limits<uint32_t>::max());
+
+        MultiSourceBFSBatches<nWords>(
+            graph,
+            sources,
+            [&](std::size_t             first,
+                uint32_t                level,
+                std::size_t             v,
+                const BFSLanes<nWords>& lanes) {
+                ForEachLane(lanes, [&](std::size_t lane) {
+                    hops[(first + lane) * n + v] = level;
+                });
+            },
+            numThreads,
+            stats);
+    }
+
+    /**
+     * @brief Compute, for each of a set of sources, the sum of the number of edges to
+     * the vertices it reaches and how many vertices it reaches, with bit-parallel
+     * BFSs (MS-BFS)
+     * @param graph The frozen graph to be traversed
+     * @param sources IDs of the source vertices
+     * @param sums Receives the sum of the hops from sources[i] at index i
+     * @param reached Receives the number of vertices reached from sources[i],
+     * including itself, at index i
+     * @param numThreads Number of threads to be used. Zero means one thread per
+     * hardware thread
+     * @param stats Optional counters to be filled with the work done by the search
+     *
+     * The traversals are the ones of MultiSourceBFS, without storing a row of V hops
+     * per source, so closeness centralities of large sets of sources fit in memory:
+     * the closeness of sources[i] is (reached[i] - 1) / sums[i].
+     */
+    template<std::size_t nWords = 4, typename typeG>
+    inline void MultiSourceBFSSums(const FrozenGraph<typeG>&  graph,
+                                   const Vector<std::size_t>& sources,
+                                   Vector<uint64_t>&          sums,
+                                   Vector<std::size_t>&       reached,
+                                   std::size_t                numThreads = 0,
+                                   SearchStatistics*          stats      = nullptr)
+    {
+        sums    = Vector<uint64_t>(sources.Size(), 0);
+        reached = Vector<std::size_t>(sources.Size(), 0);
+
+        // Each batch writes only the entries of its own sources
+        MultiSourceBFSBatches<nWords>(
+            graph,
+            sources,
+            [&](std::size_t             first,
+                uint32_t                level,
+                std::size_t,
+                const BFSLanes<nWords>& lanes) {
+                ForEachLane(lanes, [&](std::size_t lane) {
+                    sums[first + lane] += level;
+                    reached[first + lane]++;
+                });
+            },
+            numThreads,
+            stats);
+    }
+
+    /**
+     * @brief Compute the number of edges from each of a set of sources to every
+     * vertex of a graph with bit-parallel BFSs (MS-BFS)
+     * @param graph The graph to be traversed
+     * @param sources IDs of the source vertices
+     * @param hops Receives the number of edges in row-major order, so the hops from
+     * sources[i] to the vertex with ID v are hops[i * V + v], when V is the size of
+     * the vertex ID space of the graph
+     * @param numThreads Number of threads to be used. Zero means one thread per
+     * hardware thread
+     *
+     * The graph is frozen and traversed by the FrozenGraph overload.
+     */
+    template<std::size_t nWords = 4,
+             typename typeG,
+             typename typeT,
+             std::size_t nDim,
+             bool        directed,
+             typename typeD>
+    inline void MultiSourceBFS(Graph<typeG, typeT, typeD, nDim, directed>& graph,
+                               const Vector<std::size_t>&                  sources,
+                               Vector<uint32_t>&                           hops,
+                               std::size_t numThreads = 0)
+    {
+        FrozenGraph<typeG> frozen(graph);
+
+        MultiSourceBFS<nWords>(frozen, sources, hops, numThreads);
+    }
+} // namespace graph
+
+#endif // MULTI_SOURCE_BFS_H_
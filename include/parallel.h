@@ -0,0 +1,85 @@
+/*
+ * Filename: parallel.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef PARALLEL_H_
+#define PARALLEL_H_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+
+/**
+ * @brief A small namespace with the helpers used to split independent work among
+ * threads
+ */
+namespace parallel
+{
+    /**
+     * @brief Get the number of threads to be used by a parallel step
+     * @param requested Number of threads requested by the caller. Zero means one
+     * thread per hardware thread
+     * @return The number of threads, always at least one
+     */
+    inline std::size_t GetNumThreads(std::size_t requested = 0)
+    {
+        if (requested == 0)
+            requested = std::thread::hardware_concurrency();
+
+        return requested == 0 ? 1 : requested;
+    }
+
+    /**
+     * @brief Run function(i, threadIndex) for every i in [0, count)
+     * @param count Number of iterations
+     * @param function Function called for each iteration. threadIndex is in
+     * [0, GetNumThreads(numThreads)), so it can be used to pick per-thread buffers
+     * @param numThreads Number of threads to be used. Zero means one thread per
+     * hardware thread
+     *
+     * The iterations are handed out one by one through an atomic counter, so
+     * iterations with very different costs (e.g., searches from different sources)
+     * are balanced among the threads. The calling thread takes part in the work as
+     * the thread 0, and the function returns after all iterations are done.
+     */
+    template<typename Function>
+    inline void For(std::size_t count, Function function, std::size_t numThreads = 0)
+    {
+        numThreads = GetNumThreads(numThreads);
+
+        if (numThreads > count)
+            numThreads = count;
+
+        if (numThreads <= 1)
+        {
+            for (std::size_t i = 0; i < count; i++)
+                function(i, 0);
+
+            return;
+        }
+
+        std::atomic<std::size_t> next(0);
+
+        auto Worker = [&](std::size_t threadIndex) {
+            std::size_t i;
+
+            while ((i = next.fetch_add(1, std::memory_order_relaxed)) < count)
+                function(i, threadIndex);
+        };
+
+        std::unique_ptr<std::thread[]> workers(new std::thread[numThreads - 1]);
+
+        for (std::size_t t = 1; t < numThreads; t++)
+            workers[t - 1] = std::thread(Worker, t);
+
+        Worker(0);
+
+        for (std::size_t t = 1; t < numThreads; t++)
+            workers[t - 1].join();
+    }
+} // namespace parallel
+
+#endif // PARALLEL_H_
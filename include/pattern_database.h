@@ -0,0 +1,444 @@
+/*
+ * Filename: pattern_database.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef PATTERN_DATABASE_H_
+#define PATTERN_DATABASE_H_
+
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "vector.h"
+
+#include "parallel.h"
+
+namespace graph
+{
+    namespace implicit
+    {
+        namespace
+        {
+            // Identifies the files written by PatternDatabase::Save
+            constexpr uint64_t PATTERN_DATABASE_FILE_MAGIC = 0x31424450; // "PDB1"
+
+            // Header: magic and number of abstract states
+            constexpr std::size_t PATTERN_DATABASE_HEADER_SIZE = 2 * sizeof(uint64_t);
+
+            // Number of frontier entries handed to a thread at once
+            constexpr std::size_t PATTERN_DATABASE_CHUNK_SIZE = 1024;
+        } // namespace
+
+        /**
+         * @brief Table with the distance from every abstract state to the abstract
+         * goal, used as a heuristic by the searches on implicit graphs
+         *
+         * An abstraction maps the states of a search to a smaller space of abstract
+         * states, numbered from 0 to size - 1, such that every move between states
+         * is also a move between their abstract states. The distance of an abstract
+         * state to the goal is then a lower bound of the distance of its states.
+         *
+         * The distances are stored in 4 bits per abstract state, two per byte, and
+         * saturate at MAX_DISTANCE, which is still a lower bound. Abstract states
+         * that cannot reach the goal also hold MAX_DISTANCE, which is harmless since
+         * their states cannot reach the goal either. A database can be saved to a
+         * file and mapped back into memory, so large databases are built once and
+         * shared by processes through the page cache.
+         */
+        class PatternDatabase
+        {
+            public:
+                // Largest distance stored, which also marks the unreached states
+                static constexpr uint8_t MAX_DISTANCE = 15;
+
+            private:
+                std::size_t m_size;
+
+                // Owned entries, used when the database is not backed by a file
+                Vector<uint8_t> m_owned;
+
+                // Entries read by Get, owned or mapped
+                const uint8_t* m_entries;
+
+                // Mapped file, if any
+                void*       m_mapping;
+                std::size_t m_mappingSize;
+
+                /**
+                 * @brief Release the mapped file, if any
+                 */
+                void Unmap();
+
+                /**
+                 * @brief Store a distance of an abstract state that was not reached
+                 * @return False if the state was already reached
+                 */
+                static bool Claim(uint8_t*    entries,
+                                  std::size_t index,
+                                  uint8_t     distance);
+
+            public:
+                PatternDatabase();
+                ~PatternDatabase();
+
+                PatternDatabase(const PatternDatabase&)            = delete;
+                PatternDatabase& operator=(const PatternDatabase&) = delete;
+
+                /**
+                 * @brief Fill the database with a backward breadth-first search from
+                 * the abstract goals
+                 * @param size Number of abstract states
+                 * @param goals Indices of the abstract goal states
+                 * @param predecessors Callable predecessors(index, emit) that calls
+                 * emit(previous, cost) for each abstract state with a move to index.
+                 * The cost is 0 or 1, so moves of the tiles that are not part of the
+                 * pattern can be free, as needed by additive databases
+                 * @param numThreads Number of threads to be used. Zero means one
+                 * thread per hardware thread
+                 *
+                 * The search is level-synchronous: the frontier of each distance is
+                 * first closed under the free moves and then expanded by the unit
+                 * moves. The frontier is split among the threads, which claim the
+                 * abstract states with an atomic update of their byte, so each state
+                 * is expanded once. The search stops at MAX_DISTANCE.
+                 */
+                template<typename Predecessors>
+                void Build(std::size_t                size,
+                           const Vector<std::size_t>& goals,
+                           Predecessors               predecessors,
+                           std::size_t                numThreads = 0);
+
+                /**
+                 * @brief Write the database to a file, which is created or truncated
+                 * @param path Path of the file
+                 * @return True if the file was written, false otherwise
+                 */
+                bool Save(const std::string& path) const;
+
+                /**
+                 * @brief Map a file written by Save for reading only
+                 * @param path Path of the file
+                 * @return True if the file was mapped, false if it could not be
+                 * opened, is not a pattern database or does not have the size given
+                 * by its header
+                 */
+                bool Map(const std::string& path);
+
+                /**
+                 * @return The number of abstract states
+                 */
+                std::size_t GetSize() const;
+
+                /**
+                 * @param index Index of the abstract state
+                 * @return The distance of the abstract state to the goal, saturated
+                 * at MAX_DISTANCE
+                 */
+                uint8_t Get(std::size_t index) const;
+        };
+
+        inline PatternDatabase::PatternDatabase()
+        {
+            this->m_size        = 0;
+            this->m_entries     = nullptr;
+            this->m_mapping     = nullptr;
+            this->m_mappingSize = 0;
+        }
+
+        inline PatternDatabase::~PatternDatabase()
+        {
+            this->Unmap();
+        }
+
+        inline void PatternDatabase::Unmap()
+        {
+            if (this->m_mapping)
+                munmap(this->m_mapping, this->m_mappingSize);
+
+            this->m_mapping     = nullptr;
+            this->m_mappingSize = 0;
+        }
+
+        inline bool PatternDatabase::Claim(uint8_t*    entries,
+                                           std::size_t index,
+                                           uint8_t     distance)
+        {
+            // The other half of the byte may be claimed at the same time
+            std::atomic_ref<uint8_t> byte(entries[index >> 1]);
+
+            uint8_t shift = (index & 1) * 4;
+            uint8_t entry = byte.load(std::memory_order_relaxed);
+            uint8_t claimed;
+
+            do
+            {
+                if (((entry >> shift) & 0xF) != MAX_DISTANCE)
+                    return false;
+
+                claimed = (entry & ~(0xF << shift)) | (distance << shift);
+            } while (not byte.compare_exchange_weak(
+                entry, claimed, std::memory_order_relaxed));
+
+            return true;
+        }
+
+        template<typename Predecessors>
+        void PatternDatabase::Build(std::size_t                size,
+                                    const Vector<std::size_t>& goals,
+                                    Predecessors               predecessors,
+                                    std::size_t                numThreads)
+        {
+            this->Unmap();
+
+            numThreads = parallel::GetNumThreads(numThreads);
+
+            this->m_size    = size;
+            this->m_owned   = Vector<uint8_t>((size + 1) / 2, 0xFF);
+            this->m_entries = size > 0 ? &this->m_owned[0] : nullptr;
+
+            uint8_t* entries = size > 0 ? &this->m_owned[0] : nullptr;
+
+            Vector<std::size_t> frontier;
+            Vector<std::size_t> candidates;
+
+            for (std::size_t i = 0; i < goals.Size(); i++)
+                if (Claim(entries, goals[i], 0))
+                    frontier.PushBack(goals[i]);
+
+            // Abstract states found by each thread through free and unit moves
+            Vector<Vector<std::size_t>> sameLevel(numThreads);
+            Vector<Vector<std::size_t>> nextLevel(numThreads);
+
+            for (uint8_t distance = 0; distance < MAX_DISTANCE; distance++)
+            {
+                candidates.Clear();
+
+                while (frontier.Size() > 0)
+                {
+                    std::size_t numChunks =
+                        (frontier.Size() + PATTERN_DATABASE_CHUNK_SIZE - 1) /
+                        PATTERN_DATABASE_CHUNK_SIZE;
+
+                    parallel::For(
+                        numChunks,
+                        [&](std::size_t chunk, std::size_t threadIndex) {
+                            std::size_t first = chunk * PATTERN_DATABASE_CHUNK_SIZE;
+                            std::size_t last  = first + PATTERN_DATABASE_CHUNK_SIZE;
+
+                            last = last < frontier.Size() ? last : frontier.Size();
+
+                            auto Emit = [&](std::size_t previous, uint8_t cost) {
+                                if (cost > 0)
+                                    nextLevel[threadIndex].PushBack(previous);
+                                else if (Claim(entries, previous, distance))
+                                    sameLevel[threadIndex].PushBack(previous);
+                            };
+
+                            for (std::size_t i = first; i < last; i++)
+                                predecessors(frontier[i], Emit);
+                        },
+                        numThreads);
+
+                    // The states reached by free moves are at the same distance
+                    frontier.Clear();
+
+                    for (std::size_t t = 0; t < numThreads; t++)
+                    {
+                        for (std::size_t i = 0; i < sameLevel[t].Size(); i++)
+                            frontier.PushBack(sameLevel[t][i]);
+
+                        for (std::size_t i = 0; i < nextLevel[t].Size(); i++)
+                            candidates.PushBack(nextLevel[t][i]);
+
+                        sameLevel[t].Clear();
+                        nextLevel[t].Clear();
+                    }
+                }
+
+                // Unit moves are claimed only after the free moves, which may reach
+                // the same states with a smaller distance
+                for (std::size_t i = 0; i < candidates.Size(); i++)
+                    if (Claim(entries, candidates[i], distance + 1))
+                        frontier.PushBack(candidates[i]);
+
+                if (frontier.Size() == 0)
+                    break;
+            }
+        }
+
+        inline bool PatternDatabase::Save(const std::string& path) const
+        {
+            int file = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+            if (file < 0)
+                return false;
+
+            uint64_t header[2] = { PATTERN_DATABASE_FILE_MAGIC, this->m_size };
+
+            bool written = write(file, header, sizeof(header)) ==
+                           static_cast<ssize_t>(sizeof(header));
+
+            std::size_t size   = (this->m_size + 1) / 2;
+            std::size_t offset = 0;
+
+            // Large writes may be split by the operating system
+            while (written and offset < size)
+            {
+                ssize_t count = write(file, this->m_entries + offset, size - offset);
+
+                written = count > 0;
+                offset += written ? count : 0;
+            }
+
+            return close(file) == 0 and written;
+        }
+
+        inline bool PatternDatabase::Map(const std::string& path)
+        {
+            int file = open(path.c_str(), O_RDONLY);
+
+            if (file < 0)
+                return false;
+
+            struct stat info;
+
+            if (fstat(file, &info) != 0 or
+                static_cast<std::size_t>(info.st_size) < PATTERN_DATABASE_HEADER_SIZE)
+            {
+                close(file);
+                return false;
+            }
+
+            std::size_t size = info.st_size;
+
+            // Check the header before dropping the current database. The number of
+            // entries is bounded by division first, so rounding it up cannot wrap
+            uint64_t header[2];
+
+            if (pread(file, header, sizeof(header), 0) !=
+                    static_cast<ssize_t>(sizeof(header)) or
+                header[0] != PATTERN_DATABASE_FILE_MAGIC or
+                header[1] / 2 > size - PATTERN_DATABASE_HEADER_SIZE or
+                size != PATTERN_DATABASE_HEADER_SIZE + (header[1] + 1) / 2)
+            {
+                close(file);
+                return false;
+            }
+
+            void* mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, file, 0);
+            close(file);
+
+            if (mapping == MAP_FAILED)
+                return false;
+
+            this->Unmap();
+
+            // The database built in memory is no longer needed
+            this->m_owned = Vector<uint8_t>();
+
+            this->m_mapping     = mapping;
+            this->m_mappingSize = size;
+            this->m_size        = header[1];
+            this->m_entries =
+                static_cast<const uint8_t*>(mapping) + PATTERN_DATABASE_HEADER_SIZE;
+
+            return true;
+        }
+
+        inline std::size_t PatternDatabase::GetSize() const
+        {
+            return this->m_size;
+        }
+
+        inline uint8_t PatternDatabase::Get(std::size_t index) const
+        {
+            return (this->m_entries[index >> 1] >> ((index & 1) * 4)) & 0xF;
+        }
+
+        /**
+         * @brief How the distances of several pattern databases are combined
+         */
+        enum class PatternCombination
+        {
+            // Sum, for databases of disjoint patterns where each move is counted by
+            // at most one of them
+            ADDITIVE,
+
+            // Largest distance, for any set of databases
+            MAXIMUM
+        };
+
+        /**
+         * @brief Heuristic of the searches on implicit graphs that looks up a set of
+         * pattern databases
+         *
+         * @tparam Abstraction Callable abstraction(state, k) returning the index of
+         * the abstract state of a state in the k-th database
+         *
+         * An instance is passed as the heuristic of implicit::AStar and
+         * implicit::IDAStar. The databases must outlive it.
+         */
+        template<typename Abstraction>
+        class PatternDatabaseHeuristic
+        {
+            private:
+                Vector<const PatternDatabase*> m_databases;
+                Abstraction                    m_abstraction;
+                PatternCombination             m_combination;
+
+            public:
+                PatternDatabaseHeuristic(
+                    const Vector<const PatternDatabase*>& databases,
+                    Abstraction                           abstraction,
+                    PatternCombination combination = PatternCombination::MAXIMUM);
+
+                /**
+                 * @return The combined distances of the abstract states of a state
+                 */
+                template<typename State>
+                double_t operator()(const State& state) const;
+        };
+
+        template<typename Abstraction>
+        PatternDatabaseHeuristic<Abstraction>::PatternDatabaseHeuristic(
+            const Vector<const PatternDatabase*>& databases,
+            Abstraction                           abstraction,
+            PatternCombination                    combination)
+            : m_databases(databases), m_abstraction(abstraction)
+        {
+            this->m_combination = combination;
+        }
+
+        template<typename Abstraction>
+        template<typename State>
+        double_t PatternDatabaseHeuristic<Abstraction>::operator()(
+            const State& state) const
+        {
+            uint32_t estimate = 0;
+
+            for (std::size_t k = 0; k < this->m_databases.Size(); k++)
+            {
+                uint32_t distance =
+                    this->m_databases[k]->Get(this->m_abstraction(state, k));
+
+                if (this->m_combination == PatternCombination::ADDITIVE)
+                    estimate += distance;
+                else if (distance > estimate)
+                    estimate = distance;
+            }
+
+            return estimate;
+        }
+    } // namespace implicit
+} // namespace graph
+
+#endif // PATTERN_DATABASE_H_
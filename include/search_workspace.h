@@ -0,0 +1,430 @@
+/*
+ * Filename: search_workspace.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef SEARCH_WORKSPACE_H_
+#define SEARCH_WORKSPACE_H_
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "pair.h"
+#include "priority_queue_bheap.h"
+#include "vector.h"
+
+#include "frozen_graph.h"
+#include "graph_utils.h"
+
+namespace graph
+{
+    /**
+     * @brief Reusable per-vertex state of a label-setting search (Dijkstra-like)
+     *
+     * @tparam typeG The type for the cost of the graph's edges
+     *
+     * The costs, predecessors and settled flags live in dense vectors indexed by
+     * vertex ID instead of in the Vertex objects, so the same graph can be searched
+     * by several workspaces at once (e.g., one per thread). Each entry is tagged with
+     * the generation of the query that wrote it, so starting a new query does not
+     * touch all vertices again: entries with an old generation are just ignored.
+     *
+     * A query is driven by the caller:
+     *
+     *      workspace.Reset(graph.GetNumVertices());
+     *      workspace.Update(source, 0, NO_VERTEX, NO_ARC);
+     *
+     *      while (workspace.PopMin(u))
+     *          for each arc (u, v):
+     *              workspace.Update(v, workspace.GetCost(u) + cost, u, arc);
+     */
+    template<typename typeG>
+    class SearchWorkspace
+    {
+        public:
+            // Marks a missing predecessor vertex or arc
+            static constexpr std::size_t NO_VERTEX =
+                std::numeric_limits<std::size_t>::max();
+            static constexpr std::size_t NO_ARC =
+                std::numeric_limits<std::size_t>::max();
+
+        private:
+            Vector<typeG>       m_costs;
+            Vector<std::size_t> m_predecessors;
+            Vector<std::size_t> m_arcs;
+
+            // Generation of the last query that reached/settled each vertex
+            Vector<uint32_t> m_reached;
+            Vector<uint32_t> m_settled;
+
+            uint32_t m_generation;
+
+            // Vertices reached by the current query, in the order they were reached
+            Vector<std::size_t> m_touched;
+
+            // Vertices settled by the current query, in the order they were settled
+            Vector<std::size_t> m_settledOrder;
+
+            // Heuristic of each vertex and generation of the query that computed it.
+            // Only allocated by the informed searches
+            Vector<double_t> m_heuristics;
+            Vector<uint32_t> m_estimated;
+
+            // Pair<first, second> = <cost, vertex ID>
+            bheap::PriorityQueue<Pair<typeG, std::size_t>,
+                                 decltype(compare::Key<typeG, std::size_t>)>
+                m_queue;
+
+        public:
+            SearchWorkspace();
+
+            /**
+             * @brief Start a new query
+             * @param numVertices Size of the vertex ID space of the graph to be
+             * searched
+             *
+             * Only the vertices touched by the previous query are visited, unless the
+             * workspace has to grow
+             */
+            void Reset(std::size_t numVertices);
+
+            /**
+             * @brief Offer a new cost for a vertex
+             * @param vertexID ID of the vertex
+             * @param cost The new cost
+             * @param predecessorID ID of the vertex the cost comes from
+             * @param arc Index of the arc (predecessor, vertex)
+             * @return True if the cost of the vertex was improved and the vertex was
+             * queued, false otherwise
+             */
+            bool Update(std::size_t vertexID,
+                        typeG       cost,
+                        std::size_t predecessorID = NO_VERTEX,
+                        std::size_t arc           = NO_ARC);
+
+            /**
+             * @brief Remove the unsettled vertex with the smallest cost from the queue
+             * and mark it as settled
+             * @param vertexID Receives the ID of the settled vertex
+             * @return False if there are no more vertices to settle
+             */
+            bool PopMin(std::size_t& vertexID);
+
+            /**
+             * @brief PopMin overload that only settles vertices up to a given cost
+             * @param vertexID Receives the ID of the settled vertex
+             * @param maxCost Largest cost that can be settled
+             * @return False if there are no more vertices to settle or the smallest
+             * cost in the queue is larger than maxCost. In the latter case the queue
+             * is left unchanged, so the search can be resumed with a larger bound
+             */
+            bool PopMin(std::size_t& vertexID, typeG maxCost);
+
+            /**
+             * @return True if the vertex was reached by the current query
+             */
+            bool IsReached(std::size_t vertexID) const;
+
+            /**
+             * @return True if the vertex was settled by the current query
+             */
+            bool IsSettled(std::size_t vertexID) const;
+
+            /**
+             * @return Cost of the vertex in the current query, or the maximum value
+             * of typeG if the vertex was not reached
+             */
+            typeG GetCost(std::size_t vertexID) const;
+
+            /**
+             * @return ID of the predecessor of the vertex in the current query, or
+             * NO_VERTEX
+             */
+            std::size_t GetPredecessor(std::size_t vertexID) const;
+
+            /**
+             * @return Index of the arc that reached the vertex in the current query, or
+             * NO_ARC
+             */
+            std::size_t GetArc(std::size_t vertexID) const;
+
+            /**
+             * @brief Heuristic of a vertex, computed at most once per query
+             * @param vertexID ID of the vertex
+             * @param estimate Callable estimate(v) returning the heuristic of vertex
+             * v, only called the first time the vertex is asked for in the query
+             * @param stats Optional counters of the evaluations done and avoided
+             * @return The heuristic of the vertex
+             *
+             * Informed searches ask for the heuristic of a vertex every time they
+             * reach it from a neighbor, so caching it pays off for heuristics that
+             * are expensive to compute, such as landmark lower bounds.
+             */
+            template<typename Estimate>
+            double_t GetHeuristic(std::size_t       vertexID,
+                                  Estimate&&        estimate,
+                                  SearchStatistics* stats = nullptr);
+
+            /**
+             * @return The vertices reached by the current query
+             */
+            const Vector<std::size_t>& GetTouched() const;
+
+            /**
+             * @return The vertices settled by the current query, in settle order
+             */
+            const Vector<std::size_t>& GetSettledOrder() const;
+    };
+
+    template<typename typeG>
+    SearchWorkspace<typeG>::SearchWorkspace()
+    {
+        this->m_generation = 0;
+    }
+
+    template<typename typeG>
+    void SearchWorkspace<typeG>::Reset(std::size_t numVertices)
+    {
+        // Drop the entries left in the queue by a query that stopped early
+        while (not this->m_queue.IsEmpty())
+            this->m_queue.Dequeue();
+
+        this->m_touched.Clear();
+        this->m_settledOrder.Clear();
+
+        this->m_generation++;
+
+        if (this->m_reached.Size() < numVertices or this->m_generation == 0)
+        {
+            this->m_costs        = Vector<typeG>(numVertices, typeG());
+            this->m_predecessors = Vector<std::size_t>(numVertices, NO_VERTEX);
+            this->m_arcs         = Vector<std::size_t>(numVertices, NO_ARC);
+            this->m_reached      = Vector<uint32_t>(numVertices, 0);
+            this->m_settled      = Vector<uint32_t>(numVertices, 0);
+            this->m_generation   = 1;
+
+            // Reallocated by the next informed search, with the new generation
+            this->m_heuristics = Vector<double_t>();
+            this->m_estimated  = Vector<uint32_t>();
+        }
+    }
+
+    template<typename typeG>
+    bool SearchWorkspace<typeG>::Update(std::size_t vertexID,
+                                        typeG       cost,
+                                        std::size_t predecessorID,
+                                        std::size_t arc)
+    {
+        if (this->m_reached[vertexID] == this->m_generation)
+        {
+            if (this->m_settled[vertexID] == this->m_generation or
+                not(cost < this->m_costs[vertexID]))
+                return false;
+        }
+        else
+        {
+            this->m_reached[vertexID] = this->m_generation;
+            this->m_touched.PushBack(vertexID);
+        }
+
+        this->m_costs[vertexID]        = cost;
+        this->m_predecessors[vertexID] = predecessorID;
+        this->m_arcs[vertexID]         = arc;
+
+        this->m_queue.Enqueue(Pair<typeG, std::size_t>(cost, vertexID));
+
+        return true;
+    }
+
+    template<typename typeG>
+    bool SearchWorkspace<typeG>::PopMin(std::size_t& vertexID)
+    {
+        while (not this->m_queue.IsEmpty())
+        {
+            vertexID = this->m_queue.Dequeue().GetSecond();
+
+            // Outdated copies of settled vertices are skipped
+            if (this->m_settled[vertexID] != this->m_generation)
+            {
+                this->m_settled[vertexID] = this->m_generation;
+                this->m_settledOrder.PushBack(vertexID);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    template<typename typeG>
+    bool SearchWorkspace<typeG>::PopMin(std::size_t& vertexID, typeG maxCost)
+    {
+        while (not this->m_queue.IsEmpty())
+        {
+            Pair<typeG, std::size_t> entry = this->m_queue.Dequeue();
+
+            vertexID = entry.GetSecond();
+
+            if (this->m_settled[vertexID] == this->m_generation)
+                continue;
+
+            // Put the entry back, so nothing is lost when the bound is exceeded
+            if (maxCost < entry.GetFirst())
+            {
+                this->m_queue.Enqueue(entry);
+                return false;
+            }
+
+            this->m_settled[vertexID] = this->m_generation;
+            this->m_settledOrder.PushBack(vertexID);
+            return true;
+        }
+
+        return false;
+    }
+
+    template<typename typeG>
+    bool SearchWorkspace<typeG>::IsReached(std::size_t vertexID) const
+    {
+        return this->m_reached[vertexID] == this->m_generation;
+    }
+
+    template<typename typeG>
+    bool SearchWorkspace<typeG>::IsSettled(std::size_t vertexID) const
+    {
+        return this->m_settled[vertexID] == this->m_generation;
+    }
+
+    template<typename typeG>
+    typeG SearchWorkspace<typeG>::GetCost(std::size_t vertexID) const
+    {
+        return this->IsReached(vertexID) ? this->m_costs[vertexID]
+                                         : std::numeric_limits<typeG>::max();
+    }
+
+    template<typename typeG>
+    std::size_t SearchWorkspace<typeG>::GetPredecessor(std::size_t vertexID) const
+    {
+        return this->IsReached(vertexID) ? this->m_predecessors[vertexID] : NO_VERTEX;
+    }
+
+    template<typename typeG>
+    std::size_t SearchWorkspace<typeG>::GetArc(std::size_t vertexID) const
+    {
+        return this->IsReached(vertexID) ? this->m_arcs[vertexID] : NO_ARC;
+    }
+
+    template<typename typeG>
+    template<typename Estimate>
+    double_t SearchWorkspace<typeG>::GetHeuristic(std::size_t       vertexID,
+                                                  Estimate&&        estimate,
+                                                  SearchStatistics* stats)
+    {
+        if (this->m_estimated.Size() < this->m_reached.Size())
+        {
+            this->m_heuristics = Vector<double_t>(this->m_reached.Size(), 0);
+            this->m_estimated  = Vector<uint32_t>(this->m_reached.Size(), 0);
+        }
+
+        if (this->m_estimated[vertexID] == this->m_generation)
+        {
+            if (stats)
+                stats->m_heuristicCacheHits++;
+
+            return this->m_heuristics[vertexID];
+        }
+
+        if (stats)
+            stats->m_heuristicEvaluations++;
+
+        this->m_estimated[vertexID]  = this->m_generation;
+        this->m_heuristics[vertexID] = estimate(vertexID);
+
+        return this->m_heuristics[vertexID];
+    }
+
+    template<typename typeG>
+    const Vector<std::size_t>& SearchWorkspace<typeG>::GetTouched() const
+    {
+        return this->m_touched;
+    }
+
+    template<typename typeG>
+    const Vector<std::size_t>& SearchWorkspace<typeG>::GetSettledOrder() const
+    {
+        return this->m_settledOrder;
+    }
+
+    /**
+     * @brief Get the path to a target vertex from the shortest path tree kept in a
+     * workspace
+     * @param graph The frozen graph that was searched
+     * @param workspace The workspace holding the tree of the last query
+     * @param targetID ID of the vertex whose predecessors are followed
+     * @param path Receives the path, its previous content is cleared
+     * @param backward True if the query followed the reversed arcs, then the path
+     * starts at targetID and ends at the source of the query
+     * @return True if the target was reached by the last query, False otherwise
+     */
+    template<typename typeG>
+    inline bool GetPath(const FrozenGraph<typeG>&     graph,
+                        const SearchWorkspace<typeG>& workspace,
+                        std::size_t                   targetID,
+                        PathResult<typeG>&            path,
+                        bool                          backward = false)
+    {
+        path.Clear();
+
+        if (targetID >= graph.GetNumVertices() or not workspace.IsReached(targetID))
+            return false;
+
+        // The arc costs are collected first and summed once the order is final
+        Vector<typeG>& costs = path.m_costs;
+
+        std::size_t v = targetID;
+        path.m_vertexIDs.PushBack(v);
+
+        while (workspace.GetArc(v) != SearchWorkspace<typeG>::NO_ARC)
+        {
+            std::size_t arc = workspace.GetArc(v);
+
+            path.m_edgeIDs.PushBack(graph.GetEdgeID(arc, backward));
+            costs.PushBack(graph.GetCost(arc, backward));
+
+            v = workspace.GetPredecessor(v);
+            path.m_vertexIDs.PushBack(v);
+        }
+
+        // A forward tree is walked from the last vertex of the path
+        if (not backward)
+        {
+            path.Reverse();
+
+            for (std::size_t i = 0, j = costs.Size(); i + 1 < j;)
+            {
+                typeG cost = costs[i];
+                costs[i++] = costs[--j];
+                costs[j]   = cost;
+            }
+        }
+
+        typeG cost = 0;
+        costs.PushBack(cost);
+
+        // Shift the arc costs one position right while turning them into prefix sums
+        for (std::size_t i = 0; i + 1 < costs.Size(); i++)
+        {
+            typeG arcCost = costs[i];
+
+            costs[i] = cost;
+            cost     = cost + arcCost;
+        }
+        costs[costs.Size() - 1] = cost;
+
+        return true;
+    }
+} // namespace graph
+
+#endif // SEARCH_WORKSPACE_H_
@@ -0,0 +1,371 @@
+/*
+ * Filename: shortest_path_tree_cache.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef SHORTEST_PATH_TREE_CACHE_H_
+#define SHORTEST_PATH_TREE_CACHE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "vector.h"
+
+#include "dijkstra.h"
+#include "frozen_graph.h"
+#include "graph_utils.h"
+#include "search_workspace.h"
+
+namespace graph
+{
+    /**
+     * @brief Least recently used cache of the shortest path trees of a frozen graph,
+     * keyed by the source vertex
+     *
+     * @tparam typeG The type for the cost of the graph's edges
+     *
+     * Queries from a source whose tree is cached are answered by a lookup in the
+     * tree. Otherwise a Dijkstra search builds the whole tree of the source, which
+     * is stored as three dense arrays (cost, parent vertex and parent arc of each
+     * vertex) and replaces the least recently used tree when the memory budget is
+     * full. If the budget cannot hold a single tree the cache still works, but only
+     * keeps the tree of the last source.
+     *
+     * The cache is tied to a frozen graph and checks its version on every query, so
+     * refreezing the graph after edge costs were changed drops all the trees. Since
+     * a query may change the cache, an instance must not be shared among threads.
+     */
+    template<typename typeG>
+    class ShortestPathTreeCache
+    {
+        private:
+            // Marks a missing tree or parent
+            static constexpr uint32_t NO_ENTRY = std::numeric_limits<uint32_t>::max();
+
+            struct Tree
+            {
+                    std::size_t      m_sourceID;
+                    Vector<typeG>    m_costs;
+                    Vector<uint32_t> m_parents;
+                    Vector<uint32_t> m_arcs;
+
+                    // Neighbors in the recency list
+                    uint32_t m_newer;
+                    uint32_t m_older;
+            };
+
+            const FrozenGraph<typeG>* m_graph;
+            bool                      m_backward;
+            uint64_t                  m_version;
+
+            std::size_t m_memoryBudget;
+            std::size_t m_capacity;
+
+            Vector<Tree> m_trees;
+
+            // Index in m_trees of the tree of each source, or NO_ENTRY
+            Vector<uint32_t> m_treeOf;
+
+            // Ends of the recency list
+            uint32_t m_newest;
+            uint32_t m_oldest;
+
+            SearchWorkspace<typeG> m_workspace;
+
+            std::size_t m_hits;
+            std::size_t m_misses;
+
+            /**
+             * @brief Move a tree to the front of the recency list
+             */
+            void Touch(uint32_t index);
+
+            /**
+             * @brief Remove a tree from the recency list
+             */
+            void Unlink(uint32_t index);
+
+            /**
+             * @brief Get the tree of a source, building it if it is not cached
+             * @return Index of the tree in m_trees
+             */
+            uint32_t FindTree(std::size_t sourceID);
+
+        public:
+            /**
+             * @param graph The frozen graph to be searched, which must outlive the
+             * cache
+             * @param memoryBudget Largest number of bytes taken by the cached trees
+             * @param backward True to cache the trees of the reversed arcs, which
+             * hold the costs from all vertices to the source
+             */
+            ShortestPathTreeCache(const FrozenGraph<typeG>& graph,
+                                  std::size_t               memoryBudget,
+                                  bool                      backward = false);
+
+            /**
+             * @brief Cost of the shortest path between two vertices
+             * @param sourceID ID of the source vertex, whose tree is used
+             * @param targetID ID of the target vertex
+             * @return The cost, or the maximum value of typeG if the target cannot be
+             * reached
+             */
+            typeG GetCost(std::size_t sourceID, std::size_t targetID);
+
+            /**
+             * @brief Get the shortest path between two vertices
+             * @param sourceID ID of the source vertex, whose tree is used
+             * @param targetID ID of the target vertex
+             * @param path Receives the path, its previous content is cleared. For a
+             * backward cache the path goes from the target to the source
+             * @return True if the target can be reached, False otherwise
+             */
+            bool GetPath(std::size_t        sourceID,
+                         std::size_t        targetID,
+                         PathResult<typeG>& path);
+
+            /**
+             * @brief Drop all the cached trees
+             */
+            void Invalidate();
+
+            /**
+             * @return The number of trees in the cache
+             */
+            std::size_t GetNumTrees() const;
+
+            /**
+             * @return The number of bytes taken by the trees in the cache
+             */
+            std::size_t GetMemoryUsage() const;
+
+            /**
+             * @return The number of queries answered by a cached tree
+             */
+            std::size_t GetNumHits() const;
+
+            /**
+             * @return The number of queries that had to build a tree
+             */
+            std::size_t GetNumMisses() const;
+    };
+
+    template<typename typeG>
+    ShortestPathTreeCache<typeG>::ShortestPathTreeCache(
+        const FrozenGraph<typeG>& graph,
+        std::size_t               memoryBudget,
+        bool                      backward)
+    {
+        this->m_graph        = &graph;
+        this->m_backward     = backward;
+        this->m_memoryBudget = memoryBudget;
+        this->m_hits         = 0;
+        this->m_misses       = 0;
+
+        this->Invalidate();
+    }
+
+    template<typename typeG>
+    void ShortestPathTreeCache<typeG>::Invalidate()
+    {
+        std::size_t n = this->m_graph->GetNumVertices();
+
+        std::size_t treeBytes = n * (sizeof(typeG) + 2 * sizeof(uint32_t));
+
+        // The tree of the last source is always kept, even over the budget
+        this->m_capacity = treeBytes == 0 ? 1 : this->m_memoryBudget / treeBytes;
+        this->m_capacity = this->m_capacity < 1 ? 1 : this->m_capacity;
+        this->m_version  = this->m_graph->GetVersion();
+
+        this->m_trees  = Vector<Tree>();
+        this->m_treeOf = Vector<uint32_t>(n, NO_ENTRY);
+        this->m_newest = NO_ENTRY;
+        this->m_oldest = NO_ENTRY;
+    }
+
+    template<typename typeG>
+    void ShortestPathTreeCache<typeG>::Unlink(uint32_t index)
+    {
+        Tree& tree = this->m_trees[index];
+
+        if (tree.m_newer != NO_ENTRY)
+            this->m_trees[tree.m_newer].m_older = tree.m_older;
+        else
+            this->m_newest = tree.m_older;
+
+        if (tree.m_older != NO_ENTRY)
+            this->m_trees[tree.m_older].m_newer = tree.m_newer;
+        else
+            this->m_oldest = tree.m_newer;
+
+        tree.m_newer = NO_ENTRY;
+        tree.m_older = NO_ENTRY;
+    }
+
+    template<typename typeG>
+    void ShortestPathTreeCache<typeG>::Touch(uint32_t index)
+    {
+        if (this->m_newest == index)
+            return;
+
+        // Trees just built are not in the list yet
+        if (this->m_trees[index].m_newer != NO_ENTRY)
+            this->Unlink(index);
+
+        this->m_trees[index].m_older = this->m_newest;
+        this->m_trees[index].m_newer = NO_ENTRY;
+
+        if (this->m_newest != NO_ENTRY)
+            this->m_trees[this->m_newest].m_newer = index;
+
+        this->m_newest = index;
+
+        if (this->m_oldest == NO_ENTRY)
+            this->m_oldest = index;
+    }
+
+    template<typename typeG>
+    uint32_t ShortestPathTreeCache<typeG>::FindTree(std::size_t sourceID)
+    {
+        if (this->m_graph->GetVersion() != this->m_version)
+            this->Invalidate();
+
+        uint32_t index = this->m_treeOf[sourceID];
+
+        if (index != NO_ENTRY)
+        {
+            this->m_hits++;
+            this->Touch(index);
+
+            return index;
+        }
+
+        this->m_misses++;
+
+        std::size_t n = this->m_graph->GetNumVertices();
+
+        // Reuse the arrays of the least recently used tree when the cache is full
+        if (this->m_trees.Size() < this->m_capacity)
+        {
+            index = this->m_trees.Size();
+
+            Tree tree;
+            tree.m_sourceID = sourceID;
+            tree.m_costs    = Vector<typeG>(n, typeG());
+            tree.m_parents  = Vector<uint32_t>(n, NO_ENTRY);
+            tree.m_arcs     = Vector<uint32_t>(n, NO_ENTRY);
+            tree.m_newer    = NO_ENTRY;
+            tree.m_older    = NO_ENTRY;
+
+            this->m_trees.PushBack(tree);
+        }
+        else
+        {
+            index = this->m_oldest;
+
+            this->Unlink(index);
+            this->m_treeOf[this->m_trees[index].m_sourceID] = NO_ENTRY;
+        }
+
+        Dijkstra(*this->m_graph, sourceID, this->m_workspace, this->m_backward);
+
+        Tree& tree = this->m_trees[index];
+
+        tree.m_sourceID = sourceID;
+
+        for (std::size_t v = 0; v < n; v++)
+        {
+            tree.m_costs[v] = this->m_workspace.GetCost(v);
+
+            std::size_t parent = this->m_workspace.GetPredecessor(v);
+
+            tree.m_parents[v] =
+                parent == SearchWorkspace<typeG>::NO_VERTEX ? NO_ENTRY : parent;
+            tree.m_arcs[v] = parent == SearchWorkspace<typeG>::NO_VERTEX
+                                 ? NO_ENTRY
+                                 : this->m_workspace.GetArc(v);
+        }
+
+        this->m_treeOf[sourceID] = index;
+        this->Touch(index);
+
+        return index;
+    }
+
+    template<typename typeG>
+    typeG ShortestPathTreeCache<typeG>::GetCost(std::size_t sourceID,
+                                                std::size_t targetID)
+    {
+        if (sourceID >= this->m_graph->GetNumVertices() or
+            targetID >= this->m_graph->GetNumVertices())
+            return std::numeric_limits<typeG>::max();
+
+        return this->m_trees[this->FindTree(sourceID)].m_costs[targetID];
+    }
+
+    template<typename typeG>
+    bool ShortestPathTreeCache<typeG>::GetPath(std::size_t        sourceID,
+                                               std::size_t        targetID,
+                                               PathResult<typeG>& path)
+    {
+        path.Clear();
+
+        if (this->GetCost(sourceID, targetID) == std::numeric_limits<typeG>::max())
+            return false;
+
+        const Tree& tree = this->m_trees[this->m_treeOf[sourceID]];
+
+        for (std::size_t v = targetID; v != sourceID; v = tree.m_parents[v])
+        {
+            path.m_vertexIDs.PushBack(v);
+            path.m_edgeIDs.PushBack(
+                this->m_graph->GetEdgeID(tree.m_arcs[v], this->m_backward));
+        }
+
+        path.m_vertexIDs.PushBack(sourceID);
+
+        // A forward tree is walked from the last vertex of the path
+        if (not this->m_backward)
+            path.Reverse();
+
+        // The tree costs are the cumulative costs, counted from the source
+        typeG first = tree.m_costs[path.m_vertexIDs[0]];
+
+        for (std::size_t i = 0; i < path.m_vertexIDs.Size(); i++)
+        {
+            typeG cost = tree.m_costs[path.m_vertexIDs[i]];
+            path.m_costs.PushBack(this->m_backward ? first - cost : cost);
+        }
+
+        return true;
+    }
+
+    template<typename typeG>
+    std::size_t ShortestPathTreeCache<typeG>::GetNumTrees() const
+    {
+        return this->m_trees.Size();
+    }
+
+    template<typename typeG>
+    std::size_t ShortestPathTreeCache<typeG>::GetMemoryUsage() const
+    {
+        return this->m_trees.Size() * this->m_graph->GetNumVertices() *
+               (sizeof(typeG) + 2 * sizeof(uint32_t));
+    }
+
+    template<typename typeG>
+    std::size_t ShortestPathTreeCache<typeG>::GetNumHits() const
+    {
+        return this->m_hits;
+    }
+
+    template<typename typeG>
+    std::size_t ShortestPathTreeCache<typeG>::GetNumMisses() const
+    {
+        return this->m_misses;
+    }
+} // namespace graph
+
+#endif // SHORTEST_PATH_TREE_CACHE_H_
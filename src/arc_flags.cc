@@ -0,0 +1,7 @@
+/*
+ * Filename: arc_flags.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "arc_flags.h"
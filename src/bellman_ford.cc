@@ -0,0 +1,7 @@
+/*
+ * Filename: bellman_ford.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "bellman_ford.h"
@@ -0,0 +1,7 @@
+/*
+ * Filename: bidirectional_a_star.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "bidirectional_a_star.h"
@@ -0,0 +1,7 @@
+/*
+ * Filename: contraction_hierarchy.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "contraction_hierarchy.h"
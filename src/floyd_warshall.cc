@@ -0,0 +1,7 @@
+/*
+ * Filename: floyd_warshall.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "floyd_warshall.h"
@@ -0,0 +1,7 @@
+/*
+ * Filename: frozen_graph.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "frozen_graph.h"
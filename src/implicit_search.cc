@@ -0,0 +1,7 @@
+/*
+ * Filename: implicit_search.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "implicit_search.h"
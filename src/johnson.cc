@@ -0,0 +1,7 @@
+/*
+ * Filename: johnson.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "johnson.h"
@@ -0,0 +1,7 @@
+/*
+ * Filename: k_shortest_paths.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "k_shortest_paths.h"
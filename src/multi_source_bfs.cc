@@ -0,0 +1,7 @@
+/*
+ * Filename: multi_source_bfs.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "multi_source_bfs.h"
@@ -0,0 +1,7 @@
+/*
+ * Filename: pattern_database.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "pattern_database.h"
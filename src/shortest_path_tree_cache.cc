@@ -0,0 +1,7 @@
+/*
+ * Filename: shortest_path_tree_cache.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "shortest_path_tree_cache.h"
@@ -44,4 +44,51 @@ TEST_CASE("A* Search algorithm test")
     graph::AStar(graph, 4, 0);
 
     CHECK_EQ(graph.GetVertex(0).GetCurrentCost(), 21);
+
+    // Heuristics given as policies, including user-defined ones
+    graph::AStar(graph, 4, 0, heuristics::distance::ManhattanPolicy());
+
+    CHECK_EQ(graph.GetVertex(0).GetCurrentCost(), 21);
+
+    std::size_t calls = 0;
+
+    graph::AStar(graph, 4, 0, [&calls](auto*, auto*) -> double_t {
+        calls++;
+        return 0;
+    });
+
+    CHECK_EQ(graph.GetVertex(0).GetCurrentCost(), 21);
+    CHECK(calls > 0);
+
+    // Each heuristic is computed once per query, even for vertices reached from
+    // several neighbors
+    graph::SearchStatistics stats;
+
+    calls = 0;
+
+    graph::AStar(
+        graph,
+        4,
+        0,
+        [&calls](auto* v, auto* t) -> double_t {
+            calls++;
+            return heuristics::distance::Euclidean(v, t);
+        },
+        &stats);
+
+    CHECK_EQ(graph.GetVertex(0).GetCurrentCost(), 21);
+    CHECK(calls == stats.m_heuristicEvaluations);
+    CHECK(stats.m_heuristicEvaluations <= 9);
+    CHECK(stats.m_heuristicCacheHits > 0);
+
+    // The Euclidean policy scores the neighbors of each expansion in one block,
+    // with the same result and the same work as the pairwise lambda above
+    graph::SearchStatistics batchStats;
+
+    graph::AStar(graph, 4, 0, heuristics::distance::EuclideanPolicy(), &batchStats);
+
+    CHECK_EQ(graph.GetVertex(0).GetCurrentCost(), 21);
+    CHECK(batchStats.m_settledVertices == stats.m_settledVertices);
+    CHECK(batchStats.m_heuristicEvaluations == stats.m_heuristicEvaluations);
+    CHECK(batchStats.m_heuristicCacheHits == stats.m_heuristicCacheHits);
 }
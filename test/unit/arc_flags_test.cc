@@ -0,0 +1,170 @@
+/*
+ * Filename: arc_flags_test.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "doctest.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+
+#include "arc_flags.h"
+#include "dijkstra.h"
+#include "frozen_graph.h"
+#include "search_workspace.h"
+
+#include "test_graphs.h"
+
+TEST_CASE("Arc flags with a given partition")
+{
+    graph::Graph<uint32_t, uint32_t> graph;
+
+    for (std::size_t i = 0; i < 10; i++)
+        graph.AddVertex();
+
+    // This graph can be found in the book 'Introduction to Algorithms,' by Thomas
+    // Cormen, third edition, Figure 23.5. Vertex 9 is isolated
+    graph.AddEdge(0, 1, 4);
+    graph.AddEdge(0, 7, 8);
+    graph.AddEdge(1, 7, 11);
+    graph.AddEdge(1, 2, 8);
+    graph.AddEdge(2, 3, 7);
+    graph.AddEdge(2, 8, 2);
+    graph.AddEdge(2, 5, 4);
+    graph.AddEdge(3, 4, 9);
+    graph.AddEdge(3, 5, 14);
+    graph.AddEdge(4, 5, 10);
+    graph.AddEdge(5, 6, 2);
+    graph.AddEdge(6, 7, 1);
+    graph.AddEdge(6, 8, 6);
+    graph.AddEdge(7, 8, 7);
+
+    graph::FrozenGraph<uint32_t>     frozen(graph);
+    graph::SearchWorkspace<uint32_t> workspace;
+    graph::SearchWorkspace<uint32_t> reference;
+
+    graph::ArcFlags<uint32_t> flags;
+    flags.Build(frozen, Vector<uint32_t>{ 0, 0, 0, 1, 1, 1, 2, 2, 2, 2 }, 2);
+
+    CHECK(flags.GetNumRegions() == 3);
+    CHECK(flags.GetRegion(4) == 1);
+
+    // Arcs inside a region are always flagged, so the region of 3, 4 and 5 has at
+    // least their 6 arcs
+    CHECK(flags.GetNumFlags(1) >= 6);
+    CHECK(flags.GetNumFlags(1) < frozen.GetNumArcs());
+
+    bool sameCosts = true;
+
+    for (std::size_t s = 0; s < 10; s++)
+    {
+        graph::Dijkstra(frozen, s, reference);
+
+        for (std::size_t t = 0; t < 10; t++)
+        {
+            uint32_t cost = graph::ArcFlagsDijkstra(frozen, flags, s, t, workspace);
+
+            sameCosts = sameCosts and
+                        cost == (reference.IsSettled(t)
+                                     ? reference.GetCost(t)
+                                     : std::numeric_limits<uint32_t>::max());
+        }
+    }
+
+    CHECK(sameCosts);
+}
+
+TEST_CASE("Arc flags with a kd partition of the coordinates")
+{
+    graph::Graph<uint32_t, int32_t, bool, 2, true> graph;
+
+    uint32_t side = 20;
+
+    // Directed grid where every edge costs at least 10 per unit of distance
+    BuildTravelTimeGrid(graph, side);
+
+    graph::FrozenGraph<uint32_t>     frozen(graph);
+    graph::SearchWorkspace<uint32_t> workspace;
+    graph::SearchWorkspace<uint32_t> reference;
+
+    graph::ArcFlags<uint32_t> flags;
+    graph::ArcFlags<uint32_t> serial;
+    graph::ArcFlags<uint32_t> single;
+
+    flags.Build(graph, frozen, 6, 3);
+    serial.Build(graph, frozen, 6, 1);
+    single.Build(graph, frozen, 1, 1);
+
+    REQUIRE(flags.GetNumRegions() == 6);
+
+    Vector<std::size_t> regionSizes(6, 0);
+
+    for (std::size_t v = 0; v < frozen.GetNumVertices(); v++)
+        regionSizes[flags.GetRegion(v)]++;
+
+    for (std::size_t r = 0; r < 6; r++)
+    {
+        CHECK(regionSizes[r] >= 66);
+        CHECK(regionSizes[r] <= 67);
+        CHECK(flags.GetNumFlags(r) == serial.GetNumFlags(r));
+        CHECK(flags.GetNumFlags(r) < frozen.GetNumArcs());
+    }
+
+    CHECK(single.GetNumFlags(0) == frozen.GetNumArcs());
+
+    auto Manhattan = [side](std::size_t v, std::size_t t) -> double_t {
+        return 10.0 * (std::abs(int32_t(v / side) - int32_t(t / side)) +
+                       std::abs(int32_t(v % side) - int32_t(t % side)));
+    };
+
+    bool sameCosts = true;
+
+    graph::SearchStatistics pruned;
+    graph::SearchStatistics unpruned;
+    graph::SearchStatistics guided;
+
+    for (std::size_t s = 0; s < frozen.GetNumVertices(); s += 37)
+    {
+        graph::Dijkstra(frozen, s, reference);
+
+        for (std::size_t t = 0; t < frozen.GetNumVertices(); t += 23)
+        {
+            uint32_t cost =
+                graph::ArcFlagsDijkstra(frozen, flags, s, t, workspace, &pruned);
+            uint32_t full =
+                graph::ArcFlagsDijkstra(frozen, single, s, t, workspace, &unpruned);
+            uint32_t astar = graph::ArcFlagsAStar(
+                frozen,
+                flags,
+                s,
+                t,
+                [&](std::size_t v) { return Manhattan(v, t); },
+                workspace,
+                &guided);
+
+            sameCosts = sameCosts and cost == reference.GetCost(t) and
+                        full == reference.GetCost(t) and astar == reference.GetCost(t);
+        }
+    }
+
+    CHECK(sameCosts);
+    CHECK(pruned.m_relaxedEdges < unpruned.m_relaxedEdges);
+    CHECK(guided.m_settledVertices < pruned.m_settledVertices);
+    CHECK(guided.m_heuristicCacheHits > 0);
+
+    // A vertex without coordinates is put in region 0 and is still reached
+    std::size_t hidden = graph.AddVertex().GetID();
+    graph.AddEdge(0, hidden, 1);
+    graph.AddEdge(hidden, side * side - 1, 1);
+
+    graph::FrozenGraph<uint32_t> extended(graph);
+    flags.Build(graph, extended, 6, 1);
+
+    CHECK(flags.GetRegion(hidden) == 0);
+    CHECK(graph::ArcFlagsDijkstra(extended, flags, 0, hidden, workspace) == 1);
+    CHECK(graph::ArcFlagsDijkstra(extended, flags, 0, side * side - 1, workspace) ==
+          2);
+}
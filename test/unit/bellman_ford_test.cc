@@ -0,0 +1,174 @@
+/*
+ * Filename: bellman_ford_test.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "doctest.h"
+
+#include <cstdint>
+#include <limits>
+
+#include "bellman_ford.h"
+#include "dijkstra.h"
+#include "frozen_graph.h"
+#include "search_workspace.h"
+
+#include "test_graphs.h"
+
+TEST_CASE("Bellman-Ford algorithm test")
+{
+    graph::Graph<int32_t, int32_t, bool, 2, true> graph;
+
+    for (std::size_t i = 0; i < 6; i++)
+        graph.AddVertex();
+
+    // This graph can be found in the book 'Introduction to Algorithms,' by Thomas
+    // Cormen, third edition, Figure 24.4, with s = 0, t = 1, x = 2, y = 3, z = 4.
+    // Vertex 5 is isolated
+    graph.AddEdge(0, 1, 6);
+    graph.AddEdge(0, 3, 7);
+    graph.AddEdge(1, 2, 5);
+    graph.AddEdge(1, 3, 8);
+    graph.AddEdge(1, 4, -4);
+    graph.AddEdge(2, 1, -2);
+    graph.AddEdge(3, 2, -3);
+    graph.AddEdge(3, 4, 9);
+    graph.AddEdge(4, 0, 2);
+    graph.AddEdge(4, 2, 7);
+
+    graph::FrozenGraph<int32_t> frozen(graph);
+
+    Vector<int32_t>     costs;
+    Vector<std::size_t> predecessors;
+
+    for (std::size_t numThreads : { 1, 3 })
+    {
+        CHECK(graph::BellmanFord(frozen, 0, costs, predecessors, numThreads));
+
+        CHECK(costs[0] == 0);
+        CHECK(costs[1] == 2);
+        CHECK(costs[2] == 4);
+        CHECK(costs[3] == 7);
+        CHECK(costs[4] == -2);
+        CHECK(costs[5] == std::numeric_limits<int32_t>::max());
+
+        CHECK(predecessors[0] == graph::SearchWorkspace<int32_t>::NO_VERTEX);
+        CHECK(predecessors[1] == 2);
+        CHECK(predecessors[2] == 3);
+        CHECK(predecessors[3] == 0);
+        CHECK(predecessors[4] == 1);
+        CHECK(predecessors[5] == graph::SearchWorkspace<int32_t>::NO_VERTEX);
+    }
+
+    // Costs to vertex 4
+    CHECK(graph::BellmanFord(frozen, 4, costs, predecessors, 2, true));
+
+    CHECK(costs[0] == -2);
+    CHECK(costs[1] == -4);
+    CHECK(costs[2] == -6);
+    CHECK(costs[3] == -9);
+    CHECK(costs[4] == 0);
+
+    // A negative cycle 5 -> 6 -> 5 reachable from vertex 2
+    graph.AddVertex();
+    graph.AddEdge(2, 5, 1);
+    graph.AddEdge(5, 6, -1);
+    graph.AddEdge(6, 5, -1);
+
+    graph::FrozenGraph<int32_t> cyclic(graph);
+
+    CHECK(not graph::BellmanFord(cyclic, 0, costs, predecessors, 2));
+
+    // Costs to vertex 3 do not go through the cycle
+    CHECK(graph::BellmanFord(cyclic, 3, costs, predecessors, 2, true));
+    CHECK(costs[0] == 7);
+    CHECK(costs[2] == 3);
+    CHECK(costs[4] == 9);
+}
+
+TEST_CASE("Bellman-Ford matches Dijkstra on non-negative costs")
+{
+    graph::Graph<uint32_t, int32_t, bool, 2, true> graph;
+
+    uint32_t side = 40;
+
+    BuildTravelTimeGrid(graph, side);
+
+    graph::FrozenGraph<uint32_t>     frozen(graph);
+    graph::SearchWorkspace<uint32_t> workspace;
+
+    Vector<uint32_t>    costs;
+    Vector<std::size_t> predecessors;
+
+    graph::Dijkstra(frozen, 817, workspace);
+
+    CHECK(graph::BellmanFord(frozen, 817, costs, predecessors, 4));
+
+    bool sameCosts = true;
+
+    for (std::size_t v = 0; v < frozen.GetNumVertices(); v++)
+        sameCosts = sameCosts and costs[v] == workspace.GetCost(v);
+
+    CHECK(sameCosts);
+}
+
+TEST_CASE("Multi-source Bellman-Ford with large frontiers")
+{
+    graph::Graph<int32_t, int32_t, bool, 2, true> graph;
+
+    int32_t side = 40;
+
+    BuildTravelTimeGrid(graph, side, true);
+
+    graph::FrozenGraph<int32_t> frozen(graph);
+
+    // Every vertex is a source, so the first rounds split their frontiers among the
+    // threads
+    Vector<std::size_t> sources;
+
+    for (std::size_t v = 0; v < frozen.GetNumVertices(); v++)
+        sources.PushBack(v);
+
+    Vector<int32_t>     costs;
+    Vector<std::size_t> predecessors;
+
+    CHECK(graph::MultiSourceBellmanFord(frozen, sources, costs, predecessors, 4));
+
+    // No arc can improve a cost, and each predecessor gives the cost of its vertex
+    bool relaxed = true;
+    bool tight   = true;
+
+    for (std::size_t u = 0; u < frozen.GetNumVertices(); u++)
+    {
+        relaxed = relaxed and costs[u] <= 0;
+
+        for (std::size_t arc = frozen.GetFirstArc(u); arc < frozen.GetLastArc(u);
+             arc++)
+        {
+            std::size_t v    = frozen.GetHead(arc);
+            int32_t     cost = costs[u] + frozen.GetCost(arc);
+
+            relaxed = relaxed and costs[v] <= cost;
+
+            if (predecessors[v] == u)
+                tight = tight and costs[v] == cost;
+        }
+    }
+
+    CHECK(relaxed);
+    CHECK(tight);
+
+    Vector<int32_t>     serialCosts;
+    Vector<std::size_t> serialPredecessors;
+
+    CHECK(graph::MultiSourceBellmanFord(
+        frozen, sources, serialCosts, serialPredecessors, 1));
+
+    bool sameCosts = true;
+
+    for (std::size_t v = 0; v < frozen.GetNumVertices(); v++)
+        sameCosts = sameCosts and costs[v] == serialCosts[v];
+
+    CHECK(sameCosts);
+}
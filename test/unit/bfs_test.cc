@@ -6,6 +6,9 @@
 
 #include "doctest.h"
 
+#include <cstdint>
+#include <limits>
+
 #include "bfs.h"
 
 TEST_CASE("BFS algorithm test")
@@ -54,3 +57,95 @@ TEST_CASE("BFS algorithm test")
     CHECK(graph.GetVertices().At(7).GetCurrentCost() == 1);
     CHECK(graph.GetVertices().At(8).GetCurrentCost() == 2);
 }
+
+TEST_CASE("Direction-optimizing BFS")
+{
+    constexpr uint32_t NO_HOP = std::numeric_limits<uint32_t>::max();
+
+    // A directed graph with a few long chains and many random shortcuts, so the
+    // search takes both top-down and bottom-up steps. Vertex 0 has no incoming arc
+    // and is unreachable from 1
+    constexpr std::size_t NUM_VERTICES = 3000;
+
+    graph::Graph<uint32_t, uint32_t, bool, 2, true> graph;
+
+    for (std::size_t i = 0; i < NUM_VERTICES; i++)
+        graph.AddVertex();
+
+    uint64_t seed = 12345;
+
+    auto Random = [&]() {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        return std::size_t(seed >> 33);
+    };
+
+    for (std::size_t i = 1; i + 1 < NUM_VERTICES; i++)
+        graph.AddEdge(i, i + 1);
+
+    for (std::size_t i = 0; i < 4 * NUM_VERTICES; i++)
+    {
+        std::size_t u = Random() % NUM_VERTICES;
+        std::size_t v = 1 + Random() % (NUM_VERTICES - 1);
+
+        if (u != v)
+            graph.AddEdge(u, v);
+    }
+
+    graph::FrozenGraph<uint32_t> frozen(graph);
+    Vector<uint32_t>             hops;
+
+    for (std::size_t source : { std::size_t(0), std::size_t(1), std::size_t(17) })
+    {
+        graph::BFS(graph, source);
+
+        for (std::size_t numThreads : { 1, 4 })
+        {
+            graph::DirectionOptimizingBFS(frozen, source, hops, numThreads);
+
+            bool sameHops = hops.Size() == NUM_VERTICES;
+
+            for (std::size_t v = 0; sameHops and v < NUM_VERTICES; v++)
+                sameHops = hops[v] == graph.GetVertices().At(v).GetCurrentCost();
+
+            CHECK(sameHops);
+        }
+    }
+
+    CHECK(hops[0] == NO_HOP);
+}
+
+TEST_CASE("Direction-optimizing BFS on a dense graph")
+{
+    constexpr std::size_t NUM_VERTICES = 200;
+
+    graph::Graph<uint32_t, uint32_t> graph;
+
+    for (std::size_t i = 0; i < NUM_VERTICES; i++)
+        graph.AddVertex();
+
+    for (std::size_t i = 0; i < NUM_VERTICES; i++)
+        for (std::size_t j = i + 1; j < NUM_VERTICES; j++)
+            graph.AddEdge(i, j);
+
+    // An isolated vertex
+    graph.AddVertex();
+
+    graph::FrozenGraph<uint32_t> frozen(graph);
+    Vector<uint32_t>             hops;
+    graph::SearchStatistics      stats;
+
+    graph::DirectionOptimizingBFS(frozen, 5, hops, 2, &stats);
+
+    bool oneHop = true;
+
+    for (std::size_t v = 0; v < NUM_VERTICES; v++)
+        oneHop = oneHop and hops[v] == (v == 5 ? 0 : 1);
+
+    CHECK(oneHop);
+    CHECK(hops[NUM_VERTICES] == std::numeric_limits<uint32_t>::max());
+    CHECK(stats.m_settledVertices == NUM_VERTICES);
+
+    // The second step runs bottom-up and only the isolated vertex is left, so the
+    // arcs of the large frontier are never scanned
+    CHECK(stats.m_relaxedEdges < frozen.GetNumArcs() / 4);
+}
@@ -0,0 +1,130 @@
+/*
+ * Filename: bidirectional_a_star_test.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "doctest.h"
+
+#include <cmath>
+#include <cstdint>
+
+#include "a_star.h"
+#include "bidirectional_a_star.h"
+#include "dijkstra.h"
+
+TEST_CASE("Bidirectional A* Search algorithm test")
+{
+    // Create a graph with some vertices and edges
+    graph::Graph<double_t, uint32_t> graph;
+
+    graph.AddVertex({ 3, 4 });
+    graph.AddVertex({ 4, 5 });
+    graph.AddVertex({ 6, 5 });
+    graph.AddVertex({ 8, 5 });
+    graph.AddVertex({ 9, 4 });
+    graph.AddVertex({ 8, 3 });
+    graph.AddVertex({ 6, 3 });
+    graph.AddVertex({ 4, 3 });
+    graph.AddVertex({ 5, 4 });
+
+    // {vertex_i_ID, vertex_j_ID, cost of the edge connecting the two}
+    // This graph can be found in the book 'Introduction to Algorithms,' by Thomas
+    // Cormen, third edition, Figure 23.5
+    graph.AddEdge(0, 1, 4);
+    graph.AddEdge(0, 7, 8);
+    graph.AddEdge(1, 7, 11);
+    graph.AddEdge(1, 2, 8);
+    graph.AddEdge(2, 3, 7);
+    graph.AddEdge(2, 8, 2);
+    graph.AddEdge(2, 5, 4);
+    graph.AddEdge(3, 4, 9);
+    graph.AddEdge(3, 5, 14);
+    graph.AddEdge(4, 5, 10);
+    graph.AddEdge(5, 6, 2);
+    graph.AddEdge(6, 7, 1);
+    graph.AddEdge(6, 8, 6);
+    graph.AddEdge(7, 8, 7);
+
+    CHECK_EQ(graph::BidirectionalAStar(graph, 4, 0), 21);
+    CHECK_EQ(graph.GetVertex(0).GetCurrentCost(), 21);
+
+    // The path 4 -> 5 -> 6 -> 7 -> 0 is stored through the predecessors
+    CHECK_EQ(graph.GetVertex(0).GetEdge2Predecessor()->GetCost(), 8);
+    CHECK_EQ(graph.GetVertex(7).GetEdge2Predecessor()->GetCost(), 1);
+    CHECK_EQ(graph.GetVertex(6).GetEdge2Predecessor()->GetCost(), 2);
+    CHECK_EQ(graph.GetVertex(5).GetEdge2Predecessor()->GetCost(), 10);
+    CHECK(graph.GetVertex(4).GetEdge2Predecessor() == nullptr);
+
+    CHECK_EQ(graph::BidirectionalAStar(graph, 3, 3), 0);
+}
+
+TEST_CASE("Bidirectional A* on a directed graph")
+{
+    graph::Graph<uint32_t, uint32_t, bool, 2, true> graph;
+
+    graph.AddVertex({ 0, 0 });
+    graph.AddVertex({ 1, 0 });
+    graph.AddVertex({ 2, 0 });
+    graph.AddVertex({ 1, 1 });
+
+    graph.AddEdge(0, 1, 1);
+    graph.AddEdge(1, 2, 1);
+    graph.AddEdge(0, 3, 2);
+    graph.AddEdge(3, 2, 2);
+
+    CHECK_EQ(graph::BidirectionalAStar(graph, 0, 2), 2);
+
+    // There is no path in the opposite direction
+    CHECK_EQ(graph::BidirectionalAStar(graph, 2, 0),
+             std::numeric_limits<uint32_t>::max());
+}
+
+TEST_CASE("Bidirectional A* settles fewer vertices than A* on long queries")
+{
+    // Grid graph where the edge costs are the distances between the vertices
+    graph::Graph<double_t, int32_t> graph;
+
+    const int32_t side = 30;
+
+    for (int32_t i = 0; i < side; i++)
+        for (int32_t j = 0; j < side; j++)
+            graph.AddVertex({ i, j });
+
+    for (int32_t i = 0; i < side; i++)
+    {
+        for (int32_t j = 0; j < side; j++)
+        {
+            if (i + 1 < side)
+                graph.AddEdge(i * side + j, (i + 1) * side + j, 1 + (i * j) % 3);
+
+            if (j + 1 < side)
+                graph.AddEdge(i * side + j, i * side + j + 1, 1 + (i + j) % 2);
+        }
+    }
+
+    std::size_t source = 0;
+    std::size_t target = side * side - 1;
+
+    graph::Dijkstra(graph, source);
+    double_t expected = graph.GetVertex(target).GetCurrentCost();
+
+    graph::SearchStatistics unidirectional;
+    graph::SearchStatistics bidirectional;
+
+    graph::AStar(graph,
+                 source,
+                 target,
+                 heuristics::distance::Heuristic::MANHATTAN,
+                 &unidirectional);
+
+    CHECK_EQ(graph::BidirectionalAStar(graph,
+                                       source,
+                                       target,
+                                       heuristics::distance::Heuristic::MANHATTAN,
+                                       &bidirectional),
+             expected);
+
+    CHECK_EQ(graph.GetVertex(target).GetCurrentCost(), expected);
+    CHECK(bidirectional.m_settledVertices < unidirectional.m_settledVertices);
+}
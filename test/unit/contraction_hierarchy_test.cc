@@ -0,0 +1,123 @@
+/*
+ * Filename: contraction_hierarchy_test.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "doctest.h"
+
+#include <cstdint>
+#include <limits>
+
+#include "contraction_hierarchy.h"
+#include "dijkstra.h"
+#include "frozen_graph.h"
+#include "search_workspace.h"
+
+#include "test_graphs.h"
+
+TEST_CASE("Contraction hierarchy on an undirected graph")
+{
+    graph::Graph<uint32_t, uint32_t> graph;
+
+    for (std::size_t i = 0; i < 9; i++)
+        graph.AddVertex();
+
+    // This graph can be found in the book 'Introduction to Algorithms,' by Thomas
+    // Cormen, third edition, Figure 23.5
+    graph.AddEdge(0, 1, 4);
+    graph.AddEdge(0, 7, 8);
+    graph.AddEdge(1, 7, 11);
+    graph.AddEdge(1, 2, 8);
+    graph.AddEdge(2, 3, 7);
+    graph.AddEdge(2, 8, 2);
+    graph.AddEdge(2, 5, 4);
+    graph.AddEdge(3, 4, 9);
+    graph.AddEdge(3, 5, 14);
+    graph.AddEdge(4, 5, 10);
+    graph.AddEdge(5, 6, 2);
+    graph.AddEdge(6, 7, 1);
+    graph.AddEdge(6, 8, 6);
+    graph.AddEdge(7, 8, 7);
+
+    graph::FrozenGraph<uint32_t>          frozen(graph);
+    graph::ContractionHierarchy<uint32_t> hierarchy;
+    hierarchy.Build(frozen, 2);
+
+    CHECK(hierarchy.Query(0, 4) == 21);
+    CHECK(hierarchy.Query(4, 0) == 21);
+    CHECK(hierarchy.Query(0, 8) == 14);
+    CHECK(hierarchy.Query(3, 3) == 0);
+
+    Vector<std::size_t> edgeIDs;
+    CHECK(hierarchy.Query(0, 3, &edgeIDs) == 19);
+
+    uint32_t pathCost = 0;
+    for (std::size_t i = 0; i < edgeIDs.Size(); i++)
+        pathCost += graph.GetEdges().Get(edgeIDs[i])->GetCost();
+
+    CHECK(pathCost == 19);
+}
+
+TEST_CASE("Contraction hierarchy matches Dijkstra on a directed graph")
+{
+    graph::Graph<uint32_t, int32_t, bool, 2, true> graph;
+    BuildTravelTimeGrid(graph, 15);
+
+    // An isolated vertex is never reached
+    graph.AddVertex({ 100, 100 });
+
+    graph::FrozenGraph<uint32_t>     frozen(graph);
+    graph::SearchWorkspace<uint32_t> workspace;
+    graph::SearchWorkspace<uint32_t> forward;
+    graph::SearchWorkspace<uint32_t> backward;
+
+    for (std::size_t numThreads : { 1, 3 })
+    {
+        graph::ContractionHierarchy<uint32_t> hierarchy;
+        hierarchy.Build(frozen, numThreads);
+
+        CHECK(hierarchy.GetNumShortcuts() > 0);
+
+        bool sameCosts  = true;
+        bool validPaths = true;
+
+        Vector<std::size_t> edgeIDs;
+
+        for (std::size_t s = 0; s < 225; s += 13)
+        {
+            graph::Dijkstra(frozen, s, workspace);
+
+            for (std::size_t t = 0; t < 225; t += 5)
+            {
+                uint32_t cost = hierarchy.Query(s, t, forward, backward, &edgeIDs);
+
+                sameCosts = sameCosts and cost == workspace.GetCost(t);
+
+                // The unpacked edges must form a path from s to t with that cost
+                std::size_t at       = s;
+                uint32_t    pathCost = 0;
+
+                for (std::size_t i = 0; i < edgeIDs.Size(); i++)
+                {
+                    auto* edge = graph.GetEdges().Get(edgeIDs[i]);
+
+                    validPaths =
+                        validPaths and edge->GetVertices().GetFirst()->GetID() == at;
+
+                    at        = edge->GetVertices().GetSecond()->GetID();
+                    pathCost += edge->GetCost();
+                }
+
+                validPaths = validPaths and at == t and pathCost == cost;
+            }
+        }
+
+        CHECK(sameCosts);
+        CHECK(validPaths);
+
+        CHECK(hierarchy.Query(0, 225, forward, backward, &edgeIDs) ==
+              std::numeric_limits<uint32_t>::max());
+        CHECK(edgeIDs.Size() == 0);
+    }
+}
@@ -6,7 +6,10 @@
 
 #include "doctest.h"
 
+#include <cstdint>
+
 #include "dfs.h"
+#include "frozen_graph.h"
 
 TEST_CASE("DFS algorithm test")
 {
@@ -64,3 +67,88 @@ TEST_CASE("DFS algorithm test")
     CHECK(graph.GetVertices().At(1).GetDepartureTime() == 16);
     CHECK(graph.GetVertices().At(0).GetDepartureTime() == 17);
 }
+
+TEST_CASE("DFS forest of a frozen graph")
+{
+    graph::Graph<uint32_t, uint32_t, bool, 2, true> graph;
+
+    for (std::size_t i = 0; i < 7; i++)
+        graph.AddVertex();
+
+    // Two components: 0 -> 1 -> 2 -> 0 with 1 -> 3, and 4 -> 5 -> 6. The roots are
+    // tried in ID order, so each component is a single tree
+    graph.AddEdge(0, 1);
+    graph.AddEdge(1, 2);
+    graph.AddEdge(2, 0);
+    graph.AddEdge(1, 3);
+    graph.AddEdge(4, 5);
+    graph.AddEdge(5, 6);
+
+    graph::FrozenGraph<uint32_t> frozen(graph);
+    graph::DFSForest             forest;
+
+    graph::DFS(frozen, forest);
+
+    REQUIRE(forest.m_roots.Size() == 2);
+    CHECK(forest.m_roots[0] == 0);
+    CHECK(forest.m_roots[1] == 4);
+
+    CHECK(forest.m_parents[0] == graph::DFSForest::NO_VERTEX);
+    CHECK(forest.m_parents[3] == 1);
+    CHECK(forest.m_parents[6] == 5);
+    CHECK(frozen.GetHead(forest.m_parentArcs[2]) == 2);
+
+    // Every vertex is visited once, so the times are 0 .. 2V - 1
+    CHECK(forest.m_finish[4] == 13);
+    CHECK(forest.m_finishOrder.Size() == 7);
+
+    // The interval of each vertex is nested in the interval of its parent
+    bool nested = true;
+
+    for (std::size_t v = 0; v < 7; v++)
+    {
+        std::size_t parent = forest.m_parents[v];
+
+        nested = nested and forest.m_discovery[v] < forest.m_finish[v];
+
+        if (parent != graph::DFSForest::NO_VERTEX)
+            nested = nested and forest.m_discovery[parent] < forest.m_discovery[v] and
+                     forest.m_finish[v] < forest.m_finish[parent];
+    }
+
+    CHECK(nested);
+
+    // Following the reversed arcs from 0 reaches 2 and 1, but not 3
+    graph::DFS(frozen, 0, forest, true);
+
+    CHECK(forest.m_roots.Size() == 1);
+    CHECK(forest.IsVisited(1));
+    CHECK(forest.IsVisited(2));
+    CHECK_FALSE(forest.IsVisited(3));
+    CHECK(forest.m_parents[2] == 0);
+}
+
+TEST_CASE("DFS on a long path")
+{
+    // Deep enough to overflow the call stack of a recursive traversal
+    constexpr std::size_t NUM_VERTICES = 300000;
+
+    graph::Graph<uint32_t, uint32_t> graph;
+
+    for (std::size_t i = 0; i < NUM_VERTICES; i++)
+        graph.AddVertex();
+
+    for (std::size_t i = 0; i + 1 < NUM_VERTICES; i++)
+        graph.AddEdge(i, i + 1);
+
+    graph::FrozenGraph<uint32_t> frozen(graph);
+    graph::DFSForest             forest;
+
+    graph::DFS(frozen, 0, forest);
+
+    CHECK(forest.m_discovery[NUM_VERTICES - 1] == NUM_VERTICES - 1);
+    CHECK(forest.m_finish[NUM_VERTICES - 1] == NUM_VERTICES);
+    CHECK(forest.m_finish[0] == 2 * NUM_VERTICES - 1);
+    CHECK(forest.m_parents[NUM_VERTICES - 1] == NUM_VERTICES - 2);
+    CHECK(forest.m_finishOrder[0] == NUM_VERTICES - 1);
+}
@@ -7,8 +7,11 @@
 #include "doctest.h"
 
 #include <cstdint>
+#include <limits>
 
 #include "dijkstra.h"
+#include "frozen_graph.h"
+#include "search_workspace.h"
 
 TEST_CASE("Dijkstra's algorithm test")
 {
@@ -56,3 +59,189 @@ TEST_CASE("Dijkstra's algorithm test")
     CHECK(graph.GetVertices().At(7).GetCurrentCost() == 8);
     CHECK(graph.GetVertices().At(8).GetCurrentCost() == 14);
 }
+
+TEST_CASE("Multi-source Dijkstra's algorithm test")
+{
+    graph::Graph<uint32_t, uint32_t> graph;
+
+    for (std::size_t i = 0; i < 10; i++)
+        graph.AddVertex();
+
+    // Same graph as above, plus the isolated vertex 9
+    graph.AddEdge(0, 1, 4);
+    graph.AddEdge(0, 7, 8);
+    graph.AddEdge(1, 7, 11);
+    graph.AddEdge(1, 2, 8);
+    graph.AddEdge(2, 3, 7);
+    graph.AddEdge(2, 8, 2);
+    graph.AddEdge(2, 5, 4);
+    graph.AddEdge(3, 4, 9);
+    graph.AddEdge(3, 5, 14);
+    graph.AddEdge(4, 5, 10);
+    graph.AddEdge(5, 6, 2);
+    graph.AddEdge(6, 7, 1);
+    graph.AddEdge(6, 8, 6);
+    graph.AddEdge(7, 8, 7);
+
+    graph::FrozenGraph<uint32_t>     frozen(graph);
+    graph::SearchWorkspace<uint32_t> workspace;
+
+    Vector<std::size_t> sources = { 0, 4 };
+    Vector<std::size_t> nearest;
+    Vector<uint32_t>    costs;
+
+    graph::MultiSourceDijkstra(frozen, sources, nearest, costs, workspace);
+
+    Vector<std::size_t> expectedNearest = { 0, 0, 0, 1, 1, 1, 0, 0, 0 };
+    Vector<uint32_t>    expectedCosts   = { 0, 4, 12, 9, 0, 10, 9, 8, 14 };
+
+    REQUIRE(nearest.Size() == 10);
+    REQUIRE(costs.Size() == 10);
+
+    for (std::size_t v = 0; v < 9; v++)
+    {
+        CHECK(nearest[v] == expectedNearest[v]);
+        CHECK(costs[v] == expectedCosts[v]);
+    }
+
+    CHECK(nearest[9] == graph::SearchWorkspace<uint32_t>::NO_VERTEX);
+    CHECK(costs[9] == std::numeric_limits<uint32_t>::max());
+}
+
+TEST_CASE("Bounded Dijkstra's algorithm test")
+{
+    graph::Graph<uint32_t, uint32_t> graph;
+
+    for (std::size_t i = 0; i < 9; i++)
+        graph.AddVertex();
+
+    // Same graph as above
+    graph.AddEdge(0, 1, 4);
+    graph.AddEdge(0, 7, 8);
+    graph.AddEdge(1, 7, 11);
+    graph.AddEdge(1, 2, 8);
+    graph.AddEdge(2, 3, 7);
+    graph.AddEdge(2, 8, 2);
+    graph.AddEdge(2, 5, 4);
+    graph.AddEdge(3, 4, 9);
+    graph.AddEdge(3, 5, 14);
+    graph.AddEdge(4, 5, 10);
+    graph.AddEdge(5, 6, 2);
+    graph.AddEdge(6, 7, 1);
+    graph.AddEdge(6, 8, 6);
+    graph.AddEdge(7, 8, 7);
+
+    graph::FrozenGraph<uint32_t>     frozen(graph);
+    graph::SearchWorkspace<uint32_t> workspace;
+
+    // Costs from 0: 0, 4, 12, 19, 21, 11, 9, 8, 14
+    graph::DijkstraWithinRadius(frozen, 0, 11u, workspace);
+
+    Vector<std::size_t> expectedRadius = { 0, 1, 7, 6, 5 };
+
+    REQUIRE(workspace.GetSettledOrder().Size() == expectedRadius.Size());
+
+    for (std::size_t i = 0; i < expectedRadius.Size(); i++)
+        CHECK(workspace.GetSettledOrder()[i] == expectedRadius[i]);
+
+    CHECK_FALSE(workspace.IsSettled(2));
+
+    // The two nearest among the vertices 3, 4 and 8
+    Vector<bool>        isTarget = { false, false, false, true, true,
+                                     false, false, false, true };
+    Vector<std::size_t> targets;
+
+    graph::DijkstraNearestTargets(frozen, 0, isTarget, 2, targets, workspace);
+
+    REQUIRE(targets.Size() == 2);
+    CHECK(targets[0] == 8);
+    CHECK(targets[1] == 3);
+    CHECK(workspace.GetCost(3) == 19);
+    CHECK_FALSE(workspace.IsSettled(4));
+
+    // Asking for more targets than reachable returns all of them
+    graph::DijkstraNearestTargets(frozen, 0, isTarget, 10, targets, workspace);
+    CHECK(targets.Size() == 3);
+}
+
+TEST_CASE("Path extraction test")
+{
+    graph::Graph<uint32_t, uint32_t> graph;
+
+    for (std::size_t i = 0; i < 10; i++)
+        graph.AddVertex();
+
+    // This graph can be found in the book 'Introduction to Algorithms,' by Thomas
+    // Cormen, third edition, Figure 23.5. Vertex 9 is isolated
+    graph.AddEdge(0, 1, 4);
+    graph.AddEdge(0, 7, 8);
+    graph.AddEdge(1, 7, 11);
+    graph.AddEdge(1, 2, 8);
+    graph.AddEdge(2, 3, 7);
+    graph.AddEdge(2, 8, 2);
+    graph.AddEdge(2, 5, 4);
+    graph.AddEdge(3, 4, 9);
+    graph.AddEdge(3, 5, 14);
+    graph.AddEdge(4, 5, 10);
+    graph.AddEdge(5, 6, 2);
+    graph.AddEdge(6, 7, 1);
+    graph.AddEdge(6, 8, 6);
+    graph.AddEdge(7, 8, 7);
+
+    Vector<std::size_t> vertexIDs = { 0, 7, 6, 5, 4 };
+    Vector<std::size_t> edgeIDs   = { 1, 11, 10, 9 };
+    Vector<uint32_t>    costs     = { 0, 8, 9, 11, 21 };
+
+    // The same result is reused by every extraction below
+    graph::PathResult<uint32_t> path;
+
+    auto CheckPath = [&]() {
+        REQUIRE(path.m_vertexIDs.Size() == vertexIDs.Size());
+        REQUIRE(path.m_edgeIDs.Size() == edgeIDs.Size());
+        REQUIRE(path.m_costs.Size() == costs.Size());
+
+        for (std::size_t i = 0; i < vertexIDs.Size(); i++)
+        {
+            CHECK(path.m_vertexIDs[i] == vertexIDs[i]);
+            CHECK(path.m_costs[i] == costs[i]);
+        }
+
+        for (std::size_t i = 0; i < edgeIDs.Size(); i++)
+            CHECK(path.m_edgeIDs[i] == edgeIDs[i]);
+    };
+
+    graph::Dijkstra(graph, 0);
+
+    CHECK(graph::GetPath(graph, 4, path));
+    CheckPath();
+
+    CHECK(not graph::GetPath(graph, 9, path));
+    CHECK(path.m_vertexIDs.Size() == 0);
+
+    CHECK(graph::GetPath(graph, 0, path));
+    CHECK(path.m_vertexIDs.Size() == 1);
+    CHECK(path.m_edgeIDs.Size() == 0);
+    CHECK(path.m_costs[0] == 0);
+
+    graph::FrozenGraph<uint32_t>     frozen(graph);
+    graph::SearchWorkspace<uint32_t> workspace;
+
+    graph::Dijkstra(frozen, 0, workspace);
+
+    CHECK(graph::GetPath(frozen, workspace, 4, path));
+    CheckPath();
+
+    CHECK(not graph::GetPath(frozen, workspace, 9, path));
+    CHECK(path.m_vertexIDs.Size() == 0);
+
+    // A backward tree rooted at 0 gives the paths that end at 0, so the path of
+    // vertex 4 is walked from 4 with the costs counted from 4
+    graph::Dijkstra(frozen, 0, workspace, true);
+
+    vertexIDs = { 4, 5, 6, 7, 0 };
+    edgeIDs   = { 9, 10, 11, 1 };
+    costs     = { 0, 10, 12, 13, 21 };
+
+    CHECK(graph::GetPath(frozen, workspace, 4, path, true));
+    CheckPath();
+}
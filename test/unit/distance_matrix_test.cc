@@ -0,0 +1,80 @@
+/*
+ * Filename: distance_matrix_test.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "doctest.h"
+
+#include <cstdint>
+#include <limits>
+
+#include "contraction_hierarchy.h"
+#include "dijkstra.h"
+#include "distance_matrix.h"
+#include "frozen_graph.h"
+#include "search_workspace.h"
+
+#include "test_graphs.h"
+
+TEST_CASE("Distance matrices match one Dijkstra search per source")
+{
+    graph::Graph<uint32_t, int32_t, bool, 2, true> graph;
+    BuildTravelTimeGrid(graph, 14);
+
+    // An isolated vertex is never reached
+    graph.AddVertex({ 100, 100 });
+
+    graph::FrozenGraph<uint32_t>          frozen(graph);
+    graph::ContractionHierarchy<uint32_t> hierarchy;
+    hierarchy.Build(frozen);
+
+    Vector<std::size_t> sources;
+    Vector<std::size_t> targets;
+
+    for (std::size_t v = 0; v < 197; v += 11)
+        sources.PushBack(v);
+
+    for (std::size_t v = 3; v < 197; v += 7)
+        targets.PushBack(v);
+
+    // Repeated targets are allowed
+    targets.PushBack(3);
+
+    Vector<uint32_t> plain;
+    Vector<uint32_t> buckets;
+
+    graph::DistanceMatrix(frozen, sources, targets, plain, 3);
+    graph::DistanceMatrix(hierarchy, sources, targets, buckets, 3);
+
+    REQUIRE(plain.Size() == sources.Size() * targets.Size());
+    REQUIRE(buckets.Size() == sources.Size() * targets.Size());
+
+    graph::SearchWorkspace<uint32_t> workspace;
+
+    bool samePlain   = true;
+    bool sameBuckets = true;
+
+    for (std::size_t i = 0; i < sources.Size(); i++)
+    {
+        graph::Dijkstra(frozen, sources[i], workspace);
+
+        for (std::size_t j = 0; j < targets.Size(); j++)
+        {
+            uint32_t cost = workspace.GetCost(targets[j]);
+
+            samePlain   = samePlain and plain[i * targets.Size() + j] == cost;
+            sameBuckets = sameBuckets and buckets[i * targets.Size() + j] == cost;
+        }
+    }
+
+    CHECK(samePlain);
+    CHECK(sameBuckets);
+
+    // The isolated vertex neither reaches nor is reached by the others
+    sources.PushBack(196);
+    graph::DistanceMatrix(hierarchy, sources, targets, buckets);
+
+    CHECK(buckets[(sources.Size() - 1) * targets.Size()] ==
+          std::numeric_limits<uint32_t>::max());
+}
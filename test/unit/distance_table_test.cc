@@ -0,0 +1,79 @@
+/*
+ * Filename: distance_table_test.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "doctest.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+
+#include "distance_table.h"
+
+TEST_CASE("Distance table in memory")
+{
+    graph::DistanceTable<int32_t> table;
+    table.Allocate(3);
+
+    CHECK(table.GetNumVertices() == 3);
+    CHECK(table.IsWritable());
+    CHECK(table.Get(2, 1) == std::numeric_limits<int32_t>::max());
+
+    table.GetRow(2)[1] = -5;
+
+    CHECK(table.Get(2, 1) == -5);
+    CHECK(table.Get(1, 2) == std::numeric_limits<int32_t>::max());
+}
+
+TEST_CASE("Distance table in a mapped file")
+{
+    std::string path =
+        (std::filesystem::temp_directory_path() / "distance_table_test.bin").string();
+
+    {
+        graph::DistanceTable<int32_t> table;
+        REQUIRE(table.Create(path, 4));
+
+        CHECK(table.IsWritable());
+        CHECK(table.Get(3, 0) == std::numeric_limits<int32_t>::max());
+
+        for (std::size_t s = 0; s < 4; s++)
+            for (std::size_t t = 0; t < 4; t++)
+                table.GetRow(s)[t] = int32_t(s * 10 + t);
+    }
+
+    graph::DistanceTable<int32_t> mapped;
+    REQUIRE(mapped.Map(path));
+
+    CHECK(mapped.GetNumVertices() == 4);
+    CHECK_FALSE(mapped.IsWritable());
+    CHECK(mapped.Get(3, 2) == 32);
+    CHECK(mapped.GetRow(1)[3] == 13);
+
+    // Tables written with another cost type are rejected
+    graph::DistanceTable<int64_t> wrongType;
+    CHECK_FALSE(wrongType.Map(path));
+
+    // A number of vertices whose table size wraps around is rejected by both
+    uint64_t n = uint64_t(1) << 32;
+
+    CHECK_FALSE(wrongType.Create(path, n));
+
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        uint64_t      header[3] = { 0x31425444, sizeof(int32_t), n / 2 };
+
+        file.write(reinterpret_cast<const char*>(header), sizeof(header));
+    }
+
+    graph::DistanceTable<int32_t> wrapped;
+    CHECK_FALSE(wrapped.Map(path));
+    CHECK(wrapped.GetNumVertices() == 0);
+
+    std::remove(path.c_str());
+}
@@ -0,0 +1,122 @@
+/*
+ * Filename: floyd_warshall_test.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "doctest.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <limits>
+#include <string>
+
+#include "distance_table.h"
+#include "floyd_warshall.h"
+#include "frozen_graph.h"
+#include "johnson.h"
+
+#include "test_graphs.h"
+
+namespace
+{
+    /**
+     * @brief Compare Floyd-Warshall with Johnson's algorithm on a grid
+     */
+    template<typename typeG>
+    void CheckAgainstJohnson(int32_t side)
+    {
+        graph::Graph<typeG, int32_t, bool, 2, true> graph;
+        BuildTravelTimeGrid(graph, side, true);
+
+        // An isolated vertex is never reached
+        graph.AddVertex({ -1, -1 });
+
+        graph::FrozenGraph<typeG> frozen(graph);
+
+        graph::DistanceTable<typeG> expected;
+        REQUIRE(graph::Johnson(frozen, expected));
+
+        for (std::size_t numThreads : { 1, 3 })
+        {
+            graph::DistanceTable<typeG> table;
+            REQUIRE(graph::FloydWarshall(graph, table, numThreads));
+
+            bool sameCosts = true;
+
+            for (std::size_t s = 0; s < frozen.GetNumVertices(); s++)
+                for (std::size_t t = 0; t < frozen.GetNumVertices(); t++)
+                    sameCosts = sameCosts and table.Get(s, t) == expected.Get(s, t);
+
+            CHECK(sameCosts);
+            CHECK(table.Get(0, side * side) == std::numeric_limits<typeG>::max());
+        }
+    }
+} // namespace
+
+TEST_CASE("Floyd-Warshall algorithm test")
+{
+    graph::Graph<int32_t, int32_t, bool, 2, true> graph;
+
+    for (std::size_t i = 0; i < 5; i++)
+        graph.AddVertex();
+
+    // This graph can be found in the book 'Introduction to Algorithms,' by Thomas
+    // Cormen, third edition, Figure 25.4, with the vertices numbered from zero
+    graph.AddEdge(0, 1, 3);
+    graph.AddEdge(0, 2, 8);
+    graph.AddEdge(0, 4, -4);
+    graph.AddEdge(1, 3, 1);
+    graph.AddEdge(1, 4, 7);
+    graph.AddEdge(2, 1, 4);
+    graph.AddEdge(3, 0, 2);
+    graph.AddEdge(3, 2, -5);
+    graph.AddEdge(4, 3, 6);
+
+    int32_t expected[5][5] = { { 0, 1, -3, 2, -4 },
+                               { 3, 0, -4, 1, -1 },
+                               { 7, 4, 0, 5, 3 },
+                               { 2, -1, -5, 0, -2 },
+                               { 8, 5, 1, 6, 0 } };
+
+    graph::DistanceTable<int32_t> table;
+    REQUIRE(graph::FloydWarshall(graph, table, 2));
+
+    bool sameCosts = true;
+
+    for (std::size_t s = 0; s < 5; s++)
+        for (std::size_t t = 0; t < 5; t++)
+            sameCosts = sameCosts and table.Get(s, t) == expected[s][t];
+
+    CHECK(sameCosts);
+
+    // A table in a file of another size is rejected, not replaced by one in memory
+    std::string path =
+        (std::filesystem::temp_directory_path() / "floyd_warshall_test.bin").string();
+
+    graph::DistanceTable<int32_t> file;
+    REQUIRE(file.Create(path, 3));
+
+    CHECK_FALSE(graph::FloydWarshall(graph, file, 2));
+    CHECK(file.IsMapped());
+    CHECK(file.GetNumVertices() == 3);
+
+    std::remove(path.c_str());
+
+    // A negative cycle 0 -> 4 -> 3 -> 0
+    graph.AddEdge(3, 4, -3);
+    graph.AddEdge(4, 0, 1);
+
+    CHECK_FALSE(graph::FloydWarshall(graph, table, 2));
+}
+
+TEST_CASE("Floyd-Warshall matches Johnson's algorithm")
+{
+    // 170 vertices, so the last tiles are not full
+    CheckAgainstJohnson<int32_t>(13);
+    CheckAgainstJohnson<uint32_t>(13);
+    CheckAgainstJohnson<float>(13);
+    CheckAgainstJohnson<double>(13);
+    CheckAgainstJohnson<int64_t>(13);
+}
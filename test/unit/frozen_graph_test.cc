@@ -0,0 +1,75 @@
+/*
+ * Filename: frozen_graph_test.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "doctest.h"
+
+#include <cstdint>
+
+#include "frozen_graph.h"
+
+TEST_CASE("Freezing an undirected graph")
+{
+    graph::Graph<uint32_t, uint32_t> graph;
+
+    graph.AddVertex();
+    graph.AddVertex();
+    graph.AddVertex();
+
+    graph.AddEdge(0, 1, 10);
+    graph.AddEdge(1, 2, 20);
+
+    graph::FrozenGraph<uint32_t> frozen(graph);
+
+    REQUIRE(frozen.GetNumVertices() == 3);
+    CHECK_FALSE(frozen.IsDirected());
+
+    // Each undirected edge creates one arc in each direction
+    CHECK(frozen.GetNumArcs() == 4);
+
+    REQUIRE(frozen.GetLastArc(1) - frozen.GetFirstArc(1) == 2);
+    CHECK(frozen.GetHead(frozen.GetFirstArc(1)) == 0);
+    CHECK(frozen.GetCost(frozen.GetFirstArc(1)) == 10);
+    CHECK(frozen.GetHead(frozen.GetFirstArc(1) + 1) == 2);
+    CHECK(frozen.GetEdgeID(frozen.GetFirstArc(1) + 1) == 1);
+
+    // Backward arcs are the same as the forward ones
+    CHECK(frozen.GetFirstArc(2, true) == frozen.GetFirstArc(2));
+}
+
+TEST_CASE("Freezing a directed graph with a removed vertex")
+{
+    graph::Graph<uint32_t, uint32_t, bool, 2, true> graph;
+
+    graph.AddVertex();
+    graph.AddVertex();
+    graph.AddVertex();
+    graph.AddVertex();
+
+    graph.AddEdge(0, 1, 1);
+    graph.AddEdge(0, 3, 2);
+    graph.AddEdge(2, 3, 3);
+    graph.AddEdge(1, 2, 4);
+
+    graph.RemoveVertex(1);
+
+    graph::FrozenGraph<uint32_t> frozen(graph);
+
+    // Vertex IDs keep indexing the frozen graph
+    REQUIRE(frozen.GetNumVertices() == 4);
+    CHECK(frozen.IsDirected());
+    CHECK(frozen.GetNumArcs() == 2);
+
+    CHECK(frozen.GetFirstArc(1) == frozen.GetLastArc(1));
+    CHECK(frozen.GetLastArc(0) - frozen.GetFirstArc(0) == 1);
+    CHECK(frozen.GetFirstArc(3) == frozen.GetLastArc(3));
+
+    // Both edges enter vertex 3
+    REQUIRE(frozen.GetLastArc(3, true) - frozen.GetFirstArc(3, true) == 2);
+    CHECK(frozen.GetHead(frozen.GetFirstArc(3, true), true) == 0);
+    CHECK(frozen.GetCost(frozen.GetFirstArc(3, true), true) == 2);
+    CHECK(frozen.GetHead(frozen.GetFirstArc(3, true) + 1, true) == 2);
+    CHECK(frozen.GetEdgeID(frozen.GetFirstArc(3, true) + 1, true) == 2);
+}
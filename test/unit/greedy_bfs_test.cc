@@ -6,6 +6,8 @@
 
 #include "doctest.h"
 
+#include "dfs.h"
+#include "dijkstra.h"
 #include "greedy_bfs.h"
 
 TEST_CASE("Greedy Best-First Search algorithm test")
@@ -44,4 +46,72 @@ TEST_CASE("Greedy Best-First Search algorithm test")
     CHECK(graph::GreedyBFS(graph, 4, 0));
     CHECK(graph::GreedyBFS(graph, 2, 5));
     CHECK_FALSE(graph::GreedyBFS(graph, 0, 10));
+
+    // Every vertex is scored once, however many neighbors discover it
+    graph::SearchStatistics stats;
+
+    CHECK(graph::GreedyBFS(graph,
+                           4,
+                           0,
+                           heuristics::distance::Heuristic::MANHATTAN,
+                           &stats));
+    CHECK(stats.m_heuristicEvaluations <= 9);
+    CHECK(stats.m_heuristicCacheHits > 0);
+    CHECK(stats.m_settledVertices <= stats.m_heuristicEvaluations);
+
+    // The Manhattan policy above scores each expansion in one block, and expands
+    // the same vertices as the pairwise heuristic
+    graph::SearchStatistics pairwiseStats;
+
+    CHECK(graph::GreedyBFS(
+        graph,
+        4,
+        0,
+        [](auto* v, auto* t) -> double_t {
+            return heuristics::distance::Manhattan(v, t);
+        },
+        &pairwiseStats));
+    CHECK(pairwiseStats.m_settledVertices == stats.m_settledVertices);
+    CHECK(pairwiseStats.m_heuristicEvaluations == stats.m_heuristicEvaluations);
+}
+
+TEST_CASE("Paths left by searches that do not reach every vertex")
+{
+    // Two components, 0 - 1 - 2 and 3 - 4
+    graph::Graph<double_t, uint32_t> graph;
+
+    graph.AddVertex({ 0, 0 });
+    graph.AddVertex({ 1, 0 });
+    graph.AddVertex({ 2, 0 });
+    graph.AddVertex({ 5, 5 });
+    graph.AddVertex({ 6, 5 });
+
+    graph.AddEdge(0, 1, 2);
+    graph.AddEdge(1, 2, 3);
+    graph.AddEdge(3, 4, 1);
+
+    graph::PathResult<double_t> path;
+
+    graph::Dijkstra(graph, 3);
+
+    REQUIRE(graph::GetPath(graph, 4, path));
+
+    // The cost left in vertex 4 by Dijkstra does not make it reached by a search
+    // that cannot get to it
+    CHECK_FALSE(graph::GreedyBFS(graph, 0, 4));
+    CHECK_FALSE(graph::GetPath(graph, 4, path));
+
+    CHECK(graph::GreedyBFS(graph, 0, 2));
+    REQUIRE(graph::GetPath(graph, 2, path));
+    CHECK(path.m_vertexIDs.Size() == 3);
+    CHECK(path.m_costs[1] == 2);
+    CHECK(path.m_costs[2] == 5);
+
+    graph::Dijkstra(graph, 3);
+    graph::DFS(graph, 0);
+
+    CHECK_FALSE(graph::GetPath(graph, 4, path));
+    REQUIRE(graph::GetPath(graph, 2, path));
+    CHECK(path.m_vertexIDs[0] == 0);
+    CHECK(path.m_costs[2] == 5);
 }
@@ -57,3 +57,152 @@ TEST_CASE("Hamming distance")
     CHECK(std::abs(calculated_distance - expected_distance) <
           std::numeric_limits<double_t>::epsilon());
 }
+
+TEST_CASE("Heuristic policies")
+{
+    graph::Vertex<double_t, double_t> source(0, { 0, 0 });
+    graph::Vertex<double_t, double_t> target(1, { 3, 4 });
+
+    CHECK(heuristics::distance::EuclideanPolicy()(&source, &target) ==
+          heuristics::distance::Euclidean(&source, &target));
+    CHECK(heuristics::distance::ManhattanPolicy()(&source, &target) ==
+          heuristics::distance::Manhattan(&source, &target));
+    CHECK(heuristics::distance::MinkowskiPolicy{ 2 }(&source, &target) ==
+          heuristics::distance::Minkowski(&source, &target, 2.0));
+    CHECK(heuristics::distance::HammingPolicy()(&source, &target) ==
+          heuristics::distance::Hamming(&source, &target));
+
+    // The dispatcher hands the policy of each heuristic to the function
+    auto Estimate = [&](heuristics::distance::Heuristic heuristic) {
+        return heuristics::distance::Dispatch(heuristic, [&](auto policy) {
+            return policy(&source, &target);
+        });
+    };
+
+    CHECK(Estimate(heuristics::distance::Heuristic::EUCLIDEAN) == 5.0);
+    CHECK(Estimate(heuristics::distance::Heuristic::MANHATTAN) == 7.0);
+    CHECK(Estimate(heuristics::distance::Heuristic::HAMMING) == 2.0);
+    CHECK(Estimate(heuristics::distance::Heuristic::MINKOWSKI) ==
+          heuristics::distance::Minkowski(&source, &target));
+
+    // Any function object with the same call works as a policy
+    auto zero = [](auto*, auto*) -> double_t { return 0; };
+
+    using heuristics::distance::Heuristic;
+    using heuristics::distance::HeuristicPolicy;
+
+    CHECK(HeuristicPolicy<decltype(zero), double_t, double_t, bool, 2>);
+    CHECK_FALSE(HeuristicPolicy<Heuristic, double_t, double_t, bool, 2>);
+
+    // Only the geometric policies have a batch kernel
+    using heuristics::distance::BatchHeuristicPolicy;
+
+    CHECK(BatchHeuristicPolicy<heuristics::distance::EuclideanPolicy, 2>);
+    CHECK(BatchHeuristicPolicy<heuristics::distance::MinkowskiPolicy, 3>);
+    CHECK_FALSE(BatchHeuristicPolicy<heuristics::distance::HammingPolicy, 2>);
+    CHECK_FALSE(BatchHeuristicPolicy<decltype(zero), 2>);
+}
+
+TEST_CASE("Vertices without coordinates")
+{
+    graph::Vertex<double_t, double_t> source(0, Vector<double_t>());
+    graph::Vertex<double_t, double_t> target(1, { 3, 4 });
+
+    CHECK_THROWS(heuristics::distance::Euclidean(&source, &target));
+    CHECK_THROWS(heuristics::distance::Manhattan(&source, &target));
+    CHECK_THROWS(heuristics::distance::Minkowski(&source, &target));
+
+    heuristics::distance::CoordinateBlock<2> block;
+
+    CHECK_THROWS_AS(block.PushBack(&source), std::out_of_range);
+    CHECK(block.Size() == 0);
+}
+
+namespace
+{
+    /**
+     * @brief Check the batch kernels against the pairwise heuristics on a block of
+     * vertices that does not fill the last vector
+     */
+    template<std::size_t nDim>
+    void CheckBatchKernels()
+    {
+        using graph::Vertex;
+
+        namespace distance = heuristics::distance;
+
+        Vector<Vertex<double_t, double_t, bool, nDim>> vertices;
+        Vector<double_t> coordinates(nDim, 0);
+
+        for (std::size_t i = 0; i < 19; i++)
+        {
+            for (std::size_t d = 0; d < nDim; d++)
+                coordinates[d] = double_t((i * 7 + d * 13) % 11) - 4.5 + 0.25 * d;
+
+            vertices.PushBack(Vertex<double_t, double_t, bool, nDim>(i, coordinates));
+        }
+
+        Vertex<double_t, double_t, bool, nDim> target = vertices[5];
+        Vector<double_t> targetCoordinates = target.GetCoordinates();
+
+        distance::CoordinateBlock<nDim> block;
+
+        // The block is reused, as done across the expansions of a search
+        block.PushBack(&target);
+        block.Clear();
+
+        for (std::size_t i = 0; i < vertices.Size(); i++)
+            block.PushBack(&vertices[i]);
+
+        REQUIRE(block.Size() == 19);
+
+        Vector<double_t> distances(19, 0);
+
+        auto Close = [](double_t a, double_t b) {
+            return std::abs(a - b) <= 1e-12 * (1 + std::abs(b));
+        };
+
+        bool euclidean = true;
+        bool manhattan = true;
+        bool minkowski = true;
+        bool squared   = true;
+
+        distance::EuclideanBatch(block, &targetCoordinates[0], &distances[0]);
+
+        for (std::size_t i = 0; i < 19; i++)
+            euclidean = euclidean and
+                        Close(distances[i], distance::Euclidean(&vertices[i], &target));
+
+        distance::ManhattanBatch(block, &targetCoordinates[0], &distances[0]);
+
+        for (std::size_t i = 0; i < 19; i++)
+            manhattan = manhattan and
+                        Close(distances[i], distance::Manhattan(&vertices[i], &target));
+
+        distance::MinkowskiBatch(block, &targetCoordinates[0], &distances[0]);
+
+        for (std::size_t i = 0; i < 19; i++)
+            minkowski = minkowski and
+                        Close(distances[i], distance::Minkowski(&vertices[i], &target));
+
+        distance::MinkowskiBatch(block, &targetCoordinates[0], &distances[0], 2);
+
+        for (std::size_t i = 0; i < 19; i++)
+            squared = squared and
+                      Close(distances[i],
+                            distance::Minkowski(&vertices[i], &target, 2.0));
+
+        CHECK(euclidean);
+        CHECK(manhattan);
+        CHECK(minkowski);
+        CHECK(squared);
+        CHECK(distances[5] == 0);
+    }
+} // namespace
+
+TEST_CASE("Batch distance kernels")
+{
+    CheckBatchKernels<2>();
+    CheckBatchKernels<3>();
+    CheckBatchKernels<5>();
+}
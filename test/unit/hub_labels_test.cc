@@ -0,0 +1,131 @@
+/*
+ * Filename: hub_labels_test.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "doctest.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+
+#include "contraction_hierarchy.h"
+#include "dijkstra.h"
+#include "frozen_graph.h"
+#include "hub_labels.h"
+#include "search_workspace.h"
+
+#include "test_graphs.h"
+
+TEST_CASE("Hub labels give the shortest path costs")
+{
+    graph::Graph<uint32_t, int32_t, bool, 2, true> graph;
+    BuildTravelTimeGrid(graph, 15);
+
+    // An isolated vertex is never reached
+    graph.AddVertex({ 100, 100 });
+
+    graph::FrozenGraph<uint32_t>          frozen(graph);
+    graph::ContractionHierarchy<uint32_t> hierarchy;
+    hierarchy.Build(frozen);
+
+    graph::HubLabels<uint32_t> labels;
+    labels.Build(hierarchy, 3);
+
+    REQUIRE(labels.GetNumVertices() == 226);
+
+    // Every vertex is a hub of itself
+    CHECK(labels.GetLabelSize(0) >= 1);
+    CHECK(labels.GetLabelSize(0, true) >= 1);
+
+    graph::SearchWorkspace<uint32_t> workspace;
+
+    bool sameCosts = true;
+
+    for (std::size_t s = 0; s < 226; s += 3)
+    {
+        graph::Dijkstra(frozen, s, workspace);
+
+        for (std::size_t t = 0; t < 226; t++)
+            sameCosts = sameCosts and labels.Query(s, t) == workspace.GetCost(t);
+    }
+
+    CHECK(sameCosts);
+    CHECK(labels.Query(0, 225) == std::numeric_limits<uint32_t>::max());
+}
+
+TEST_CASE("Hub labels can be mapped from a file")
+{
+    graph::Graph<uint32_t, int32_t, bool, 2, true> graph;
+    BuildTravelTimeGrid(graph, 8);
+
+    graph::FrozenGraph<uint32_t>          frozen(graph);
+    graph::ContractionHierarchy<uint32_t> hierarchy;
+    hierarchy.Build(frozen);
+
+    graph::HubLabels<uint32_t> labels;
+    labels.Build(hierarchy);
+
+    std::string path =
+        (std::filesystem::temp_directory_path() / "hub_labels_test.bin").string();
+
+    REQUIRE(labels.Save(path));
+
+    graph::HubLabels<uint32_t> mapped;
+    REQUIRE(mapped.Map(path));
+
+    CHECK(mapped.GetNumVertices() == labels.GetNumVertices());
+    CHECK(mapped.GetNumEntries() == labels.GetNumEntries());
+
+    bool sameCosts = true;
+
+    for (std::size_t s = 0; s < 64; s++)
+        for (std::size_t t = 0; t < 64; t++)
+            sameCosts = sameCosts and mapped.Query(s, t) == labels.Query(s, t);
+
+    CHECK(sameCosts);
+
+    // Labels saved with another cost type are rejected
+    graph::HubLabels<uint64_t> wrongType;
+    CHECK_FALSE(wrongType.Map(path));
+
+    // Corrupt copies are rejected, and the labels mapped before stay usable
+    std::string corrupt =
+        (std::filesystem::temp_directory_path() / "hub_labels_corrupt_test.bin")
+            .string();
+
+    auto Corrupt = [&](std::size_t word, uint64_t value) {
+        std::filesystem::copy_file(path,
+                                   corrupt,
+                                   std::filesystem::copy_options::overwrite_existing);
+
+        std::fstream file(corrupt, std::ios::binary | std::ios::in | std::ios::out);
+        uint64_t     current;
+
+        file.seekg(word * sizeof(uint64_t));
+        file.read(reinterpret_cast<char*>(&current), sizeof(current));
+
+        value += current;
+
+        file.seekp(word * sizeof(uint64_t));
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+
+    // A number of forward entries whose size wraps back to the size in the file
+    Corrupt(3, uint64_t(1) << 62);
+    CHECK_FALSE(mapped.Map(corrupt));
+
+    // A forward offset past the end of the labels
+    Corrupt(6, uint64_t(1) << 40);
+    CHECK_FALSE(mapped.Map(corrupt));
+
+    CHECK(mapped.GetNumVertices() == labels.GetNumVertices());
+    CHECK(mapped.Query(0, 63) == labels.Query(0, 63));
+
+    std::remove(corrupt.c_str());
+    std::remove(path.c_str());
+}
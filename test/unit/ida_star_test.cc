@@ -6,7 +6,14 @@
 
 #include "doctest.h"
 
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+
+#include "dijkstra.h"
+#include "frozen_graph.h"
 #include "ida_star.h"
+#include "search_workspace.h"
 
 TEST_CASE("IDA* Search algorithm test")
 {
@@ -45,3 +52,137 @@ TEST_CASE("IDA* Search algorithm test")
 
     CHECK_EQ(graph.GetVertex(0).GetCurrentCost(), 21);
 }
+
+TEST_CASE("IDA* on a frozen grid")
+{
+    // A 6x6 grid with unit costs, where the Manhattan distance is admissible. The
+    // wall at x = 3 has a single gap at y = 5
+    graph::Graph<uint32_t, int32_t, bool, 2, false> graph;
+
+    for (int32_t y = 0; y < 6; y++)
+        for (int32_t x = 0; x < 6; x++)
+            graph.AddVertex({ x, y });
+
+    auto IsWall = [](int32_t x, int32_t y) { return x == 3 and y < 5; };
+
+    for (int32_t y = 0; y < 6; y++)
+    {
+        for (int32_t x = 0; x < 6; x++)
+        {
+            if (IsWall(x, y))
+                continue;
+
+            if (x + 1 < 6 and not IsWall(x + 1, y))
+                graph.AddEdge(y * 6 + x, y * 6 + x + 1, 1);
+
+            if (y + 1 < 6 and not IsWall(x, y + 1))
+                graph.AddEdge(y * 6 + x, (y + 1) * 6 + x, 1);
+        }
+    }
+
+    graph::FrozenGraph<uint32_t>     frozen(graph);
+    graph::SearchWorkspace<uint32_t> reference;
+
+    auto Manhattan = [](std::size_t u, std::size_t v) -> double_t {
+        return std::abs(int32_t(u % 6) - int32_t(v % 6)) +
+               std::abs(int32_t(u / 6) - int32_t(v / 6));
+    };
+
+    bool sameCosts = true;
+
+    for (std::size_t s = 0; s < 36; s += 5)
+    {
+        graph::Dijkstra(frozen, s, reference);
+
+        for (std::size_t t = 0; t < 36; t++)
+        {
+            uint32_t expected = reference.IsSettled(t)
+                                    ? reference.GetCost(t)
+                                    : std::numeric_limits<uint32_t>::max();
+
+            auto estimate = [&](std::size_t v) { return Manhattan(v, t); };
+
+            graph::PathResult<uint32_t> path;
+
+            sameCosts = sameCosts and
+                        graph::IDAStar(frozen, s, t, estimate, path) == expected and
+                        graph::IDAStar(frozen, s, t, estimate, path, 64, 256) ==
+                            expected;
+
+            if (expected != std::numeric_limits<uint32_t>::max())
+            {
+                sameCosts = sameCosts and path.m_vertexIDs[0] == s and
+                            path.m_vertexIDs[path.m_vertexIDs.Size() - 1] == t and
+                            path.m_costs[path.m_costs.Size() - 1] == expected and
+                            path.m_edgeIDs.Size() + 1 == path.m_vertexIDs.Size();
+            }
+        }
+    }
+
+    CHECK(sameCosts);
+
+    // Going around the wall revisits many vertices through paths of equal cost,
+    // which the transposition table prunes
+    auto estimate = [&](std::size_t v) { return Manhattan(v, 5); };
+
+    graph::PathResult<uint32_t> path;
+    graph::SearchStatistics     plain;
+    graph::SearchStatistics     table;
+
+    CHECK(graph::IDAStar(frozen, 0, 5, estimate, path, 64, 0, &plain) == 15);
+    CHECK(graph::IDAStar(frozen, 0, 5, estimate, path, 64, 1024, &table) == 15);
+
+    CHECK(table.m_settledVertices < plain.m_settledVertices);
+
+    // Each vertex is estimated at most once per query
+    CHECK(plain.m_heuristicEvaluations <= 36);
+
+    // The shortest path has 15 edges, so a smaller depth limit fails
+    CHECK(graph::IDAStar(frozen, 0, 5, estimate, path, 14) ==
+          std::numeric_limits<uint32_t>::max());
+    CHECK(path.m_vertexIDs.Size() == 0);
+}
+
+TEST_CASE("IDA* with an unreachable target")
+{
+    graph::Graph<double_t, uint32_t> graph;
+
+    graph.AddVertex({ 0, 0 });
+    graph.AddVertex({ 1, 0 });
+    graph.AddVertex({ 2, 0 });
+
+    graph.AddEdge(0, 1, 1);
+
+    namespace distance = heuristics::distance;
+
+    graph::SearchStatistics stats;
+
+    CHECK_FALSE(graph::IDAStar(graph, 0, 2, 10));
+    CHECK(graph::IDAStar(graph, 0, 1, 10, distance::Heuristic::MANHATTAN, &stats));
+    CHECK(graph.GetVertex(1).GetCurrentCost() == 1);
+    CHECK(stats.m_settledVertices == 2);
+}
+
+TEST_CASE("IDA* transposition table with a depth limit")
+{
+    graph::Graph<uint32_t, uint32_t, bool, 2, true> graph;
+
+    for (std::size_t i = 0; i < 4; i++)
+        graph.AddVertex();
+
+    // Vertex 2 is first reached through 1 with cost 2 at depth 2, where the limit
+    // cuts its arc to 3, and then directly with the same cost at depth 1
+    graph.AddEdge(0, 1, 1);
+    graph.AddEdge(1, 2, 1);
+    graph.AddEdge(0, 2, 2);
+    graph.AddEdge(2, 3, 1);
+
+    graph::FrozenGraph<uint32_t> frozen(graph);
+    graph::PathResult<uint32_t>  path;
+
+    auto zero = [](std::size_t) { return 0.0; };
+
+    CHECK(graph::IDAStar(frozen, 0, 3, zero, path, 2, 0) == 3);
+    CHECK(graph::IDAStar(frozen, 0, 3, zero, path, 2, 16) == 3);
+    CHECK(path.m_vertexIDs.Size() == 3);
+}
@@ -6,6 +6,11 @@
 
 #include "doctest.h"
 
+#include <cstdint>
+#include <limits>
+
+#include "bfs.h"
+#include "frozen_graph.h"
 #include "iddfs.h"
 
 TEST_CASE("IDDFS algorithm test")
@@ -46,4 +51,113 @@ TEST_CASE("IDDFS algorithm test")
     CHECK(graph::IDDFS(graph, 4, 3, 100));
     CHECK(graph::IDDFS(graph, 4, 3, 100));
     CHECK_FALSE(graph::IDDFS(graph, 0, 100, 200));
+
+    // The vertices on the path store their number of edges
+    REQUIRE(graph::IDDFS(graph, 0, 4, 100));
+    CHECK(graph.GetVertex(4).GetCurrentCost() == 4);
+}
+
+TEST_CASE("IDDFS keeps the depth budget of every sibling")
+{
+    graph::Graph<uint32_t, uint32_t> graph;
+
+    for (std::size_t i = 0; i < 6; i++)
+        graph.AddVertex();
+
+    // The target is below the last child of the source, so a budget shrinking
+    // from sibling to sibling would miss it
+    graph.AddEdge(0, 1);
+    graph.AddEdge(0, 2);
+    graph.AddEdge(0, 3);
+    graph.AddEdge(3, 4);
+    graph.AddEdge(4, 5);
+
+    graph::FrozenGraph<uint32_t> frozen(graph);
+    graph::PathResult<uint32_t>  path;
+
+    CHECK(graph::IDDFS(frozen, 0, 5, path, 3) == 3);
+    CHECK(path.m_vertexIDs.Size() == 4);
+    CHECK(path.m_vertexIDs[2] == 4);
+    CHECK(path.m_edgeIDs.Size() == 3);
+
+    CHECK(graph::IDDFS(frozen, 0, 5, path, 2) ==
+          std::numeric_limits<std::size_t>::max());
+    CHECK(path.m_vertexIDs.Size() == 0);
+}
+
+TEST_CASE("IDDFS with parallel root splitting")
+{
+    // A 5x5 grid plus a long tail, searched with one and with four threads
+    graph::Graph<uint32_t, uint32_t> graph;
+
+    for (std::size_t i = 0; i < 25 + 1000; i++)
+        graph.AddVertex();
+
+    for (std::size_t y = 0; y < 5; y++)
+    {
+        for (std::size_t x = 0; x < 5; x++)
+        {
+            if (x + 1 < 5)
+                graph.AddEdge(y * 5 + x, y * 5 + x + 1);
+
+            if (y + 1 < 5)
+                graph.AddEdge(y * 5 + x, (y + 1) * 5 + x);
+        }
+    }
+
+    graph.AddEdge(24, 25);
+
+    for (std::size_t i = 25; i + 1 < 25 + 1000; i++)
+        graph.AddEdge(i, i + 1);
+
+    graph::FrozenGraph<uint32_t> frozen(graph);
+    graph::PathResult<uint32_t>  path;
+
+    graph::BFS(graph, 12);
+
+    bool sameDepths = true;
+
+    for (std::size_t t = 0; t < 25; t++)
+    {
+        std::size_t hops = graph.GetVertex(t).GetCurrentCost();
+
+        sameDepths = sameDepths and graph::IDDFS(frozen, 12, t, path, 10, 1) == hops;
+        sameDepths = sameDepths and graph::IDDFS(frozen, 12, t, path, 10, 4) == hops;
+        sameDepths = sameDepths and path.m_vertexIDs[hops] == t;
+    }
+
+    CHECK(sameDepths);
+
+    // The tail is searched without recursion, one vertex deeper per iteration
+    graph::SearchStatistics stats;
+
+    CHECK(graph::IDDFS(frozen, 25, 25 + 999, path, 5000, 4, &stats) == 999);
+    CHECK(path.m_vertexIDs.Size() == 1000);
+    CHECK(stats.m_settledVertices > 999);
+
+    // From the end of the tail, the corner 0 of the grid is 999 + 1 + 8 edges away
+    CHECK(graph::IDDFS(frozen, 25 + 999, 0, path, 5000, 4) == 1000 + 8);
+}
+
+TEST_CASE("IDDFS stops when the target cannot be reached")
+{
+    graph::Graph<uint32_t, uint32_t, bool, 2, true> graph;
+
+    for (std::size_t i = 0; i < 4; i++)
+        graph.AddVertex();
+
+    graph.AddEdge(0, 1);
+    graph.AddEdge(1, 2);
+    graph.AddEdge(2, 0);
+    graph.AddEdge(3, 0);
+
+    graph::FrozenGraph<uint32_t> frozen(graph);
+    graph::PathResult<uint32_t>  path;
+    graph::SearchStatistics      stats;
+
+    CHECK(graph::IDDFS(frozen, 0, 3, path, 1000000, 1, &stats) ==
+          std::numeric_limits<std::size_t>::max());
+
+    // Iterations 0 to 3 run, and the last one cuts no vertex
+    CHECK(stats.m_settledVertices == 1 + 2 + 3 + 3);
 }
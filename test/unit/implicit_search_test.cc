@@ -0,0 +1,274 @@
+/*
+ * Filename: implicit_search_test.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "doctest.h"
+
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+
+#include "implicit_search.h"
+
+namespace
+{
+    // 2x3 sliding puzzle, tile 0 is the blank
+    using Board = std::array<uint8_t, 6>;
+
+    const Board GOAL = { 1, 2, 3, 4, 5, 0 };
+
+    auto HashBoard = [](const Board& board) {
+        uint64_t hash = 0;
+
+        for (uint8_t tile : board)
+            hash = hash * 8 + tile;
+
+        return hash;
+    };
+
+    auto IsSolved = [](const Board& board) { return board == GOAL; };
+
+    auto Slide = [](const Board& board, auto emit) {
+        std::size_t blank = 0;
+
+        while (board[blank] != 0)
+            blank++;
+
+        std::size_t x = blank % 3;
+        std::size_t y = blank / 3;
+
+        auto Move = [&](std::size_t tile) {
+            Board next  = board;
+            next[blank] = next[tile];
+            next[tile]  = 0;
+            emit(next, uint32_t(1));
+        };
+
+        if (x > 0)
+            Move(blank - 1);
+        if (x < 2)
+            Move(blank + 1);
+        if (y > 0)
+            Move(blank - 3);
+        if (y < 1)
+            Move(blank + 3);
+    };
+
+    // Sum of the Manhattan distances of the tiles to their goal positions
+    auto Misplacement = [](const Board& board) {
+        int32_t sum = 0;
+
+        for (int32_t i = 0; i < 6; i++)
+        {
+            if (board[i] == 0)
+                continue;
+
+            int32_t goal = board[i] - 1;
+
+            sum += std::abs(i % 3 - goal % 3) + std::abs(i / 3 - goal / 3);
+        }
+
+        return double_t(sum);
+    };
+
+    struct Cell
+    {
+            int32_t m_x;
+            int32_t m_y;
+
+            bool operator==(const Cell&) const = default;
+    };
+} // namespace
+
+TEST_CASE("Implicit searches on a sliding puzzle")
+{
+    namespace implicit = graph::implicit;
+
+    // The board farthest from the goal
+    Board start = { 4, 5, 0, 1, 2, 3 };
+
+    implicit::StatePath<Board, uint32_t> path;
+    graph::SearchStatistics              stats;
+
+    uint32_t moves = implicit::BFS(start, Slide, IsSolved, HashBoard, path);
+
+    REQUIRE(moves == 21);
+    CHECK(path.m_states[0] == start);
+    CHECK(path.m_states[path.m_states.Size() - 1] == GOAL);
+    CHECK(path.m_costs[path.m_costs.Size() - 1] == moves);
+
+    // Each state of the path is one move away from the previous one
+    bool validPath = true;
+
+    for (std::size_t i = 1; i < path.m_states.Size(); i++)
+    {
+        bool adjacent = false;
+
+        Slide(path.m_states[i - 1], [&](const Board& next, uint32_t) {
+            adjacent = adjacent or next == path.m_states[i];
+        });
+
+        validPath = validPath and adjacent;
+    }
+
+    CHECK(validPath);
+
+    CHECK(implicit::UCS(start, Slide, IsSolved, HashBoard, path) == moves);
+    CHECK(implicit::IDDFS(start, Slide, IsSolved, HashBoard, path) == moves);
+    CHECK(path.m_states.Size() == moves + 1);
+
+    CHECK(implicit::AStar(
+              start, Slide, IsSolved, HashBoard, Misplacement, path, 1000, &stats) ==
+          moves);
+
+    // The heuristic is computed once per stored state
+    CHECK(stats.m_heuristicEvaluations <= 360);
+    CHECK(stats.m_heuristicCacheHits > 0);
+
+    CHECK(implicit::IDAStar(start, Slide, IsSolved, HashBoard, Misplacement, path) ==
+          moves);
+    CHECK(path.m_states[path.m_states.Size() - 1] == GOAL);
+
+    // Swapping two tiles gives a board of the other half of the 6! boards, from
+    // which the goal cannot be reached
+    Board unsolvable = GOAL;
+
+    unsolvable[0] = 2;
+    unsolvable[1] = 1;
+
+    graph::SearchStatistics exhausted;
+
+    CHECK(implicit::BFS(
+              unsolvable, Slide, IsSolved, HashBoard, path, 1000, &exhausted) ==
+          std::numeric_limits<uint32_t>::max());
+    CHECK(exhausted.m_settledVertices == 360);
+    CHECK(path.m_states.Size() == 0);
+
+    CHECK(implicit::IDDFS(unsolvable, Slide, IsSolved, HashBoard, path, 12) ==
+          std::numeric_limits<uint32_t>::max());
+
+    // With room for only a few states the goal is not found
+    CHECK(implicit::BFS(start, Slide, IsSolved, HashBoard, path, 4) ==
+          std::numeric_limits<uint32_t>::max());
+}
+
+TEST_CASE("Implicit searches with weighted moves")
+{
+    namespace implicit = graph::implicit;
+
+    // An 8x8 grid where horizontal moves cost 1 and vertical moves cost 3. The wall
+    // at x = 4 has a single gap at y = 7
+    auto Neighbors = [](const Cell& cell, auto emit) {
+        auto IsFree = [](int32_t x, int32_t y) {
+            return x >= 0 and x < 8 and y >= 0 and y < 8 and (x != 4 or y == 7);
+        };
+
+        if (IsFree(cell.m_x - 1, cell.m_y))
+            emit(Cell{ cell.m_x - 1, cell.m_y }, uint32_t(1));
+        if (IsFree(cell.m_x + 1, cell.m_y))
+            emit(Cell{ cell.m_x + 1, cell.m_y }, uint32_t(1));
+        if (IsFree(cell.m_x, cell.m_y - 1))
+            emit(Cell{ cell.m_x, cell.m_y - 1 }, uint32_t(3));
+        if (IsFree(cell.m_x, cell.m_y + 1))
+            emit(Cell{ cell.m_x, cell.m_y + 1 }, uint32_t(3));
+    };
+
+    auto HashCell = [](const Cell& cell) {
+        return (uint64_t(uint32_t(cell.m_x)) << 32) | uint32_t(cell.m_y);
+    };
+
+    Cell target = { 7, 0 };
+
+    auto IsTarget = [&](const Cell& cell) { return cell == target; };
+
+    auto Estimate = [&](const Cell& cell) {
+        return double_t(std::abs(cell.m_x - target.m_x) +
+                        3 * std::abs(cell.m_y - target.m_y));
+    };
+
+    implicit::StatePath<Cell, uint32_t> path;
+
+    // 7 steps up and down to go through the gap, and 7 steps to the right
+    uint32_t cost = 7 * 3 * 2 + 7;
+
+    CHECK(implicit::UCS(Cell{ 0, 0 }, Neighbors, IsTarget, HashCell, path) == cost);
+    CHECK(path.m_costs[path.m_costs.Size() - 1] == cost);
+
+    CHECK(implicit::AStar(
+              Cell{ 0, 0 }, Neighbors, IsTarget, HashCell, Estimate, path) == cost);
+    CHECK(path.m_states.Size() == 22);
+
+    CHECK(implicit::IDAStar(
+              Cell{ 0, 0 }, Neighbors, IsTarget, HashCell, Estimate, path) == cost);
+    CHECK(path.m_states.Size() == 22);
+
+    // Going straight through the gap takes 21 moves, so BFS finds the same path
+    CHECK(implicit::BFS(Cell{ 0, 0 }, Neighbors, IsTarget, HashCell, path) == 21);
+
+    // A depth limit below the number of moves of every path fails
+    CHECK(implicit::IDAStar(
+              Cell{ 0, 0 }, Neighbors, IsTarget, HashCell, Estimate, path, 20) ==
+          std::numeric_limits<uint32_t>::max());
+}
+
+TEST_CASE("Implicit A* with an integral heuristic")
+{
+    namespace implicit = graph::implicit;
+
+    // Costs above 255 must not wrap when the heuristic returns uint8_t, like the
+    // entries of a pattern database
+    auto Neighbors = [](const int32_t& state, auto emit) {
+        if (state == 0)
+        {
+            emit(int32_t(1), uint32_t(100));
+            emit(int32_t(2), uint32_t(150));
+        }
+        else if (state == 1)
+            emit(int32_t(3), uint32_t(200));
+        else if (state == 2)
+            emit(int32_t(3), uint32_t(100));
+    };
+
+    auto HashState = [](const int32_t& state) { return uint64_t(state); };
+    auto IsGoal    = [](const int32_t& state) { return state == 3; };
+    auto Zero      = [](const int32_t&) { return uint8_t(0); };
+
+    implicit::StatePath<int32_t, uint32_t> path;
+
+    CHECK(implicit::UCS(int32_t(0), Neighbors, IsGoal, HashState, path) == 250);
+
+    CHECK(implicit::AStar(int32_t(0), Neighbors, IsGoal, HashState, Zero, path) ==
+          250);
+    CHECK(path.m_states.Size() == 3);
+    CHECK(path.m_states[1] == 2);
+}
+
+TEST_CASE("State set")
+{
+    auto identity = [](uint64_t value) { return value; };
+
+    graph::implicit::StateSet<uint64_t, decltype(identity)> states(identity);
+
+    bool inserted;
+    bool sameIDs = true;
+
+    // Enough states to grow the table and fill more than one arena block
+    for (uint64_t i = 0; i < 10000; i++)
+        sameIDs = sameIDs and states.Insert(i * 1024, inserted) == i and inserted;
+
+    CHECK(sameIDs);
+    CHECK(states.Size() == 10000);
+    CHECK(states.Insert(2048, inserted) == 2);
+    CHECK_FALSE(inserted);
+    CHECK(states.Find(4096 * 1024) == 4096);
+    CHECK(states.Find(1) == states.NO_STATE);
+    CHECK(states[9999] == 9999 * 1024);
+
+    states.Clear();
+
+    CHECK(states.Size() == 0);
+    CHECK(states.Find(0) == states.NO_STATE);
+}
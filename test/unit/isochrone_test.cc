@@ -0,0 +1,184 @@
+/*
+ * Filename: isochrone_test.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "doctest.h"
+
+#include <cmath>
+#include <cstdint>
+
+#include "isochrone.h"
+
+namespace
+{
+    using Graph = graph::Graph<uint32_t, int32_t, bool, 2, false>;
+
+    /**
+     * @brief Twice the signed area of a closed polygon of vertex IDs
+     */
+    double_t PolygonArea(Graph& graph, const Vector<std::size_t>& polygon)
+    {
+        double_t area = 0;
+
+        for (std::size_t i = 0; i + 1 < polygon.Size(); i++)
+        {
+            Vector<int32_t>& a = graph.GetVertex(polygon[i]).GetCoordinates();
+            Vector<int32_t>& b = graph.GetVertex(polygon[i + 1]).GetCoordinates();
+
+            area += static_cast<double_t>(a[0]) * b[1] -
+                    static_cast<double_t>(b[0]) * a[1];
+        }
+
+        return area;
+    }
+
+    /**
+     * @brief Whether a point is inside or on the border of a closed polygon
+     */
+    bool Encloses(Graph&                     graph,
+                  const Vector<std::size_t>& polygon,
+                  double_t                   x,
+                  double_t                   y)
+    {
+        bool inside = false;
+
+        for (std::size_t i = 0; i + 1 < polygon.Size(); i++)
+        {
+            Vector<int32_t>& a = graph.GetVertex(polygon[i]).GetCoordinates();
+            Vector<int32_t>& b = graph.GetVertex(polygon[i + 1]).GetCoordinates();
+
+            double_t cross = (b[0] - a[0]) * (y - a[1]) - (b[1] - a[1]) * (x - a[0]);
+
+            // On the border
+            if (cross == 0 and std::fmin(a[0], b[0]) <= x and
+                x <= std::fmax(a[0], b[0]) and std::fmin(a[1], b[1]) <= y and
+                y <= std::fmax(a[1], b[1]))
+                return true;
+
+            if ((a[1] > y) != (b[1] > y) and
+                x < a[0] + (y - a[1]) * (b[0] - a[0]) /
+                               static_cast<double_t>(b[1] - a[1]))
+                inside = not inside;
+        }
+
+        return inside;
+    }
+} // namespace
+
+TEST_CASE("Convex isochrones of a grid")
+{
+    Graph graph;
+
+    // 11x11 grid with unit costs, where vertex i * 11 + j is at (i, j)
+    for (int32_t i = 0; i < 11; i++)
+        for (int32_t j = 0; j < 11; j++)
+            graph.AddVertex({ i, j });
+
+    for (std::size_t i = 0; i < 11; i++)
+    {
+        for (std::size_t j = 0; j < 11; j++)
+        {
+            if (i + 1 < 11)
+                graph.AddEdge(i * 11 + j, (i + 1) * 11 + j, 1);
+
+            if (j + 1 < 11)
+                graph.AddEdge(i * 11 + j, i * 11 + j + 1, 1);
+        }
+    }
+
+    // A vertex without coordinates is reached, but left out of the polygons
+    std::size_t hidden = graph.AddVertex().GetID();
+    graph.AddEdge(60, hidden, 1);
+
+    graph::Isochrones<uint32_t, int32_t, bool, 2, false> isochrones(graph);
+
+    Vector<uint32_t>            cutoffs = { 4, 2 };
+    Vector<Vector<std::size_t>> polygons;
+
+    isochrones.Compute(60, cutoffs, polygons);
+
+    REQUIRE(polygons.Size() == 2);
+
+    // Within cost c of the center (5, 5) lies a diamond with corners at distance c
+    REQUIRE(polygons[0].Size() == 5);
+    REQUIRE(polygons[1].Size() == 5);
+
+    CHECK(polygons[0][0] == polygons[0][4]);
+    CHECK(PolygonArea(graph, polygons[0]) == 2 * 32);
+    CHECK(PolygonArea(graph, polygons[1]) == 2 * 8);
+
+    CHECK(Encloses(graph, polygons[1], 5, 3));
+    CHECK_FALSE(Encloses(graph, polygons[1], 5, 2));
+
+    bool hiddenLeftOut = true;
+
+    for (std::size_t c = 0; c < 2; c++)
+        for (std::size_t i = 0; i < polygons[c].Size(); i++)
+            hiddenLeftOut = hiddenLeftOut and polygons[c][i] != hidden;
+
+    CHECK(hiddenLeftOut);
+
+    // The concave hull also skips it
+    isochrones.Compute(60, cutoffs, polygons, graph::HullType::CONCAVE);
+
+    for (std::size_t c = 0; c < 2; c++)
+        for (std::size_t i = 0; i < polygons[c].Size(); i++)
+            hiddenLeftOut = hiddenLeftOut and polygons[c][i] != hidden;
+
+    CHECK(hiddenLeftOut);
+}
+
+TEST_CASE("Concave isochrones follow the shape of the network")
+{
+    Graph graph;
+
+    // A U-shaped network: a thick bottom bar and two thick arms, with an empty
+    // notch between the arms
+    for (int32_t x = 0; x < 7; x++)
+        for (int32_t y = 0; y < 7; y++)
+            if (y < 2 or x < 2 or x > 4)
+                graph.AddVertex({ x, y });
+
+    for (auto& u : graph.GetVertices())
+    {
+        for (auto& v : graph.GetVertices())
+        {
+            Vector<int32_t>& a = u.GetSecond().GetCoordinates();
+            Vector<int32_t>& b = v.GetSecond().GetCoordinates();
+
+            if (u.GetFirst() < v.GetFirst() and
+                std::abs(a[0] - b[0]) + std::abs(a[1] - b[1]) == 1)
+                graph.AddEdge(u.GetFirst(), v.GetFirst(), 1);
+        }
+    }
+
+    graph::Isochrones<uint32_t, int32_t, bool, 2, false> isochrones(graph);
+
+    Vector<uint32_t>            cutoffs = { 100 };
+    Vector<Vector<std::size_t>> convex;
+    Vector<Vector<std::size_t>> concave;
+
+    isochrones.Compute(0, cutoffs, convex, graph::HullType::CONVEX);
+    isochrones.Compute(0, cutoffs, concave, graph::HullType::CONCAVE, 0.5);
+
+    double_t convexArea  = PolygonArea(graph, convex[0]);
+    double_t concaveArea = PolygonArea(graph, concave[0]);
+
+    CHECK(convexArea == 2 * 36);
+    CHECK(concaveArea > 0);
+    CHECK(concaveArea < convexArea);
+
+    // Every vertex stays inside the concave polygon, but the notch does not
+    bool enclosesAll = true;
+
+    for (auto& pair : graph.GetVertices())
+    {
+        Vector<int32_t>& p = pair.GetSecond().GetCoordinates();
+        enclosesAll        = enclosesAll and Encloses(graph, concave[0], p[0], p[1]);
+    }
+
+    CHECK(enclosesAll);
+    CHECK_FALSE(Encloses(graph, concave[0], 3, 5));
+}
@@ -0,0 +1,155 @@
+/*
+ * Filename: johnson_test.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "doctest.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <limits>
+#include <string>
+
+#include "dijkstra.h"
+#include "distance_table.h"
+#include "frozen_graph.h"
+#include "johnson.h"
+#include "search_workspace.h"
+
+TEST_CASE("Johnson's algorithm test")
+{
+    graph::Graph<int32_t, int32_t, bool, 2, true> graph;
+
+    for (std::size_t i = 0; i < 5; i++)
+        graph.AddVertex();
+
+    // This graph can be found in the book 'Introduction to Algorithms,' by Thomas
+    // Cormen, third edition, Figure 25.6, with the vertices numbered from zero
+    graph.AddEdge(0, 1, 3);
+    graph.AddEdge(0, 2, 8);
+    graph.AddEdge(0, 4, -4);
+    graph.AddEdge(1, 3, 1);
+    graph.AddEdge(1, 4, 7);
+    graph.AddEdge(2, 1, 4);
+    graph.AddEdge(3, 0, 2);
+    graph.AddEdge(3, 2, -5);
+    graph.AddEdge(4, 3, 6);
+
+    int32_t expected[5][5] = { { 0, 1, -3, 2, -4 },
+                               { 3, 0, -4, 1, -1 },
+                               { 7, 4, 0, 5, 3 },
+                               { 2, -1, -5, 0, -2 },
+                               { 8, 5, 1, 6, 0 } };
+
+    graph::FrozenGraph<int32_t> frozen(graph);
+
+    graph::DistanceTable<int32_t> table;
+    REQUIRE(graph::Johnson(frozen, table, 2));
+
+    REQUIRE(table.GetNumVertices() == 5);
+
+    bool sameCosts = true;
+
+    for (std::size_t s = 0; s < 5; s++)
+        for (std::size_t t = 0; t < 5; t++)
+            sameCosts = sameCosts and table.Get(s, t) == expected[s][t];
+
+    CHECK(sameCosts);
+
+    // The same table written to a file
+    std::string path =
+        (std::filesystem::temp_directory_path() / "johnson_test.bin").string();
+
+    graph::DistanceTable<int32_t> file;
+    REQUIRE(file.Create(path, 5));
+    REQUIRE(graph::Johnson(frozen, file, 3));
+
+    graph::DistanceTable<int32_t> mapped;
+    REQUIRE(mapped.Map(path));
+
+    sameCosts = true;
+
+    for (std::size_t s = 0; s < 5; s++)
+        for (std::size_t t = 0; t < 5; t++)
+            sameCosts = sameCosts and mapped.Get(s, t) == expected[s][t];
+
+    CHECK(sameCosts);
+
+    // File-backed tables that cannot receive the costs are rejected, not replaced
+    // by a table in memory
+    CHECK_FALSE(graph::Johnson(frozen, mapped));
+    CHECK(mapped.IsMapped());
+
+    std::string smallPath =
+        (std::filesystem::temp_directory_path() / "johnson_small_test.bin").string();
+
+    graph::DistanceTable<int32_t> small;
+    REQUIRE(small.Create(smallPath, 3));
+
+    CHECK_FALSE(graph::Johnson(frozen, small));
+    CHECK(small.IsMapped());
+    CHECK(small.GetNumVertices() == 3);
+
+    std::remove(smallPath.c_str());
+    std::remove(path.c_str());
+
+    // A negative cycle 0 -> 4 -> 3 -> 0 leaves the table unchanged
+    graph.AddEdge(4, 0, 1);
+    graph.AddEdge(3, 4, -3);
+
+    graph::FrozenGraph<int32_t> cyclic(graph);
+
+    CHECK_FALSE(graph::Johnson(cyclic, table));
+    CHECK(table.Get(0, 2) == -3);
+}
+
+TEST_CASE("Johnson's algorithm matches Dijkstra on non-negative costs")
+{
+    graph::Graph<uint32_t, int32_t, bool, 2, true> graph;
+
+    uint32_t side = 12;
+
+    for (int32_t i = 0; i < int32_t(side); i++)
+        for (int32_t j = 0; j < int32_t(side); j++)
+            graph.AddVertex({ i, j });
+
+    for (uint32_t i = 0; i < side; i++)
+    {
+        for (uint32_t j = 0; j < side; j++)
+        {
+            uint32_t u = i * side + j;
+
+            if (i + 1 < side)
+                graph.AddEdge(u, u + side, 10 + (i * 7 + j * 3) % 11);
+
+            if (j + 1 < side)
+            {
+                graph.AddEdge(u, u + 1, 10 + (i + j * 11) % 17);
+                graph.AddEdge(u + 1, u, 10 + (i * 3 + j) % 7);
+            }
+        }
+    }
+
+    graph::FrozenGraph<uint32_t>     frozen(graph);
+    graph::SearchWorkspace<uint32_t> workspace;
+
+    graph::DistanceTable<uint32_t> table;
+    REQUIRE(graph::Johnson(frozen, table));
+
+    bool sameCosts = true;
+
+    for (std::size_t s = 0; s < frozen.GetNumVertices(); s += 7)
+    {
+        graph::Dijkstra(frozen, s, workspace);
+
+        for (std::size_t t = 0; t < frozen.GetNumVertices(); t++)
+            sameCosts = sameCosts and table.Get(s, t) == workspace.GetCost(t);
+    }
+
+    CHECK(sameCosts);
+
+    // Only downward arcs, so the top row cannot be reached from below
+    CHECK(table.Get(side * side - 1, 0) == std::numeric_limits<uint32_t>::max());
+}
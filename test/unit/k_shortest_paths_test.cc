@@ -0,0 +1,187 @@
+/*
+ * Filename: k_shortest_paths_test.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "doctest.h"
+
+#include <cstdint>
+
+#include "quick_sort.h"
+
+#include "frozen_graph.h"
+#include "k_shortest_paths.h"
+
+#include "test_graphs.h"
+
+namespace
+{
+    /**
+     * @brief Collect the costs of all loopless paths from a vertex to a target by
+     * exhaustive search
+     */
+    void AllPathCosts(const graph::FrozenGraph<uint32_t>& graph,
+                      std::size_t                         u,
+                      std::size_t                         targetID,
+                      uint32_t                            cost,
+                      Vector<bool>&                       onPath,
+                      Vector<uint32_t>&                   costs)
+    {
+        if (u == targetID)
+        {
+            costs.PushBack(cost);
+            return;
+        }
+
+        onPath[u] = true;
+
+        for (std::size_t arc = graph.GetFirstArc(u); arc < graph.GetLastArc(u); arc++)
+        {
+            if (not onPath[graph.GetHead(arc)])
+            {
+                AllPathCosts(
+                    graph, graph.GetHead(arc), targetID, cost + graph.GetCost(arc),
+                    onPath, costs);
+            }
+        }
+
+        onPath[u] = false;
+    }
+} // namespace
+
+TEST_CASE("K shortest paths on an undirected graph")
+{
+    graph::Graph<uint32_t, uint32_t> graph;
+
+    for (std::size_t i = 0; i < 9; i++)
+        graph.AddVertex();
+
+    // This graph can be found in the book 'Introduction to Algorithms,' by Thomas
+    // Cormen, third edition, Figure 23.5
+    graph.AddEdge(0, 1, 4);
+    graph.AddEdge(0, 7, 8);
+    graph.AddEdge(1, 7, 11);
+    graph.AddEdge(1, 2, 8);
+    graph.AddEdge(2, 3, 7);
+    graph.AddEdge(2, 8, 2);
+    graph.AddEdge(2, 5, 4);
+    graph.AddEdge(3, 4, 9);
+    graph.AddEdge(3, 5, 14);
+    graph.AddEdge(4, 5, 10);
+    graph.AddEdge(5, 6, 2);
+    graph.AddEdge(6, 7, 1);
+    graph.AddEdge(6, 8, 6);
+    graph.AddEdge(7, 8, 7);
+
+    Vector<graph::PathResult<uint32_t>> paths;
+    graph::KShortestPaths(graph, 0, 4, 3, paths, 2);
+
+    REQUIRE(paths.Size() == 3);
+
+    // 0 -> 7 -> 6 -> 5 -> 4
+    CHECK(paths[0].m_vertexIDs.Size() == 5);
+    CHECK(paths[0].m_costs[4] == 21);
+
+    // 0 -> 1 -> 2 -> 5 -> 4
+    CHECK(paths[1].m_vertexIDs[1] == 1);
+    CHECK(paths[1].m_vertexIDs[2] == 2);
+    CHECK(paths[1].m_costs[4] == 26);
+
+    // 0 -> 1 -> 2 -> 3 -> 4 and 0 -> 1 -> 7 -> 6 -> 5 -> 4 tie, the one with fewer
+    // edges comes first
+    CHECK(paths[2].m_vertexIDs.Size() == 5);
+    CHECK(paths[2].m_costs[4] == 28);
+
+    // The graph is left untouched
+    CHECK(graph.GetNumVertices() == 9);
+    CHECK(graph.GetNumEdges() == 14);
+
+    graph::KShortestPaths(graph, 3, 3, 4, paths);
+
+    REQUIRE(paths.Size() == 1);
+    CHECK(paths[0].m_edgeIDs.Size() == 0);
+}
+
+TEST_CASE("K shortest paths match an exhaustive search")
+{
+    graph::Graph<uint32_t, int32_t, bool, 2, true> graph;
+
+    uint32_t side = 4;
+
+    BuildTravelTimeGrid(graph, side);
+
+    // An isolated vertex is never reached
+    graph.AddVertex({ 100, 100 });
+
+    graph::FrozenGraph<uint32_t> frozen(graph);
+
+    Vector<bool>     onPath(frozen.GetNumVertices(), false);
+    Vector<uint32_t> costs;
+    AllPathCosts(frozen, 0, 15, 0, onPath, costs);
+
+    sort::Quick(costs, [](const uint32_t& a, const uint32_t& b) { return a < b; });
+
+    for (std::size_t numThreads : { 1, 4 })
+    {
+        Vector<graph::PathResult<uint32_t>> paths;
+        graph::KShortestPaths(frozen, 0, 15, 40, paths, numThreads);
+
+        REQUIRE(paths.Size() == 40);
+
+        bool sameCosts  = true;
+        bool validPaths = true;
+        bool distinct   = true;
+
+        for (std::size_t p = 0; p < paths.Size(); p++)
+        {
+            const graph::PathResult<uint32_t>& path = paths[p];
+
+            sameCosts = sameCosts and path.m_costs[path.m_costs.Size() - 1] == costs[p];
+
+            // Consecutive edges must be joined and no vertex may repeat
+            Vector<bool> seen(frozen.GetNumVertices(), false);
+            uint32_t     cost = 0;
+
+            for (std::size_t i = 0; i < path.m_edgeIDs.Size(); i++)
+            {
+                auto* edge = graph.GetEdges().Get(path.m_edgeIDs[i]);
+
+                validPaths = validPaths and
+                             edge->GetVertices().GetFirst()->GetID() ==
+                                 path.m_vertexIDs[i] and
+                             edge->GetVertices().GetSecond()->GetID() ==
+                                 path.m_vertexIDs[i + 1];
+
+                validPaths = validPaths and not seen[path.m_vertexIDs[i]];
+                seen[path.m_vertexIDs[i]] = true;
+
+                cost       += edge->GetCost();
+                validPaths  = validPaths and path.m_costs[i + 1] == cost;
+            }
+
+            for (std::size_t q = 0; q < p; q++)
+            {
+                bool same = paths[q].m_edgeIDs.Size() == path.m_edgeIDs.Size();
+
+                for (std::size_t i = 0; same and i < path.m_edgeIDs.Size(); i++)
+                    same = paths[q].m_edgeIDs[i] == path.m_edgeIDs[i];
+
+                distinct = distinct and not same;
+            }
+        }
+
+        CHECK(sameCosts);
+        CHECK(validPaths);
+        CHECK(distinct);
+    }
+
+    // All the loopless paths are found when more are asked for
+    Vector<graph::PathResult<uint32_t>> paths;
+    graph::KShortestPaths(frozen, 0, 15, costs.Size() + 10, paths);
+
+    CHECK(paths.Size() == costs.Size());
+
+    graph::KShortestPaths(frozen, 0, 16, 3, paths);
+    CHECK(paths.Size() == 0);
+}
@@ -0,0 +1,171 @@
+/*
+ * Filename: landmarks_test.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "doctest.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "a_star.h"
+#include "dijkstra.h"
+#include "frozen_graph.h"
+#include "landmarks.h"
+#include "search_workspace.h"
+
+#include "test_graphs.h"
+
+TEST_CASE("Landmark bounds never overestimate the costs")
+{
+    graph::Graph<uint32_t, int32_t, bool, 2, true> graph;
+    BuildTravelTimeGrid(graph, 12);
+
+    graph::FrozenGraph<uint32_t>     frozen(graph);
+    graph::SearchWorkspace<uint32_t> workspace;
+
+    for (auto selection :
+         { graph::LandmarkSelection::FARTHEST, graph::LandmarkSelection::AVOID })
+    {
+        graph::Landmarks<uint32_t> landmarks;
+        landmarks.Build(frozen, 4, selection, 2);
+
+        REQUIRE(landmarks.GetNumLandmarks() == 4);
+
+        bool   admissible = true;
+        double tightest   = 0;
+
+        for (std::size_t s = 0; s < frozen.GetNumVertices(); s += 7)
+        {
+            graph::Dijkstra(frozen, s, workspace);
+
+            for (std::size_t t = 0; t < frozen.GetNumVertices(); t++)
+            {
+                double_t bound = landmarks.LowerBound(s, t);
+
+                admissible = admissible and bound <= workspace.GetCost(t);
+
+                if (bound > tightest)
+                    tightest = bound;
+            }
+        }
+
+        CHECK(admissible);
+        CHECK(tightest > 0);
+
+        // Landmarks are at distance zero from themselves
+        std::size_t first = landmarks.GetLandmarks()[0];
+        CHECK(landmarks.GetCostFrom(0, first) == 0);
+        CHECK(landmarks.GetCostTo(0, first) == 0);
+    }
+}
+
+TEST_CASE("Landmark tables are serializable")
+{
+    graph::Graph<uint32_t, int32_t, bool, 2, true> graph;
+    BuildTravelTimeGrid(graph, 6);
+
+    graph::FrozenGraph<uint32_t> frozen(graph);
+
+    graph::Landmarks<uint32_t> landmarks;
+    landmarks.Build(frozen, 3, graph::LandmarkSelection::FARTHEST);
+
+    std::string path =
+        (std::filesystem::temp_directory_path() / "landmarks_test.bin").string();
+
+    REQUIRE(landmarks.Save(path));
+
+    graph::Landmarks<uint32_t> loaded;
+    REQUIRE(loaded.Load(path));
+
+    CHECK(loaded.GetNumLandmarks() == landmarks.GetNumLandmarks());
+    CHECK(loaded.GetNumVertices() == landmarks.GetNumVertices());
+
+    bool sameTables = true;
+
+    for (std::size_t i = 0; i < landmarks.GetNumLandmarks(); i++)
+    {
+        sameTables = sameTables and
+                     loaded.GetLandmarks()[i] == landmarks.GetLandmarks()[i];
+
+        for (std::size_t v = 0; v < landmarks.GetNumVertices(); v++)
+        {
+            sameTables = sameTables and
+                         loaded.GetCostFrom(i, v) == landmarks.GetCostFrom(i, v) and
+                         loaded.GetCostTo(i, v) == landmarks.GetCostTo(i, v);
+        }
+    }
+
+    CHECK(sameTables);
+
+    // A table saved with another cost type is rejected
+    graph::Landmarks<double_t> wrongType;
+    CHECK_FALSE(wrongType.Load(path));
+
+    // A truncated table is rejected and leaves the loaded landmarks as they were
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+
+    CHECK_FALSE(loaded.Load(path));
+    CHECK(loaded.GetNumLandmarks() == landmarks.GetNumLandmarks());
+    CHECK(loaded.GetCostFrom(0, 1) == landmarks.GetCostFrom(0, 1));
+
+    // So is a header with a number of landmarks that does not fit in the file
+    {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        uint64_t     numLandmarks = uint64_t(1) << 60;
+
+        file.seekp(3 * sizeof(uint64_t));
+        file.write(reinterpret_cast<const char*>(&numLandmarks), sizeof(numLandmarks));
+    }
+
+    CHECK_FALSE(loaded.Load(path));
+    CHECK(loaded.GetNumLandmarks() == landmarks.GetNumLandmarks());
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("A* with landmarks settles fewer vertices than A* with geometric bounds")
+{
+    graph::Graph<uint32_t, int32_t, bool, 2, true> graph;
+    BuildTravelTimeGrid(graph, 20);
+
+    graph::FrozenGraph<uint32_t> frozen(graph);
+    graph::Landmarks<uint32_t>   landmarks;
+    landmarks.Build(frozen, 8);
+
+    std::size_t source = 21;
+    std::size_t target = 20 * 20 - 22;
+
+    graph::SearchWorkspace<uint32_t> workspace;
+    graph::Dijkstra(frozen, source, workspace);
+
+    graph::SearchStatistics geometric;
+    graph::SearchStatistics alt;
+
+    graph::AStar(graph,
+                 source,
+                 target,
+                 heuristics::distance::Heuristic::EUCLIDEAN,
+                 &geometric);
+    CHECK(graph.GetVertex(target).GetCurrentCost() == workspace.GetCost(target));
+
+    graph::AStar(graph, source, target, landmarks, &alt);
+    CHECK(graph.GetVertex(target).GetCurrentCost() == workspace.GetCost(target));
+
+    CHECK(alt.m_settledVertices < geometric.m_settledVertices);
+
+    // Tables of a smaller graph do not cover the vertex IDs, so they are ignored
+    graph::Graph<uint32_t, int32_t, bool, 2, true> smaller;
+    BuildTravelTimeGrid(smaller, 5);
+
+    graph::FrozenGraph<uint32_t> smallerFrozen(smaller);
+    graph::Landmarks<uint32_t>   stale;
+    stale.Build(smallerFrozen, 4);
+
+    graph::AStar(graph, source, target, stale);
+    CHECK(graph.GetVertex(target).GetCurrentCost() == workspace.GetCost(target));
+}
@@ -0,0 +1,156 @@
+/*
+ * Filename: multi_source_bfs_test.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "doctest.h"
+
+#include <cstdint>
+#include <limits>
+
+#include "bfs.h"
+#include "multi_source_bfs.h"
+
+TEST_CASE("Multi-source BFS")
+{
+    constexpr std::size_t NUM_VERTICES = 400;
+
+    // A directed graph with a long chain and random shortcuts. Vertex 0 has no
+    // incoming arc
+    graph::Graph<uint32_t, uint32_t, bool, 2, true> graph;
+
+    for (std::size_t i = 0; i < NUM_VERTICES; i++)
+        graph.AddVertex();
+
+    uint64_t seed = 2024;
+
+    auto Random = [&]() {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        return std::size_t(seed >> 33);
+    };
+
+    for (std::size_t i = 1; i + 1 < NUM_VERTICES; i++)
+        graph.AddEdge(i, i + 1);
+
+    for (std::size_t i = 0; i < NUM_VERTICES; i++)
+        graph.AddEdge(Random() % NUM_VERTICES, 1 + Random() % (NUM_VERTICES - 1));
+
+    // More sources than fit in a batch of 64 or 256, with a repeated source and
+    // one that is not a vertex
+    Vector<std::size_t> sources;
+
+    for (std::size_t i = 0; i < 300; i++)
+        sources.PushBack(Random() % NUM_VERTICES);
+
+    sources.PushBack(sources[7]);
+    sources.PushBack(0);
+    sources.PushBack(NUM_VERTICES);
+
+    graph::FrozenGraph<uint32_t> frozen(graph);
+
+    Vector<uint32_t> narrow;
+    Vector<uint32_t> wide;
+
+    graph::MultiSourceBFS<1>(frozen, sources, narrow, 1);
+    graph::MultiSourceBFS<8>(frozen, sources, wide, 4);
+
+    REQUIRE(narrow.Size() == sources.Size() * NUM_VERTICES);
+    REQUIRE(wide.Size() == narrow.Size());
+
+    bool sameHops = true;
+
+    for (std::size_t i = 0; i + 1 < sources.Size(); i++)
+    {
+        graph::BFS(graph, sources[i]);
+
+        for (std::size_t v = 0; v < NUM_VERTICES; v++)
+        {
+            uint32_t expected = graph.GetVertices().At(v).GetCurrentCost();
+
+            sameHops = sameHops and narrow[i * NUM_VERTICES + v] == expected and
+                       wide[i * NUM_VERTICES + v] == expected;
+        }
+    }
+
+    CHECK(sameHops);
+
+    // The source that is not a vertex reaches nothing
+    bool unreached = true;
+
+    for (std::size_t v = 0; v < NUM_VERTICES; v++)
+        unreached = unreached and narrow[(sources.Size() - 1) * NUM_VERTICES + v] ==
+                                      std::numeric_limits<uint32_t>::max();
+
+    CHECK(unreached);
+
+    Vector<uint64_t>    sums;
+    Vector<std::size_t> reached;
+
+    graph::MultiSourceBFSSums(frozen, sources, sums, reached, 2);
+
+    bool sameSums = sums.Size() == sources.Size();
+
+    for (std::size_t i = 0; i < sources.Size(); i++)
+    {
+        uint64_t    sum   = 0;
+        std::size_t count = 0;
+
+        for (std::size_t v = 0; v < NUM_VERTICES; v++)
+        {
+            if (narrow[i * NUM_VERTICES + v] != std::numeric_limits<uint32_t>::max())
+            {
+                sum += narrow[i * NUM_VERTICES + v];
+                count++;
+            }
+        }
+
+        sameSums = sameSums and sums[i] == sum and reached[i] == count;
+    }
+
+    CHECK(sameSums);
+    CHECK(reached[sources.Size() - 1] == 0);
+}
+
+TEST_CASE("Multi-source BFS shares the scans of a batch")
+{
+    constexpr std::size_t NUM_VERTICES = 100;
+
+    // An undirected cycle, from which every vertex reaches all the others
+    graph::Graph<uint32_t, uint32_t> graph;
+
+    for (std::size_t i = 0; i < NUM_VERTICES; i++)
+        graph.AddVertex();
+
+    for (std::size_t i = 0; i < NUM_VERTICES; i++)
+        graph.AddEdge(i, (i + 1) % NUM_VERTICES);
+
+    Vector<std::size_t> sources;
+
+    for (std::size_t i = 0; i < 64; i++)
+        sources.PushBack(i);
+
+    Vector<uint32_t> hops;
+
+    graph::MultiSourceBFS(graph, sources, hops);
+
+    CHECK(hops[0 * NUM_VERTICES + 50] == 50);
+    CHECK(hops[3 * NUM_VERTICES + 99] == 4);
+    CHECK(hops[63 * NUM_VERTICES + 10] == 47);
+
+    graph::FrozenGraph<uint32_t> frozen(graph);
+
+    Vector<uint64_t>        sums;
+    Vector<std::size_t>     reached;
+    graph::SearchStatistics stats;
+
+    graph::MultiSourceBFSSums<1>(frozen, sources, sums, reached, 1, &stats);
+
+    // Each vertex of a cycle of 100 vertices is 1 + 1 + ... + 49 + 49 + 50 hops
+    // away from the others in total
+    CHECK(sums[0] == 2500);
+    CHECK(reached[63] == NUM_VERTICES);
+
+    // A single batch of 64 BFSs scans fewer arcs than the 64 BFSs one at a time
+    CHECK(stats.m_relaxedEdges < 64 * frozen.GetNumArcs());
+}
@@ -0,0 +1,51 @@
+/*
+ * Filename: parallel_test.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "doctest.h"
+
+#include <atomic>
+#include <cstddef>
+
+#include "parallel.h"
+#include "vector.h"
+
+TEST_CASE("Parallel for visits every index exactly once")
+{
+    const std::size_t count      = 1000;
+    const std::size_t numThreads = 4;
+
+    Vector<std::size_t> visits(count, 0);
+    std::atomic<bool>   validThreadIndex(true);
+
+    parallel::For(
+        count,
+        [&](std::size_t i, std::size_t threadIndex) {
+            visits[i]++;
+
+            if (threadIndex >= numThreads)
+                validThreadIndex = false;
+        },
+        numThreads);
+
+    bool allVisitedOnce = true;
+
+    for (std::size_t i = 0; i < count; i++)
+        allVisitedOnce = allVisitedOnce and visits[i] == 1;
+
+    CHECK(allVisitedOnce);
+    CHECK(validThreadIndex);
+}
+
+TEST_CASE("Parallel for with no work")
+{
+    std::size_t calls = 0;
+
+    parallel::For(0, [&](std::size_t, std::size_t) { calls++; });
+
+    CHECK(calls == 0);
+    CHECK(parallel::GetNumThreads(3) == 3);
+    CHECK(parallel::GetNumThreads() >= 1);
+}
@@ -0,0 +1,288 @@
+/*
+ * Filename: pattern_database_test.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "doctest.h"
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <string>
+
+#include "implicit_search.h"
+#include "pattern_database.h"
+
+namespace
+{
+    // 2x3 sliding puzzle, tile 0 is the blank
+    using Board = std::array<uint8_t, 6>;
+
+    const Board GOAL = { 1, 2, 3, 4, 5, 0 };
+
+    auto Slide = [](const Board& board, auto emit) {
+        std::size_t blank = 0;
+
+        while (board[blank] != 0)
+            blank++;
+
+        for (std::size_t cell = 0; cell < 6; cell++)
+        {
+            std::size_t dx = cell % 3 > blank % 3 ? cell % 3 - blank % 3
+                                                  : blank % 3 - cell % 3;
+            std::size_t dy = cell / 3 > blank / 3 ? cell / 3 - blank / 3
+                                                  : blank / 3 - cell / 3;
+
+            if (dx + dy != 1)
+                continue;
+
+            Board next  = board;
+            next[blank] = next[cell];
+            next[cell]  = 0;
+            emit(next, uint32_t(1));
+        }
+    };
+
+    auto HashBoard = [](const Board& board) {
+        uint64_t hash = 0;
+
+        for (uint8_t tile : board)
+            hash = hash * 8 + tile;
+
+        return hash;
+    };
+
+    auto IsSolved = [](const Board& board) { return board == GOAL; };
+
+    // Tiles of each pattern. The abstract state of a board is the cell of the blank
+    // and the cells of the tiles of the pattern, as digits of a base 6 number
+    const std::array<std::array<uint8_t, 3>, 2> PATTERNS = { { { 1, 2, 3 },
+                                                               { 4, 5, 0 } } };
+
+    std::size_t PatternLength(std::size_t k)
+    {
+        return PATTERNS[k][2] == 0 ? 2 : 3;
+    }
+
+    std::size_t Abstract(const Board& board, std::size_t k)
+    {
+        std::size_t index = 0;
+
+        for (std::size_t j = PatternLength(k); j-- > 0;)
+            for (std::size_t cell = 0; cell < 6; cell++)
+                if (board[cell] == PATTERNS[k][j])
+                    index = index * 6 + cell;
+
+        for (std::size_t cell = 0; cell < 6; cell++)
+            if (board[cell] == 0)
+                index = index * 6 + cell;
+
+        return index;
+    }
+
+    std::size_t PatternSize(std::size_t k)
+    {
+        std::size_t size = 6;
+
+        for (std::size_t j = 0; j < PatternLength(k); j++)
+            size *= 6;
+
+        return size;
+    }
+
+    // Moves of the blank are free unless they move a tile of the pattern, so the
+    // databases of disjoint patterns can be added
+    auto Predecessors(std::size_t k)
+    {
+        return [k](std::size_t index, auto emit) {
+            std::array<std::size_t, 4> cells;
+
+            std::size_t length = PatternLength(k) + 1;
+
+            for (std::size_t j = 0; j < length; j++, index /= 6)
+                cells[j] = index % 6;
+
+            std::size_t blank = cells[0];
+
+            for (std::size_t cell = 0; cell < 6; cell++)
+            {
+                std::size_t dx = cell % 3 > blank % 3 ? cell % 3 - blank % 3
+                                                      : blank % 3 - cell % 3;
+                std::size_t dy = cell / 3 > blank / 3 ? cell / 3 - blank / 3
+                                                      : blank / 3 - cell / 3;
+
+                if (dx + dy != 1)
+                    continue;
+
+                std::array<std::size_t, 4> next = cells;
+
+                uint8_t cost = 0;
+
+                for (std::size_t j = 1; j < length; j++)
+                {
+                    if (next[j] == cell)
+                    {
+                        next[j] = blank;
+                        cost    = 1;
+                    }
+                }
+
+                next[0] = cell;
+
+                std::size_t previous = 0;
+
+                for (std::size_t j = length; j-- > 0;)
+                    previous = previous * 6 + next[j];
+
+                emit(previous, cost);
+            }
+        };
+    }
+
+    void BuildPattern(graph::implicit::PatternDatabase& database,
+                      std::size_t                       k,
+                      std::size_t                       numThreads)
+    {
+        database.Build(PatternSize(k),
+                       Vector<std::size_t>{ Abstract(GOAL, k) },
+                       Predecessors(k),
+                       numThreads);
+    }
+} // namespace
+
+TEST_CASE("Pattern databases of a sliding puzzle")
+{
+    namespace implicit = graph::implicit;
+
+    implicit::PatternDatabase first;
+    implicit::PatternDatabase second;
+    implicit::PatternDatabase parallel;
+
+    BuildPattern(first, 0, 1);
+    BuildPattern(second, 1, 1);
+    BuildPattern(parallel, 0, 4);
+
+    CHECK(first.GetSize() == 6 * 6 * 6 * 6);
+    CHECK(first.Get(Abstract(GOAL, 0)) == 0);
+
+    bool sameEntries = true;
+
+    for (std::size_t i = 0; i < first.GetSize(); i++)
+        sameEntries = sameEntries and first.Get(i) == parallel.Get(i);
+
+    CHECK(sameEntries);
+
+    Vector<const implicit::PatternDatabase*> databases = { &first, &second };
+
+    implicit::PatternDatabaseHeuristic additive(
+        databases, Abstract, implicit::PatternCombination::ADDITIVE);
+    implicit::PatternDatabaseHeuristic maximum(
+        databases, Abstract, implicit::PatternCombination::MAXIMUM);
+
+    // Distances of all the boards that reach the goal
+    std::map<Board, uint32_t> distances = { { GOAL, 0 } };
+    std::deque<Board>         queue     = { GOAL };
+
+    while (not queue.empty())
+    {
+        Board board = queue.front();
+        queue.pop_front();
+
+        Slide(board, [&](const Board& next, uint32_t) {
+            if (distances.emplace(next, distances[board] + 1).second)
+                queue.push_back(next);
+        });
+    }
+
+    REQUIRE(distances.size() == 360);
+
+    bool admissible = true;
+    bool dominates  = true;
+
+    for (auto& [board, distance] : distances)
+    {
+        admissible = admissible and additive(board) <= distance;
+        dominates  = dominates and maximum(board) <= additive(board);
+    }
+
+    CHECK(admissible);
+    CHECK(dominates);
+
+    // The board farthest from the goal
+    Board start = { 4, 5, 0, 1, 2, 3 };
+
+    implicit::StatePath<Board, uint32_t> path;
+    graph::SearchStatistics              informed;
+    graph::SearchStatistics              blind;
+
+    CHECK(implicit::IDAStar(
+              start, Slide, IsSolved, HashBoard, additive, path, 64, &informed) == 21);
+    CHECK(implicit::IDDFS(start, Slide, IsSolved, HashBoard, path, 64, &blind) == 21);
+    CHECK(informed.m_settledVertices < blind.m_settledVertices);
+
+    CHECK(implicit::AStar(start, Slide, IsSolved, HashBoard, maximum, path) == 21);
+}
+
+TEST_CASE("Pattern database saturation and files")
+{
+    graph::implicit::PatternDatabase database;
+
+    // A path 0 - 1 - ... - 39 with the goal at 0. The move between 2i and 2i + 1 is
+    // free
+    database.Build(
+        40,
+        Vector<std::size_t>{ 0 },
+        [](std::size_t index, auto emit) {
+            if (index + 1 < 40)
+                emit(index + 1, index % 2 == 0 ? 0 : 1);
+
+            if (index > 0)
+                emit(index - 1, index % 2 == 1 ? 0 : 1);
+        },
+        2);
+
+    CHECK(database.Get(1) == 0);
+    CHECK(database.Get(2) == 1);
+    CHECK(database.Get(29) == 14);
+    CHECK(database.Get(30) == graph::implicit::PatternDatabase::MAX_DISTANCE);
+    CHECK(database.Get(39) == graph::implicit::PatternDatabase::MAX_DISTANCE);
+
+    std::string path =
+        (std::filesystem::temp_directory_path() / "pattern_database_test.bin").string();
+
+    REQUIRE(database.Save(path));
+
+    graph::implicit::PatternDatabase mapped;
+
+    REQUIRE(mapped.Map(path));
+
+    bool sameEntries = mapped.GetSize() == 40;
+
+    for (std::size_t i = 0; i < 40; i++)
+        sameEntries = sameEntries and mapped.Get(i) == database.Get(i);
+
+    CHECK(sameEntries);
+
+    std::remove(path.c_str());
+
+    CHECK_FALSE(mapped.Map(path));
+
+    // A header whose number of entries wraps when rounded up to bytes is rejected
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        uint64_t      header[2] = { 0x31424450, std::numeric_limits<uint64_t>::max() };
+
+        file.write(reinterpret_cast<const char*>(header), sizeof(header));
+    }
+
+    CHECK_FALSE(mapped.Map(path));
+    CHECK(mapped.GetSize() == 40);
+
+    std::remove(path.c_str());
+}
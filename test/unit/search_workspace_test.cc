@@ -0,0 +1,120 @@
+/*
+ * Filename: search_workspace_test.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "doctest.h"
+
+#include <cstdint>
+#include <limits>
+
+#include "search_workspace.h"
+
+TEST_CASE("Search workspace keeps the smallest cost of each vertex")
+{
+    graph::SearchWorkspace<uint32_t> workspace;
+
+    workspace.Reset(4);
+
+    CHECK(workspace.Update(0, 0));
+    CHECK(workspace.Update(2, 7, 0, 1));
+    CHECK(workspace.Update(2, 5, 0, 3));
+    CHECK_FALSE(workspace.Update(2, 6, 0, 4));
+
+    CHECK(workspace.GetCost(2) == 5);
+    CHECK(workspace.GetArc(2) == 3);
+    CHECK(workspace.GetPredecessor(2) == 0);
+    CHECK(workspace.GetTouched().Size() == 2);
+
+    std::size_t u;
+
+    REQUIRE(workspace.PopMin(u));
+    CHECK(u == 0);
+    REQUIRE(workspace.PopMin(u));
+    CHECK(u == 2);
+
+    // The outdated entry of vertex 2 is skipped
+    CHECK_FALSE(workspace.PopMin(u));
+    CHECK(workspace.IsSettled(2));
+
+    // Settled vertices are never updated again
+    CHECK_FALSE(workspace.Update(2, 1, 0, 5));
+}
+
+TEST_CASE("Search workspace forgets the previous query on reset")
+{
+    graph::SearchWorkspace<uint32_t> workspace;
+
+    workspace.Reset(3);
+    workspace.Update(1, 4);
+
+    workspace.Reset(3);
+
+    CHECK_FALSE(workspace.IsReached(1));
+    CHECK(workspace.GetCost(1) == std::numeric_limits<uint32_t>::max());
+    CHECK(workspace.GetPredecessor(1) ==
+          graph::SearchWorkspace<uint32_t>::NO_VERTEX);
+    CHECK(workspace.GetTouched().Size() == 0);
+
+    std::size_t u;
+    CHECK_FALSE(workspace.PopMin(u));
+}
+
+TEST_CASE("Search workspace settles vertices up to a bound")
+{
+    graph::SearchWorkspace<uint32_t> workspace;
+
+    workspace.Reset(3);
+    workspace.Update(0, 0);
+    workspace.Update(1, 5, 0, 0);
+    workspace.Update(2, 9, 0, 1);
+
+    std::size_t u;
+
+    REQUIRE(workspace.PopMin(u, 6));
+    CHECK(u == 0);
+    REQUIRE(workspace.PopMin(u, 6));
+    CHECK(u == 1);
+
+    // Vertex 2 is over the bound, but stays queued
+    CHECK_FALSE(workspace.PopMin(u, 6));
+    CHECK_FALSE(workspace.IsSettled(2));
+
+    REQUIRE(workspace.PopMin(u, 9));
+    CHECK(u == 2);
+}
+
+TEST_CASE("Search workspace computes each heuristic once per query")
+{
+    graph::SearchWorkspace<uint32_t> workspace;
+    graph::SearchStatistics          stats;
+
+    std::size_t calls    = 0;
+    auto        Estimate = [&calls](std::size_t v) -> double_t {
+        calls++;
+        return 2.0 * v;
+    };
+
+    workspace.Reset(4);
+
+    CHECK(workspace.GetHeuristic(3, Estimate, &stats) == 6);
+    CHECK(workspace.GetHeuristic(3, Estimate, &stats) == 6);
+    CHECK(workspace.GetHeuristic(1, Estimate, &stats) == 2);
+    CHECK(calls == 2);
+    CHECK(stats.m_heuristicEvaluations == 2);
+    CHECK(stats.m_heuristicCacheHits == 1);
+
+    // A new query may have another target, so the estimates are computed again
+    workspace.Reset(4);
+
+    CHECK(workspace.GetHeuristic(3, Estimate) == 6);
+    CHECK(calls == 3);
+
+    // Growing the workspace keeps the cache consistent
+    workspace.Reset(8);
+
+    CHECK(workspace.GetHeuristic(7, Estimate) == 14);
+    CHECK(workspace.GetHeuristic(3, Estimate) == 6);
+    CHECK(calls == 5);
+}
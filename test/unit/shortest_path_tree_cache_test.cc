@@ -0,0 +1,116 @@
+/*
+ * Filename: shortest_path_tree_cache_test.cc
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#include "doctest.h"
+
+#include <cstdint>
+#include <limits>
+
+#include "frozen_graph.h"
+#include "graph_utils.h"
+#include "shortest_path_tree_cache.h"
+
+TEST_CASE("Shortest path tree cache test")
+{
+    graph::Graph<uint32_t, uint32_t> graph;
+
+    for (std::size_t i = 0; i < 10; i++)
+        graph.AddVertex();
+
+    // This graph can be found in the book 'Introduction to Algorithms,' by Thomas
+    // Cormen, third edition, Figure 23.5. Vertex 9 is isolated
+    graph.AddEdge(0, 1, 4);
+    graph.AddEdge(0, 7, 8);
+    graph.AddEdge(1, 7, 11);
+    graph.AddEdge(1, 2, 8);
+    graph.AddEdge(2, 3, 7);
+    graph.AddEdge(2, 8, 2);
+    graph.AddEdge(2, 5, 4);
+    graph.AddEdge(3, 4, 9);
+    graph.AddEdge(3, 5, 14);
+    graph.AddEdge(4, 5, 10);
+    graph.AddEdge(5, 6, 2);
+    graph.AddEdge(6, 7, 1);
+    graph.AddEdge(6, 8, 6);
+    graph.AddEdge(7, 8, 7);
+
+    graph::FrozenGraph<uint32_t> frozen(graph);
+
+    // Room for two trees of 10 vertices
+    graph::ShortestPathTreeCache<uint32_t> cache(frozen, 2 * 10 * 12);
+
+    CHECK(cache.GetCost(0, 4) == 21);
+    CHECK(cache.GetCost(0, 8) == 14);
+    CHECK(cache.GetCost(0, 9) == std::numeric_limits<uint32_t>::max());
+    CHECK(cache.GetNumMisses() == 1);
+    CHECK(cache.GetNumHits() == 2);
+
+    graph::PathResult<uint32_t> path;
+
+    REQUIRE(cache.GetPath(0, 4, path));
+    REQUIRE(path.m_vertexIDs.Size() == 5);
+    CHECK(path.m_vertexIDs[1] == 7);
+    CHECK(path.m_edgeIDs[0] == 1);
+    CHECK(path.m_costs[2] == 9);
+    CHECK(path.m_costs[4] == 21);
+
+    CHECK_FALSE(cache.GetPath(0, 9, path));
+
+    // Source 1 fills the cache, then source 2 evicts it, since 0 was used last
+    CHECK(cache.GetCost(1, 3) == 15);
+    CHECK(cache.GetCost(0, 3) == 19);
+    CHECK(cache.GetCost(2, 0) == 12);
+
+    CHECK(cache.GetNumTrees() == 2);
+    CHECK(cache.GetMemoryUsage() <= 2 * 10 * 12);
+
+    std::size_t misses = cache.GetNumMisses();
+
+    CHECK(cache.GetCost(0, 2) == 12);
+    CHECK(cache.GetNumMisses() == misses);
+    CHECK(cache.GetCost(1, 3) == 15);
+    CHECK(cache.GetNumMisses() == misses + 1);
+
+    // Refreezing the graph after a cost change drops the cached trees
+    graph.GetEdges().Get(7)->SetCost(1);
+    frozen.Freeze(graph);
+
+    CHECK(cache.GetCost(0, 4) == 20);
+    CHECK(cache.GetNumTrees() == 1);
+}
+
+TEST_CASE("Shortest path tree cache of backward trees")
+{
+    graph::Graph<uint32_t, uint32_t, bool, 2, true> graph;
+
+    for (std::size_t i = 0; i < 4; i++)
+        graph.AddVertex();
+
+    graph.AddEdge(0, 1, 2);
+    graph.AddEdge(1, 2, 3);
+    graph.AddEdge(0, 2, 6);
+    graph.AddEdge(2, 3, 1);
+
+    graph::FrozenGraph<uint32_t> frozen(graph);
+
+    // Too small for a tree, the last one is still kept
+    graph::ShortestPathTreeCache<uint32_t> cache(frozen, 0, true);
+
+    CHECK(cache.GetCost(3, 0) == 6);
+    CHECK(cache.GetCost(3, 3) == 0);
+    CHECK(cache.GetCost(2, 3) == std::numeric_limits<uint32_t>::max());
+    CHECK(cache.GetNumTrees() == 1);
+
+    graph::PathResult<uint32_t> path;
+
+    // Costs to 3, so the path starts at 0
+    REQUIRE(cache.GetPath(3, 0, path));
+    REQUIRE(path.m_vertexIDs.Size() == 4);
+    CHECK(path.m_vertexIDs[0] == 0);
+    CHECK(path.m_vertexIDs[3] == 3);
+    CHECK(path.m_costs[1] == 2);
+    CHECK(path.m_costs[3] == 6);
+}
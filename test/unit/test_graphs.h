@@ -0,0 +1,75 @@
+/*
+ * Filename: test_graphs.h
+ * Created on: October 18, 2026
+ * Author: Lucas Araújo <araujolucas@dcc.ufmg.br>
+ */
+
+#ifndef TEST_GRAPHS_H_
+#define TEST_GRAPHS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "graph.h"
+
+namespace
+{
+    /**
+     * @brief Build a directed grid where the costs are travel times, so they do not
+     * follow the coordinates of the vertices
+     * @param graph Receives the side x side vertices, vertex i * side + j being at
+     * (i, j)
+     * @param side Number of vertices on each side of the grid
+     * @param descending If true, the downward edges have negative costs when typeG
+     * is signed. Every cycle climbs as many edges as it descends, and climbing costs
+     * more than descending saves, so there are no negative cycles
+     */
+    template<typename typeG>
+    void BuildTravelTimeGrid(graph::Graph<typeG, int32_t, bool, 2, true>& graph,
+                             int32_t                                      side,
+                             bool descending = false)
+    {
+        for (int32_t i = 0; i < side; i++)
+            for (int32_t j = 0; j < side; j++)
+                graph.AddVertex({ i, j });
+
+        for (int32_t i = 0; i < side; i++)
+        {
+            for (int32_t j = 0; j < side; j++)
+            {
+                std::size_t u = i * side + j;
+
+                if (i + 1 < side)
+                {
+                    typeG down = typeG((i * 7 + j * 3) % 11);
+                    typeG up   = typeG((i * 5 + j) % 13);
+
+                    if (not descending)
+                    {
+                        down += 10;
+                        up += 10;
+                    }
+                    else
+                    {
+                        if constexpr (std::numeric_limits<typeG>::is_signed)
+                            down = -down;
+
+                        up += 20;
+                    }
+
+                    graph.AddEdge(u, u + side, down);
+                    graph.AddEdge(u + side, u, up);
+                }
+
+                if (j + 1 < side)
+                {
+                    graph.AddEdge(u, u + 1, 10 + typeG((i + j * 11) % 17));
+                    graph.AddEdge(u + 1, u, 10 + typeG((i * 3 + j) % 7));
+                }
+            }
+        }
+    }
+} // namespace
+
+#endif // TEST_GRAPHS_H_